@@ -0,0 +1,43 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Async/HttpCircuitWatchAsync.h"
+#include "QuickHttpModule.h"
+
+UHttpCircuitWatchAsync* UHttpCircuitWatchAsync::WatchHttpCircuitBreakers(UObject* InWorldContextObject)
+{
+    UHttpCircuitWatchAsync* Node = NewObject<UHttpCircuitWatchAsync>();
+    Node->WorldContextObject = InWorldContextObject;
+    return Node;
+}
+
+void UHttpCircuitWatchAsync::Activate()
+{
+    if (Handle.IsValid()) { return; }
+    Handle = FQuickHttpModule::Get().GetCircuitBreaker().OnStateChanged().AddUObject(this, &UHttpCircuitWatchAsync::HandleStateChanged);
+}
+
+void UHttpCircuitWatchAsync::HandleStateChanged(const FString& Host, EQuickHttpCircuitState OldState, EQuickHttpCircuitState NewState)
+{
+    OnStateChanged.Broadcast(Host, OldState, NewState);
+}
+
+void UHttpCircuitWatchAsync::Stop()
+{
+    Unbind();
+    SetReadyToDestroy();
+}
+
+void UHttpCircuitWatchAsync::Unbind()
+{
+    if (Handle.IsValid() && FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetCircuitBreaker().OnStateChanged().Remove(Handle);
+    }
+    Handle.Reset();
+}
+
+void UHttpCircuitWatchAsync::BeginDestroy()
+{
+    Unbind();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,628 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Async/HttpDownloadAsync.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpRequestKey.h"
+#include "QuickHttpCompat.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/FileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Async/Async.h"
+
+/**
+ * The .part file and the running digest of everything written to it.
+ * Used by one worker task at a time; the node only hands it from task to task.
+ */
+class FQuickHttpDownloadSink
+{
+public:
+    FQuickHttpDownloadSink(EQuickHttpHashAlgorithm InAlgorithm, const FString& InPath)
+        : Algorithm(InAlgorithm), Path(InPath)
+    {
+    }
+
+    /**
+     * Open the file for appending. When resuming, existing bytes are hashed once and their count
+     * returned in OutExisting; otherwise the file starts empty.
+     */
+    bool Open(bool bResume, int64& OutExisting, FString& OutError)
+    {
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+        OutExisting = 0;
+
+        if (!bResume)
+        {
+            PlatformFile.DeleteFile(*Path);
+        }
+        else if (PlatformFile.FileExists(*Path))
+        {
+            TUniquePtr<IFileHandle> Existing(PlatformFile.OpenRead(*Path));
+            if (!Existing)
+            {
+                OutError = FString::Printf(TEXT("Could not read %s"), *Path);
+                return false;
+            }
+            TArray<uint8> Block;
+            Block.SetNumUninitialized(1024 * 1024);
+            const int64 Size = Existing->Size();
+            while (OutExisting < Size)
+            {
+                const int64 Num = FMath::Min<int64>(Block.Num(), Size - OutExisting);
+                if (!Existing->Read(Block.GetData(), Num))
+                {
+                    OutError = FString::Printf(TEXT("Could not read %s"), *Path);
+                    return false;
+                }
+                Hash(Block.GetData(), Num);
+                OutExisting += Num;
+            }
+        }
+
+        File.Reset(PlatformFile.OpenWrite(*Path, true));
+        if (!File)
+        {
+            OutError = FString::Printf(TEXT("Could not open %s for writing"), *Path);
+            return false;
+        }
+        return true;
+    }
+
+    /** Drop everything written so far and start the file and the digest over. */
+    bool Restart(FString& OutError)
+    {
+        File.Reset();
+        Sha1.Reset();
+        Md5 = FMD5();
+        int64 Existing = 0;
+        return Open(false, Existing, OutError);
+    }
+
+    bool Write(const TArray<uint8>& Data, FString& OutError)
+    {
+        if (Data.Num() == 0) { return true; }
+        if (!File || !File->Write(Data.GetData(), Data.Num()))
+        {
+            OutError = FString::Printf(TEXT("Could not write %s (disk full?)"), *Path);
+            return false;
+        }
+        Hash(Data.GetData(), Data.Num());
+        return true;
+    }
+
+    /** Close the file and return the lower-case hex digest (empty for None). */
+    FString Close()
+    {
+        File.Reset();
+        switch (Algorithm)
+        {
+            case EQuickHttpHashAlgorithm::SHA1:
+            {
+                uint8 Digest[FSHA1::DigestSize];
+                Sha1.Final();
+                Sha1.GetHash(Digest);
+                return BytesToHex(Digest, FSHA1::DigestSize).ToLower();
+            }
+            case EQuickHttpHashAlgorithm::MD5:
+            {
+                uint8 Digest[16];
+                Md5.Final(Digest);
+                return BytesToHex(Digest, 16).ToLower();
+            }
+            default:
+                return FString();
+        }
+    }
+
+    const FString& GetPath() const { return Path; }
+
+private:
+    void Hash(const uint8* Data, int64 Num)
+    {
+        switch (Algorithm)
+        {
+            case EQuickHttpHashAlgorithm::SHA1: Sha1.Update(Data, (uint64)Num); break;
+            case EQuickHttpHashAlgorithm::MD5:  Md5.Update(Data, (uint64)Num); break;
+            default: break;
+        }
+    }
+
+    EQuickHttpHashAlgorithm Algorithm;
+    FString Path;
+    TUniquePtr<IFileHandle> File;
+    FSHA1 Sha1;
+    FMD5 Md5;
+};
+
+namespace QuickHttpDownload
+{
+    /** Parse a Content-Range value such as "bytes 0-99/1000". Total is -1 when the server sent "*"; First is -1 without a span. */
+    static bool ParseContentRange(const FString& Value, int64& OutFirst, int64& OutTotal)
+    {
+        FString Range = Value.TrimStartAndEnd();
+        if (!Range.StartsWith(TEXT("bytes "), ESearchCase::IgnoreCase)) { return false; }
+        Range = Range.RightChop(6).TrimStart();
+
+        FString Span, Total;
+        if (!Range.Split(TEXT("/"), &Span, &Total)) { return false; }
+        OutTotal = Total == TEXT("*") ? -1 : FCString::Atoi64(*Total);
+
+        FString First, Last;
+        OutFirst = Span.Split(TEXT("-"), &First, &Last) ? FCString::Atoi64(*First) : -1;
+        return true;
+    }
+
+    /** If-Range needs a strong validator: a strong ETag, else Last-Modified. */
+    static FString GetValidator(FHttpResponsePtr Response)
+    {
+        const FString ETag = Response->GetHeader(TEXT("ETag"));
+        if (!ETag.IsEmpty() && !ETag.StartsWith(TEXT("W/"))) { return ETag; }
+        return Response->GetHeader(TEXT("Last-Modified"));
+    }
+
+    static FString GetValidatorPath(const FString& PartPath)
+    {
+        return PartPath + TEXT(".validator");
+    }
+}
+
+UHttpDownloadAsync* UHttpDownloadAsync::HttpDownloadToFile(
+    UObject* InWorldContextObject,
+    const FString& InUrl,
+    const TArray<FQuickHttpHeader>& InHeaders,
+    const FString& InFilePath,
+    EQuickHttpHashAlgorithm InHashAlgorithm,
+    const FString& InExpectedHash,
+    int32 InChunkSizeKB,
+    int32 InTimeoutSeconds,
+    int32 InMaxRetries,
+    float InBackoffBaseSeconds,
+    float InProgressIntervalSeconds,
+    bool bInResume,
+    EQuickHttpPriority InPriority)
+{
+    UHttpDownloadAsync* Node = NewObject<UHttpDownloadAsync>();
+    Node->WorldContextObject = InWorldContextObject;
+    Node->Url = InUrl;
+    Node->Host = QuickHttp::GetUrlHost(InUrl);
+    Node->Headers = InHeaders;
+    Node->FilePath = InFilePath.IsEmpty() || !FPaths::IsRelative(InFilePath) ? InFilePath : FPaths::ProjectSavedDir() / InFilePath;
+    Node->PartPath = Node->FilePath + TEXT(".part");
+    Node->HashAlgorithm = InHashAlgorithm;
+    Node->ExpectedHash = InExpectedHash.TrimStartAndEnd().ToLower();
+    Node->ChunkSize = (int64)FMath::Clamp(InChunkSizeKB, 64, 64 * 1024) * 1024;
+    Node->TimeoutSeconds = FMath::Max(1, InTimeoutSeconds);
+    Node->MaxRetries = FMath::Max(0, InMaxRetries);
+    Node->BackoffBaseSeconds = FMath::Max(0.01f, InBackoffBaseSeconds);
+    Node->ProgressIntervalSeconds = FMath::Max(0.f, InProgressIntervalSeconds);
+    Node->bResume = bInResume;
+    Node->Priority = InPriority;
+    return Node;
+}
+
+void UHttpDownloadAsync::Activate()
+{
+    if (bCancelled) { return; }
+    if (Url.IsEmpty() || FilePath.IsEmpty())
+    {
+        Finish(FString(), TEXT("Url and FilePath are required"), 0);
+        return;
+    }
+    if (!ExpectedHash.IsEmpty() && HashAlgorithm == EQuickHttpHashAlgorithm::None)
+    {
+        Finish(FString(), TEXT("ExpectedHash needs a HashAlgorithm"), 0);
+        return;
+    }
+
+    // Opening may hash a large partial file, so it happens on a worker like every write
+    Sink = MakeShared<FQuickHttpDownloadSink, ESPMode::ThreadSafe>(HashAlgorithm, PartPath);
+    TSharedPtr<FQuickHttpDownloadSink, ESPMode::ThreadSafe> WorkerSink = Sink;
+    TWeakObjectPtr<UHttpDownloadAsync> WeakThis(this);
+    const bool bTryResume = bResume;
+    Async(EAsyncExecution::ThreadPool, [WeakThis, WorkerSink, bTryResume]()
+    {
+        // A partial file is only trusted together with the validator of the version it came from
+        FString SavedValidator;
+        const FString ValidatorPath = QuickHttpDownload::GetValidatorPath(WorkerSink->GetPath());
+        const bool bCanResume = bTryResume && FFileHelper::LoadFileToString(SavedValidator, *ValidatorPath) && !SavedValidator.IsEmpty();
+
+        int64 Existing = 0;
+        FString Error;
+        WorkerSink->Open(bCanResume, Existing, Error);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Existing, Error, SavedValidator]()
+        {
+            UHttpDownloadAsync* Node = WeakThis.Get();
+            if (!Node || Node->bCancelled) { return; }
+            if (!Error.IsEmpty())
+            {
+                Node->Finish(FString(), Error, 0);
+                return;
+            }
+            Node->Offset = Existing;
+            Node->Validator = Existing > 0 ? SavedValidator : FString();
+            Node->ReportProgress(Existing, true);
+            Node->Attempt();
+        });
+    });
+}
+
+void UHttpDownloadAsync::Attempt()
+{
+    if (bCancelled) { return; }
+
+    TWeakObjectPtr<UHttpDownloadAsync> WeakThis(this);
+    const FString SlotHost = Host;
+    const uint64 Ticket = FQuickHttpModule::Get().GetScheduler().Acquire(Host, Priority, [WeakThis, SlotHost]()
+    {
+        UHttpDownloadAsync* Node = WeakThis.Get();
+        if (!Node || Node->bCancelled)
+        {
+            FQuickHttpModule::Get().GetScheduler().Release(SlotHost);
+            return;
+        }
+        Node->StartAttempt();
+    });
+
+    if (Ticket != 0) { SchedulerTicket = Ticket; }
+}
+
+void UHttpDownloadAsync::StartAttempt()
+{
+    bHoldsSlot = true;
+    SchedulerTicket = 0;
+
+    TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> Req = FHttpModule::Get().CreateRequest();
+    ActiveRequest = Req;
+    Req->SetURL(Url);
+    Req->SetVerb(TEXT("GET"));
+    for (const FQuickHttpHeader& H : Headers)
+    {
+        Req->SetHeader(H.Name, H.Value);
+    }
+
+    // Byte offsets refer to the stored representation, so ask for it uncompressed
+    Req->SetHeader(TEXT("Accept-Encoding"), TEXT("identity"));
+    Req->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=%lld-%lld"), Offset, Offset + ChunkSize - 1));
+    if (Offset > 0 && !Validator.IsEmpty())
+    {
+        // A changed file comes back whole (200) instead of as a range of the new version
+        Req->SetHeader(TEXT("If-Range"), Validator);
+    }
+
+    TWeakObjectPtr<UHttpDownloadAsync> WeakThis(this);
+    TWeakPtr<IHttpRequest, ESPMode::NotThreadSafe> WeakReq = Req;
+    CancelTimeout();
+    TimeoutHandle = FQuickHttpModule::Get().GetTimerWheel().Schedule(TimeoutSeconds, [WeakThis, WeakReq]()
+    {
+        UHttpDownloadAsync* Node = WeakThis.Get();
+        if (!Node) { return; }
+        Node->TimeoutHandle.Invalidate();
+        if (auto Locked = WeakReq.Pin())
+        {
+            Locked->CancelRequest();
+        }
+    });
+
+#if QUICKHTTP_HAS_PROGRESS64
+    Req->OnRequestProgress64().BindWeakLambda(this, [this](FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
+#else
+    Req->OnRequestProgress().BindWeakLambda(this, [this](FHttpRequestPtr Request, int32 BytesSent, int32 BytesReceived)
+#endif
+    {
+        ReportProgress(Offset + (int64)BytesReceived, false);
+    });
+    Req->OnProcessRequestComplete().BindUObject(this, &UHttpDownloadAsync::HandleResponse);
+    Req->ProcessRequest();
+}
+
+void UHttpDownloadAsync::HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+    ActiveRequest.Reset();
+    CancelTimeout();
+    ReleaseSlot();
+    if (bCancelled || bFinished) { return; }
+
+    const int32 Status = Response.IsValid() ? Response->GetResponseCode() : 0;
+    if (!bSucceeded || !Response.IsValid())
+    {
+        RetryOrFail(Status, TEXT("Network failure or timeout"));
+        return;
+    }
+
+    int64 First = -1;
+    int64 Total = -1;
+    const bool bHasRange = QuickHttpDownload::ParseContentRange(Response->GetHeader(TEXT("Content-Range")), First, Total);
+
+    if (Status == 416)
+    {
+        // Asked past the end: done if the partial file already holds the whole thing, else start over
+        if (Offset > 0 && bHasRange && Total == Offset)
+        {
+            TotalBytes = Total;
+            FinishOnWorker(Status);
+            return;
+        }
+        // An empty resource cannot satisfy any range (bytes */0)
+        if (bHasRange && Total == 0)
+        {
+            TotalBytes = 0;
+            WriteOnWorker(TArray<uint8>(), true, true, FString());
+            return;
+        }
+        // Nothing to throw away from offset 0, so a repeat 416 goes through the retry limit instead of looping
+        if (Offset == 0)
+        {
+            RetryOrFail(Status, TEXT("Range not satisfiable"));
+            return;
+        }
+        WriteOnWorker(TArray<uint8>(), true, false, FString());
+        return;
+    }
+    if (Status >= 500)
+    {
+        RetryOrFail(Status, TEXT("HTTP error"));
+        return;
+    }
+    if (Status < 200 || Status >= 300)
+    {
+        Finish(FString(), TEXT("HTTP error"), Status);
+        return;
+    }
+
+    TArray<uint8> Chunk = Response->GetContent();
+    if (Status == 206)
+    {
+        if (!bHasRange || First != Offset)
+        {
+            RetryOrFail(Status, TEXT("Server answered with a different range"));
+            return;
+        }
+        const bool bComplete = Total >= 0 ? Offset + Chunk.Num() >= Total : Chunk.Num() < ChunkSize;
+        if (Chunk.Num() == 0 && !bComplete)
+        {
+            RetryOrFail(Status, TEXT("Server sent an empty range"));
+            return;
+        }
+        TotalBytes = Total;
+        FString NewValidator;
+        if (Offset == 0)
+        {
+            Validator = QuickHttpDownload::GetValidator(Response);
+            NewValidator = Validator;
+        }
+        WriteOnWorker(MoveTemp(Chunk), false, bComplete, NewValidator);
+        return;
+    }
+
+    // 200: Range was ignored or If-Range failed, so this is the whole (possibly changed) file
+    TotalBytes = Chunk.Num();
+    Validator = QuickHttpDownload::GetValidator(Response);
+    WriteOnWorker(MoveTemp(Chunk), Offset > 0, true, Validator);
+}
+
+void UHttpDownloadAsync::WriteOnWorker(TArray<uint8>&& Chunk, bool bRestart, bool bComplete, const FString& NewValidator)
+{
+    TSharedPtr<FQuickHttpDownloadSink, ESPMode::ThreadSafe> WorkerSink = Sink;
+    TWeakObjectPtr<UHttpDownloadAsync> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, WorkerSink, Chunk = MoveTemp(Chunk), bRestart, bComplete, NewValidator]()
+    {
+        FString Error;
+        const FString ValidatorPath = QuickHttpDownload::GetValidatorPath(WorkerSink->GetPath());
+        if (bRestart)
+        {
+            WorkerSink->Restart(Error);
+        }
+        if (Error.IsEmpty() && (bRestart || !NewValidator.IsEmpty()))
+        {
+            IFileManager::Get().Delete(*ValidatorPath, false, false, true);
+            if (!NewValidator.IsEmpty())
+            {
+                FFileHelper::SaveStringToFile(NewValidator, *ValidatorPath);
+            }
+        }
+        if (Error.IsEmpty())
+        {
+            WorkerSink->Write(Chunk, Error);
+        }
+
+        const int64 ChunkBytes = Chunk.Num();
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, ChunkBytes, bRestart, bComplete, Error]()
+        {
+            if (UHttpDownloadAsync* Node = WeakThis.Get())
+            {
+                Node->HandleChunkWritten(ChunkBytes, bRestart, bComplete, Error);
+            }
+        });
+    });
+}
+
+void UHttpDownloadAsync::HandleChunkWritten(int64 ChunkBytes, bool bRestart, bool bComplete, const FString& Error)
+{
+    if (bCancelled || bFinished) { return; }
+    if (!Error.IsEmpty())
+    {
+        Finish(FString(), Error, 0);
+        return;
+    }
+
+    Offset = (bRestart ? 0 : Offset) + ChunkBytes;
+    if (ChunkBytes > 0)
+    {
+        // Retries count consecutive failures of one chunk; any progress starts the count over
+        AttemptIndex = 0;
+        LastBackoffSeconds = 0.f;
+    }
+    ReportProgress(Offset, bComplete);
+
+    if (bComplete)
+    {
+        FinishOnWorker(200);
+        return;
+    }
+    Attempt();
+}
+
+void UHttpDownloadAsync::RetryOrFail(int32 StatusCode, const FString& Message)
+{
+    if (AttemptIndex >= MaxRetries)
+    {
+        Finish(FString(), Message, StatusCode);
+        return;
+    }
+
+    const float Delay = FQuickHttpRetryQueue::ComputeBackoffSeconds(BackoffBaseSeconds, AttemptIndex, LastBackoffSeconds);
+    LastBackoffSeconds = Delay;
+    AttemptIndex++;
+
+    TWeakObjectPtr<UHttpDownloadAsync> WeakThis(this);
+    const bool bQueued = FQuickHttpModule::Get().GetRetryQueue().Enqueue(Delay, [WeakThis]()
+    {
+        if (UHttpDownloadAsync* Node = WeakThis.Get())
+        {
+            Node->Attempt();
+        }
+    });
+    if (!bQueued)
+    {
+        Finish(FString(), TEXT("Retry queue full"), StatusCode);
+    }
+}
+
+void UHttpDownloadAsync::ReportProgress(int64 Received, bool bForce)
+{
+    if (Received == LastReportedBytes) { return; }
+    const double Now = FPlatformTime::Seconds();
+    if (!bForce && Now - LastProgressSeconds < ProgressIntervalSeconds) { return; }
+    LastProgressSeconds = Now;
+    LastReportedBytes = Received;
+    OnProgress.Broadcast(Received, TotalBytes);
+}
+
+void UHttpDownloadAsync::FinishOnWorker(int32 StatusCode)
+{
+    TSharedPtr<FQuickHttpDownloadSink, ESPMode::ThreadSafe> WorkerSink = Sink;
+    TWeakObjectPtr<UHttpDownloadAsync> WeakThis(this);
+    const FString Expected = ExpectedHash;
+    const FString Target = FilePath;
+    Async(EAsyncExecution::ThreadPool, [WeakThis, WorkerSink, Expected, Target, StatusCode]()
+    {
+        const FString Hash = WorkerSink->Close();
+        const FString& Part = WorkerSink->GetPath();
+        IFileManager& FileManager = IFileManager::Get();
+        FString Error;
+
+        if (!Expected.IsEmpty() && Hash != Expected)
+        {
+            // A corrupt file must not be resumed either
+            Error = FString::Printf(TEXT("Checksum mismatch: expected %s, got %s"), *Expected, *Hash);
+            FileManager.Delete(*Part, false, false, true);
+        }
+        else if (!FileManager.Move(*Target, *Part, true, true))
+        {
+            Error = FString::Printf(TEXT("Could not move the download to %s"), *Target);
+        }
+        if (!FileManager.FileExists(*Part))
+        {
+            FileManager.Delete(*QuickHttpDownload::GetValidatorPath(Part), false, false, true);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Hash, Error, StatusCode]()
+        {
+            if (UHttpDownloadAsync* Node = WeakThis.Get())
+            {
+                if (Node->bCancelled) { return; }
+                Node->Finish(Hash, Error, StatusCode);
+            }
+        });
+    });
+}
+
+void UHttpDownloadAsync::Finish(const FString& Hash, const FString& Error, int32 StatusCode)
+{
+    if (bFinished) { return; }
+    bFinished = true;
+    AbortRequest();
+    Sink.Reset();
+
+    if (Error.IsEmpty())
+    {
+        OnSuccess.Broadcast(FilePath, Hash);
+    }
+    else
+    {
+        FQuickHttpError Err;
+        Err.bIsError = true;
+        Err.StatusCode = StatusCode;
+        Err.Message = Error;
+        OnFailure.Broadcast(Err);
+    }
+    SetReadyToDestroy();
+}
+
+void UHttpDownloadAsync::Cancel()
+{
+    if (bCancelled || bFinished) { return; }
+    bCancelled = true;
+    bFinished = true;
+    AbortRequest();
+    // A write still running on a worker holds its own reference and closes the file when done
+    Sink.Reset();
+
+    FQuickHttpError Err;
+    Err.bIsError = true;
+    Err.Message = TEXT("Cancelled");
+    OnCancelled.Broadcast(Err);
+    SetReadyToDestroy();
+}
+
+void UHttpDownloadAsync::AbortRequest()
+{
+    if (SchedulerTicket != 0 && FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetScheduler().Cancel(SchedulerTicket);
+    }
+    SchedulerTicket = 0;
+    CancelTimeout();
+    if (ActiveRequest.IsValid())
+    {
+        ActiveRequest->OnProcessRequestComplete().Unbind();
+        ActiveRequest->CancelRequest();
+        ActiveRequest.Reset();
+    }
+    ReleaseSlot();
+}
+
+void UHttpDownloadAsync::ReleaseSlot()
+{
+    if (!bHoldsSlot) { return; }
+    bHoldsSlot = false;
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetScheduler().Release(Host);
+    }
+}
+
+void UHttpDownloadAsync::CancelTimeout()
+{
+    if (TimeoutHandle.IsValid() && FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetTimerWheel().Cancel(TimeoutHandle);
+    }
+    TimeoutHandle.Invalidate();
+}
+
+void UHttpDownloadAsync::BeginDestroy()
+{
+    bCancelled = true;
+    AbortRequest();
+    Sink.Reset();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Async/HttpJsonBatchRequestAsync.h"
+#include "Async/HttpJsonRequestAsync.h"
+#include "QuickHttpModule.h"
+
+UHttpJsonBatchRequestAsync* UHttpJsonBatchRequestAsync::HttpJsonBatchRequest(
+    UObject* InWorldContextObject,
+    const TArray<FQuickHttpBatchItem>& InItems,
+    int32 InMaxConcurrency,
+    float InDeadlineSeconds,
+    int32 InCompleteAfterN,
+    int32 InTimeoutSeconds,
+    int32 InMaxRetries,
+    float InBackoffBaseSeconds,
+    int32 InMaxPayloadKB)
+{
+    UHttpJsonBatchRequestAsync* Node = NewObject<UHttpJsonBatchRequestAsync>();
+    Node->WorldContextObject = InWorldContextObject;
+    Node->Items = InItems;
+    Node->MaxConcurrency = FMath::Max(1, InMaxConcurrency);
+    Node->DeadlineSeconds = FMath::Max(0.f, InDeadlineSeconds);
+    Node->CompleteAfterN = FMath::Clamp(InCompleteAfterN, 0, InItems.Num());
+    Node->TimeoutSeconds = InTimeoutSeconds;
+    Node->MaxRetries = InMaxRetries;
+    Node->BackoffBaseSeconds = InBackoffBaseSeconds;
+    Node->MaxPayloadKB = InMaxPayloadKB;
+    return Node;
+}
+
+void UHttpJsonBatchRequestAsync::Activate()
+{
+    Results.SetNum(Items.Num());
+    Finished.Init(false, Items.Num());
+
+    if (Items.Num() == 0)
+    {
+        Complete(FString());
+        return;
+    }
+
+    if (DeadlineSeconds > 0.f)
+    {
+        TWeakObjectPtr<UHttpJsonBatchRequestAsync> WeakThis(this);
+        DeadlineHandle = FQuickHttpModule::Get().GetTimerWheel().Schedule(DeadlineSeconds, [WeakThis]()
+        {
+            if (UHttpJsonBatchRequestAsync* Batch = WeakThis.Get())
+            {
+                Batch->DeadlineHandle.Invalidate();
+                Batch->Complete(TEXT("Batch deadline exceeded"));
+            }
+        });
+    }
+
+    LaunchPending();
+}
+
+void UHttpJsonBatchRequestAsync::LaunchPending()
+{
+    // Items that finish synchronously (e.g. cache hits) re-enter through HandleItemFinished
+    if (bLaunching) { return; }
+    bLaunching = true;
+
+    while (!bDone && Running.Num() < MaxConcurrency && NextIndex < Items.Num())
+    {
+        const int32 Index = NextIndex++;
+        const FQuickHttpBatchItem& Item = Items[Index];
+
+        UHttpJsonRequestAsync* Request = UHttpJsonRequestAsync::HttpJsonRequest(WorldContextObject.Get(), Item.Method, Item.Url,
+            Item.Headers, TimeoutSeconds, MaxRetries, BackoffBaseSeconds, MaxPayloadKB, 0, Item.BodyJson);
+        Request->OnFinishedNative.AddUObject(this, &UHttpJsonBatchRequestAsync::HandleItemFinished);
+        Running.Add(Request);
+        RunningIndex.Add(Request, Index);
+        Request->Activate();
+    }
+
+    bLaunching = false;
+}
+
+void UHttpJsonBatchRequestAsync::HandleItemFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+{
+    int32 Index = INDEX_NONE;
+    if (!RunningIndex.RemoveAndCopyValue(Request, Index)) { return; }
+    Running.Remove(Request);
+    if (bDone) { return; }
+
+    FQuickHttpBatchResult& Result = Results[Index];
+    Result.bSucceeded = !Error.bIsError;
+    Result.StatusCode = StatusCode;
+    Result.ResponseJson = ResponseJson;
+    Result.Error = Error;
+    Finished[Index] = true;
+    ++NumFinished;
+    if (Result.bSucceeded) { ++NumSucceeded; }
+
+    if (CompleteAfterN > 0 && NumSucceeded >= CompleteAfterN)
+    {
+        Complete(TEXT("Skipped: batch completed early"));
+        return;
+    }
+    if (NumFinished == Items.Num())
+    {
+        Complete(FString());
+        return;
+    }
+    LaunchPending();
+}
+
+void UHttpJsonBatchRequestAsync::Complete(const FString& UnfinishedReason)
+{
+    if (bDone) { return; }
+    bDone = true;
+
+    if (DeadlineHandle.IsValid() && FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetTimerWheel().Cancel(DeadlineHandle);
+    }
+
+    // Cancel whatever is still running; cancelled requests never report back
+    TArray<UHttpJsonRequestAsync*> StillRunning = MoveTemp(Running);
+    RunningIndex.Reset();
+    for (UHttpJsonRequestAsync* Request : StillRunning)
+    {
+        if (Request)
+        {
+            Request->OnFinishedNative.RemoveAll(this);
+            Request->Cancel();
+        }
+    }
+
+    for (int32 Index = 0; Index < Results.Num(); ++Index)
+    {
+        if (!Finished[Index])
+        {
+            FQuickHttpBatchResult& Result = Results[Index];
+            Result.bSucceeded = false;
+            Result.Error.bIsError = true;
+            Result.Error.Message = UnfinishedReason;
+        }
+    }
+
+    OnCompleted.Broadcast(Results, NumSucceeded);
+    SetReadyToDestroy();
+}
@@ -1,16 +1,31 @@
 // Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
 
 #include "Async/HttpJsonRequestAsync.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpSettings.h"
+#include "QuickHttpCompat.h"
+#include "QuickHttpRequestKey.h"
+#include "QuickHttpProfile.h"
+#include "Scheduling/QuickHttpSingleFlight.h"
+#include "Scheduling/QuickHttpHedgePolicy.h"
+#include "Scheduling/QuickHttpCircuitBreaker.h"
+#include "Json/QuickJsonStreamWriter.h"
+#include "Json/QuickJsonPath.h"
+#include "Json/QuickJsonBuilder.h"
+#include "Json/QuickBinaryJson.h"
+#include "Json/QuickJsonStruct.h"
+#include "UObject/StructOnScope.h"
+#include "Compression/QuickHttpCompression.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
-#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 #include "Async/Async.h"
+#include "Dom/JsonValue.h"
+#include "Misc/DateTime.h"
 
 #include "Runtime/Launch/Resources/Version.h"
 
-TMap<int32, TSet<TWeakObjectPtr<UHttpJsonRequestAsync>>> UHttpJsonRequestAsync::TokenMap;
-
 UHttpJsonRequestAsync* UHttpJsonRequestAsync::HttpJsonRequest(
     UObject* InWorldContextObject,
     EQuickHttpMethod InMethod,
@@ -27,6 +42,7 @@ UHttpJsonRequestAsync* UHttpJsonRequestAsync::HttpJsonRequest(
     Node->WorldContextObject = InWorldContextObject;
     Node->Method = InMethod;
     Node->Url = InUrl;
+    Node->Host = QuickHttp::GetUrlHost(InUrl);
     Node->Headers = InHeaders;
     Node->TimeoutSeconds = FMath::Max(1, InTimeoutSeconds);
     Node->MaxRetries = FMath::Max(0, InMaxRetries);
@@ -35,177 +51,1201 @@ UHttpJsonRequestAsync* UHttpJsonRequestAsync::HttpJsonRequest(
     Node->CancelToken = InCancelToken;
     Node->BodyJsonOptional = InBodyJsonOptional;
 
-    if (Node->CancelToken != 0)
+    // Every node is tracked (token 0 = ungrouped) so Cancel All Requests and shutdown can reach it
+    FQuickHttpModule::Get().GetCancelRegistry().Register(Node->CancelToken, Node);
+    Node->bRegistered = true;
+    return Node;
+}
+
+UHttpJsonRequestAsync* UHttpJsonRequestAsync::HttpJsonRequestWithOptions(
+    UObject* InWorldContextObject,
+    EQuickHttpMethod InMethod,
+    const FString& InUrl,
+    const TArray<FQuickHttpHeader>& InHeaders,
+    int32 InTimeoutSeconds,
+    int32 InMaxRetries,
+    float InBackoffBaseSeconds,
+    int32 InMaxPayloadKB,
+    int32 InCancelToken,
+    const FString& InBodyJsonOptional,
+    const FQuickHttpRequestOptions& InOptions)
+{
+    UHttpJsonRequestAsync* Node = HttpJsonRequest(InWorldContextObject, InMethod, InUrl, InHeaders, InTimeoutSeconds,
+        InMaxRetries, InBackoffBaseSeconds, InMaxPayloadKB, InCancelToken, InBodyJsonOptional);
+    Node->Options = InOptions;
+
+    // Snapshot the builder or streamed body; the node must not keep the (untracked) object pointers
+    if (UQuickJsonBuilder* Builder = Node->Options.BodyBuilder)
+    {
+        Builder->WriteBytes(Node->Options.BodyFormat, Node->BodyBytes);
+        Node->bBodyEncoded = true;
+    }
+    else if (UQuickJsonStreamWriter* Writer = Node->Options.BodyWriter)
+    {
+        if (Writer->IsComplete(Node->BodyError))
+        {
+            Node->BodyBytes = Writer->GetWriter().GetBytes();
+        }
+        else
+        {
+            Node->BodyError = FString::Printf(TEXT("Invalid body: %s"), *Node->BodyError);
+        }
+    }
+    Node->ResponseStruct = Node->Options.ResponseStruct;
+    Node->Options.BodyBuilder = nullptr;
+    Node->Options.BodyWriter = nullptr;
+    Node->Options.ResponseStruct = nullptr;
+    return Node;
+}
+
+UHttpJsonRequestAsync* UHttpJsonRequestAsync::HttpProfileRequest(
+    UObject* InWorldContextObject,
+    UQuickHttpProfile* InProfile,
+    EQuickHttpMethod InMethod,
+    const FString& InPath,
+    const TArray<FQuickHttpHeader>& InHeaders,
+    const FString& InBodyJsonOptional,
+    int32 InCancelToken,
+    const FQuickHttpRequestOptions& InOptions,
+    int32 InTimeoutSeconds,
+    int32 InMaxRetries)
+{
+    if (!InProfile)
+    {
+        UHttpJsonRequestAsync* Node = HttpJsonRequestWithOptions(InWorldContextObject, InMethod, InPath, InHeaders, 30, 0,
+            0.35f, 1024, InCancelToken, InBodyJsonOptional, InOptions);
+        Node->BodyError = TEXT("No request profile given");
+        return Node;
+    }
+
+    UHttpJsonRequestAsync* Node = HttpJsonRequestWithOptions(InWorldContextObject, InMethod, InProfile->ResolveUrl(InPath), InHeaders,
+        InTimeoutSeconds > 0 ? InTimeoutSeconds : InProfile->GetTimeoutSeconds(),
+        InMaxRetries >= 0 ? InMaxRetries : InProfile->GetMaxRetries(),
+        InProfile->GetBackoffBaseSeconds(), InProfile->GetMaxPayloadKB(), InCancelToken, InBodyJsonOptional, InOptions);
+    Node->Profile = InProfile;
+    return Node;
+}
+
+UHttpJsonRequestAsync* UHttpJsonRequestAsync::HttpStructRequest(
+    UObject* InWorldContextObject,
+    EQuickHttpMethod InMethod,
+    const FString& InUrl,
+    UScriptStruct* InResponseType,
+    UQuickJsonStreamWriter* InBody,
+    const TArray<FQuickHttpHeader>& InHeaders,
+    int32 InCancelToken,
+    const FQuickHttpRequestOptions& InOptions,
+    int32 InTimeoutSeconds,
+    int32 InMaxRetries)
+{
+    FQuickHttpRequestOptions StructOptions = InOptions;
+    StructOptions.ResponseStruct = InResponseType;
+    if (InBody)
+    {
+        StructOptions.BodyWriter = InBody;
+        StructOptions.BodyBuilder = nullptr;
+    }
+    UHttpJsonRequestAsync* Node = HttpJsonRequestWithOptions(InWorldContextObject, InMethod, InUrl, InHeaders, InTimeoutSeconds,
+        InMaxRetries, 0.35f, 1024, InCancelToken, FString(), StructOptions);
+    if (!InResponseType)
     {
-        TokenMap.FindOrAdd(Node->CancelToken).Add(Node);
+        Node->BodyError = TEXT("No response struct type given");
     }
     return Node;
 }
 
 void UHttpJsonRequestAsync::CancelByToken(int32 InCancelToken)
 {
-    if (TSet<TWeakObjectPtr<UHttpJsonRequestAsync>>* SetPtr = TokenMap.Find(InCancelToken))
+    if (InCancelToken == 0 || !FQuickHttpModule::IsAvailable()) { return; }
+    if (!IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::GameThread, [InCancelToken]() { CancelByToken(InCancelToken); });
+        return;
+    }
+    CancelNodes(FQuickHttpModule::Get().GetCancelRegistry().TakeGroup(InCancelToken), TEXT("Cancelled"), false);
+}
+
+void UHttpJsonRequestAsync::CancelAllRequests()
+{
+    CancelAllWithReason(TEXT("Cancelled"));
+}
+
+void UHttpJsonRequestAsync::CancelAllWithReason(const FString& Reason)
+{
+    if (!FQuickHttpModule::IsAvailable()) { return; }
+    if (!IsInGameThread())
+    {
+        AsyncTask(ENamedThreads::GameThread, [Reason]() { CancelAllWithReason(Reason); });
+        return;
+    }
+    CancelNodes(FQuickHttpModule::Get().GetCancelRegistry().TakeAll(), Reason, false);
+}
+
+bool UHttpJsonRequestAsync::LinkCancelTokenGroup(int32 ChildToken, int32 ParentToken)
+{
+    return FQuickHttpModule::Get().GetCancelRegistry().LinkGroup(ChildToken, ParentToken);
+}
+
+void UHttpJsonRequestAsync::UnlinkCancelTokenGroup(int32 ChildToken)
+{
+    FQuickHttpModule::Get().GetCancelRegistry().UnlinkGroup(ChildToken);
+}
+
+void UHttpJsonRequestAsync::SetCancelTokenDeadline(int32 InCancelToken, float DeadlineSeconds)
+{
+    if (InCancelToken == 0) { return; }
+    FQuickHttpCancelRegistry& Registry = FQuickHttpModule::Get().GetCancelRegistry();
+    if (DeadlineSeconds <= 0.f)
     {
-        for (TWeakObjectPtr<UHttpJsonRequestAsync> WeakNode : *SetPtr)
+        Registry.SetDeadline(InCancelToken, 0.0);
+        return;
+    }
+
+    const double Deadline = FPlatformTime::Seconds() + DeadlineSeconds;
+    Registry.SetDeadline(InCancelToken, Deadline);
+    FQuickHttpModule::Get().GetTimerWheel().Schedule(DeadlineSeconds, [InCancelToken, Deadline]()
+    {
+        // Ignore timers whose deadline was replaced, cleared or already consumed by a cancel
+        FQuickHttpCancelRegistry& Groups = FQuickHttpModule::Get().GetCancelRegistry();
+        if (Groups.GetDeadline(InCancelToken) != Deadline) { return; }
+        CancelNodes(Groups.TakeGroup(InCancelToken), TEXT("Deadline exceeded"), true);
+    });
+}
+
+void UHttpJsonRequestAsync::CancelNodes(const TArray<TWeakObjectPtr<UHttpJsonRequestAsync>>& Nodes, const FString& Reason, bool bAsFailure)
+{
+    for (const TWeakObjectPtr<UHttpJsonRequestAsync>& WeakNode : Nodes)
+    {
+        if (UHttpJsonRequestAsync* Node = WeakNode.Get())
         {
-            if (UHttpJsonRequestAsync* Node = WeakNode.Get())
-            {
-                if (Node->ActiveRequest.IsValid())
-                {
-                    Node->ActiveRequest->CancelRequest();
-                }
-                Node->bCompleted = true;
-            }
+            Node->CancelWithReason(Reason, bAsFailure);
         }
-        TokenMap.Remove(InCancelToken);
     }
 }
 
+void UHttpJsonRequestAsync::CancelWithReason(const FString& Reason, bool bAsFailure)
+{
+    // Already taken out of the registry by the caller
+    bRegistered = false;
+    if (bCancelled || bFlightMuted) { return; }
+    if (!LeaveFlight())
+    {
+        AbortLocally();
+    }
+
+    if (bAsFailure)
+    {
+        RecordCompletion(false);
+    }
+    FQuickHttpError Err; Err.bIsError = true; Err.Message = Reason;
+    OnFinishedNative.Broadcast(this, FString(), 0, Err);
+    if (bAsFailure)
+    {
+        OnFailure.Broadcast(Err);
+    }
+    else
+    {
+        OnCancelled.Broadcast(Err);
+    }
+    // A muted flight leader keeps running for its followers and cleans itself up when done
+    if (!bFlightMuted)
+    {
+        SetReadyToDestroy();
+    }
+}
+
+int32 UHttpJsonRequestAsync::GetQueuedRetryCount()
+{
+    return FQuickHttpModule::IsAvailable() ? FQuickHttpModule::Get().GetRetryQueue().Num() : 0;
+}
+
+int32 UHttpJsonRequestAsync::GetQueuedRequestCount()
+{
+    return FQuickHttpModule::IsAvailable() ? FQuickHttpModule::Get().GetScheduler().NumQueued() : 0;
+}
+
+void UHttpJsonRequestAsync::Cancel()
+{
+    if (bCancelled) { return; }
+    UnregisterToken();
+    if (!LeaveFlight())
+    {
+        AbortLocally();
+    }
+    SetReadyToDestroy();
+}
+
 void UHttpJsonRequestAsync::Activate()
 {
+    if (bCancelled) { return; }
     AttemptIndex = 0;
+    ActivatedAtSeconds = FPlatformTime::Seconds();
+
+    PrepareBody();
+    if (!BodyError.IsEmpty())
+    {
+        FinishFailure(0, BodyError, FString());
+        return;
+    }
+
+    if (UsesCache() || UsesSingleFlight())
+    {
+        const TArray<FQuickHttpHeader> AllHeaders = Profile ? Profile->MergeHeaders(Headers) : Headers;
+        // A profile may send its token in a custom header; that one is a credential too
+        const FString AuthHeaderName = Profile ? Profile->GetAuthHeaderName() : FString();
+        RequestKey = QuickHttp::MakeRequestKey(Method, Url, AllHeaders, AuthHeaderName);
+        // Followers get the leader's response as is: only requests that ask for the same format (Accept) under
+        // the same size cap may share it. Delivery options (raw bytes, parsing, paths, struct) apply per node.
+        RequestKey += FString::Printf(TEXT("\n#accept:%d\n#max-kb:%d"), (int32)Options.ResponseFormat, MaxPayloadKB);
+        CacheKey = QuickHttp::MakeCacheKey(Method, Url, AllHeaders, AuthHeaderName);
+        bHasCredentials = QuickHttp::HasCredentialHeader(AllHeaders, AuthHeaderName);
+    }
+
+    if (UsesCache())
+    {
+        if (FQuickHttpModule::Get().GetResponseCache().Lookup(CacheKey, CachedEntry) == EQuickHttpCacheLookup::Fresh)
+        {
+            FinishSuccessBody(CachedEntry->Body, CachedEntry->StatusCode, FQuickBinaryJson::FormatFromContentType(CachedEntry->ContentType));
+            return;
+        }
+    }
+
+    if (UsesSingleFlight())
+    {
+        bFlightLeader = FQuickHttpModule::Get().GetSingleFlight().JoinOrLead(RequestKey, this);
+        bInFlight = true;
+        if (!bFlightLeader)
+        {
+            // An identical GET is already in flight; its leader delivers the result to this node too
+            return;
+        }
+    }
+
     Attempt();
 }
 
 void UHttpJsonRequestAsync::Attempt()
 {
-    if (bCompleted) { return; }
+    if (bCancelled) { return; }
+
+    // Fail fast while the host's breaker is open instead of adding to its load
+    if (!FQuickHttpModule::Get().GetCircuitBreaker().Allow(Host))
+    {
+        FinishFailure(0, TEXT("Circuit open"), FString());
+        return;
+    }
+
+    // Wait for a per-host / global slot before touching the network
+    QueuedAtSeconds = FPlatformTime::Seconds();
+    TWeakObjectPtr<UHttpJsonRequestAsync> WeakThis(this);
+    const FString SlotHost = Host;
+    const uint64 Ticket = FQuickHttpModule::Get().GetScheduler().Acquire(Host, Options.Priority, [WeakThis, SlotHost]()
+    {
+        UHttpJsonRequestAsync* Node = WeakThis.Get();
+        if (!Node || Node->bCancelled)
+        {
+            // Nobody to run; hand the slot straight back
+            FQuickHttpModule::Get().GetScheduler().Release(SlotHost);
+            return;
+        }
+        Node->StartAttempt();
+    });
+
+    // Start may already have run (and cleared the ticket); only a queued request keeps one for Cancel
+    if (Ticket != 0) { SchedulerTicket = Ticket; }
+}
+
+void UHttpJsonRequestAsync::StartAttempt()
+{
+    const double Now = FPlatformTime::Seconds();
+    bHoldsSlot = true;
+    SchedulerTicket = 0;
+    Stats.QueueWaitSeconds += (float)(Now - QueuedAtSeconds);
+    Stats.Attempts++;
+    AttemptStartSeconds = Now;
+    FirstByteAtSeconds = 0.0;
+
+    TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> Req = CreateAttemptRequest();
+    ActiveRequest = Req;
+    bActiveIsHedge = false;
+
+    // Timeout watchdog on the module's shared timer wheel; a weak capture so a GC'd node is ignored.
+    // It covers the hedge too, which may have become the active request by the time it fires.
+    TWeakObjectPtr<UHttpJsonRequestAsync> WeakThis(this);
+    bCompleted = false;
+    CancelTimeout();
+    TimeoutHandle = FQuickHttpModule::Get().GetTimerWheel().Schedule(TimeoutSeconds, [WeakThis]()
+    {
+        UHttpJsonRequestAsync* Node = WeakThis.Get();
+        if (!Node || Node->bCompleted) { return; }
+        Node->TimeoutHandle.Invalidate();
+        if (Node->HedgeRequest.IsValid())
+        {
+            Node->HedgeRequest->CancelRequest();
+        }
+        if (Node->ActiveRequest.IsValid())
+        {
+            Node->ActiveRequest->CancelRequest();
+        }
+    });
 
+    bPayloadTooLarge = false;
+    Req->ProcessRequest();
+
+    if (UsesHedging())
+    {
+        ScheduleHedge();
+    }
+}
+
+TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> UHttpJsonRequestAsync::CreateAttemptRequest()
+{
     FHttpModule& Http = FHttpModule::Get();
     TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> Req = Http.CreateRequest();
-    ActiveRequest = Req;
 
     Req->SetURL(Url);
-    switch (Method)
+    Req->SetVerb(QuickHttp::MethodToVerb(Method));
+
+    // Binary formats still accept JSON, so servers that do not support them keep working
+    Req->SetHeader(TEXT("Accept"), Options.ResponseFormat == EQuickHttpBodyFormat::Json
+        ? FString(TEXT("application/json"))
+        : FString::Printf(TEXT("%s, application/json;q=0.5"), FQuickBinaryJson::GetContentType(Options.ResponseFormat)));
+    if (Profile)
     {
-        case EQuickHttpMethod::GET:     Req->SetVerb(TEXT("GET")); break;
-        case EQuickHttpMethod::POST:    Req->SetVerb(TEXT("POST")); break;
-        case EQuickHttpMethod::PUT:     Req->SetVerb(TEXT("PUT")); break;
-        case EQuickHttpMethod::PATCH:   Req->SetVerb(TEXT("PATCH")); break;
-        case EQuickHttpMethod::DELETE_: Req->SetVerb(TEXT("DELETE")); break;
+        // Profile headers first so the call's own headers replace them; the token is read per attempt
+        for (const FQuickHttpHeader& H : Profile->GetHeaders())
+        {
+            Req->SetHeader(H.Name, H.Value);
+        }
+        const FString Auth = Profile->GetAuthHeaderValue();
+        if (!Auth.IsEmpty())
+        {
+            Req->SetHeader(Profile->GetAuthHeaderName(), Auth);
+        }
     }
-
-    Req->SetHeader(TEXT("Accept"), TEXT("application/json"));
     for (const FQuickHttpHeader& H : Headers)
     {
         Req->SetHeader(H.Name, H.Value);
     }
+    if (GetDefault<UQuickHttpSettings>()->bAcceptCompressedResponses && Req->GetHeader(TEXT("Accept-Encoding")).IsEmpty())
+    {
+        Req->SetHeader(TEXT("Accept-Encoding"), FQuickHttpCompression::GetAcceptEncoding());
+    }
 
-    if (!BodyJsonOptional.IsEmpty() && Req->GetVerb() != TEXT("GET"))
+    if (CachedEntry.IsValid())
     {
-        Req->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-        Req->SetContentAsString(BodyJsonOptional);
+        // Stale entry: ask the server to confirm it instead of resending the body
+        if (!CachedEntry->ETag.IsEmpty() && Req->GetHeader(TEXT("If-None-Match")).IsEmpty())
+        {
+            Req->SetHeader(TEXT("If-None-Match"), CachedEntry->ETag);
+        }
+        if (!CachedEntry->LastModified.IsEmpty() && Req->GetHeader(TEXT("If-Modified-Since")).IsEmpty())
+        {
+            Req->SetHeader(TEXT("If-Modified-Since"), CachedEntry->LastModified);
+        }
     }
 
-    // Manual timeout watchdog (UE4.25-safe)
-    TWeakPtr<IHttpRequest, ESPMode::NotThreadSafe> WeakReq = Req;
-    const int32 LocalTimeout = TimeoutSeconds;
-    bCompleted = false;
-    Async(EAsyncExecution::ThreadPool, [this, WeakReq, LocalTimeout](){
-        float Elapsed = 0.f;
-        const float Step = 0.05f;
-        while (!bCompleted && Elapsed < LocalTimeout)
+    if (BodyBytes.Num() > 0 && Method != EQuickHttpMethod::GET)
+    {
+        // A Content-Type from the call (e.g. application/x-ndjson) describes the body better than the format default
+        if (Req->GetHeader(TEXT("Content-Type")).IsEmpty())
         {
-            FPlatformProcess::Sleep(Step);
-            Elapsed += Step;
+            Req->SetHeader(TEXT("Content-Type"), FQuickBinaryJson::GetContentType(Options.BodyFormat));
         }
-        if (!bCompleted)
+        if (bBodyGzipped)
         {
-            if (auto Locked = WeakReq.Pin())
-            {
-                Locked->CancelRequest();
-            }
+            Req->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+        }
+        Req->SetContent(BodyBytes);
+    }
+
+    // Enforce MaxPayloadKB while the body streams in rather than after it is fully buffered
+    Req->OnHeaderReceived().BindWeakLambda(this, [this](FHttpRequestPtr Request, const FString& HeaderName, const FString& HeaderValue)
+    {
+        if (FirstByteAtSeconds == 0.0) { FirstByteAtSeconds = FPlatformTime::Seconds(); }
+        if (HeaderName.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+        {
+            AbortIfPayloadTooLarge(Request, FCString::Atoi64(*HeaderValue));
         }
     });
+#if QUICKHTTP_HAS_PROGRESS64
+    Req->OnRequestProgress64().BindWeakLambda(this, [this](FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
+#else
+    Req->OnRequestProgress().BindWeakLambda(this, [this](FHttpRequestPtr Request, int32 BytesSent, int32 BytesReceived)
+#endif
+    {
+        if (FirstByteAtSeconds == 0.0 && BytesReceived > 0) { FirstByteAtSeconds = FPlatformTime::Seconds(); }
+        AbortIfPayloadTooLarge(Request, (int64)BytesReceived);
+    });
+
+    Req->OnProcessRequestComplete().BindUObject(this, &UHttpJsonRequestAsync::HandleResponse);
+    return Req;
+}
 
-    Req->OnProcessRequestComplete().BindWeakLambda(this, [this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+void UHttpJsonRequestAsync::AbortIfPayloadTooLarge(FHttpRequestPtr Request, int64 NumBytes)
+{
+    if (bCompleted || bPayloadTooLarge || NumBytes <= (int64)MaxPayloadKB * 1024) { return; }
+    bPayloadTooLarge = true;
+    // A racing hedge (or the request it races) would receive the same oversized body; cancel it first so
+    // that, should it report back right away, Request is left to fail the attempt
+    if (HedgeRequest.IsValid())
+    {
+        (Request.Get() == HedgeRequest.Get() ? ActiveRequest : HedgeRequest)->CancelRequest();
+    }
+    if (Request.IsValid())
     {
-        if (bCompleted) { return; }
-        bCompleted = true;
+        Request->CancelRequest();
+    }
+}
+
+bool UHttpJsonRequestAsync::UsesHedging() const
+{
+    // Only verbs that are safe to send twice
+    return Options.bHedge && (Method == EQuickHttpMethod::GET || Method == EQuickHttpMethod::PUT || Method == EQuickHttpMethod::DELETE_);
+}
+
+void UHttpJsonRequestAsync::ScheduleHedge()
+{
+    if (bCompleted) { return; }
+    FQuickHttpHedgePolicy& Policy = FQuickHttpModule::Get().GetHedgePolicy();
+    Policy.NoteAttempt(Host);
 
-        const int32 Status = Response.IsValid() ? Response->GetResponseCode() : 0;
-        const FString Body = Response.IsValid() ? Response->GetContentAsString() : FString();
+    // A hedge that could only go out at the deadline would not help
+    const float Delay = Policy.GetHedgeDelay(Host, Options.HedgeDelaySeconds);
+    if (Delay >= TimeoutSeconds) { return; }
 
-        if (!bSucceeded || !Response.IsValid())
+    TWeakObjectPtr<UHttpJsonRequestAsync> WeakThis(this);
+    HedgeTimerHandle = FQuickHttpModule::Get().GetTimerWheel().Schedule(Delay, [WeakThis]()
+    {
+        if (UHttpJsonRequestAsync* Node = WeakThis.Get())
         {
-            if (AttemptIndex < MaxRetries)
-            {
-                const float Delay = ComputeBackoffSeconds(AttemptIndex);
-                AttemptIndex++;
-                ScheduleRetry(Delay);
-                return;
-            }
-            FinishFailure(Status, TEXT("Network failure or timeout"), Body);
-            return;
+            Node->HedgeTimerHandle.Invalidate();
+            Node->SendHedge();
         }
+    });
+}
+
+void UHttpJsonRequestAsync::SendHedge()
+{
+    if (bCompleted || bCancelled || HedgeRequest.IsValid()) { return; }
+
+    // A hedge never waits for a slot or goes over the host's budget; the attempt just carries on alone
+    FQuickHttpModule& Module = FQuickHttpModule::Get();
+    if (!Module.GetScheduler().TryAcquire(Host)) { return; }
+    if (!Module.GetHedgePolicy().TryConsumeBudget(Host))
+    {
+        Module.GetScheduler().Release(Host);
+        return;
+    }
+    bHoldsHedgeSlot = true;
+    Stats.Hedges++;
+
+    HedgeRequest = CreateAttemptRequest();
+    HedgeRequest->ProcessRequest();
+}
 
-        if (Body.Len() / 1024 > MaxPayloadKB)
+bool UHttpJsonRequestAsync::SettleHedgeRace(FHttpRequestPtr Request, bool bUsable)
+{
+    const bool bFromHedge = Request.Get() == HedgeRequest.Get();
+    if (!bUsable)
+    {
+        // A failure only counts once both have failed; until then the other request may still answer
+        if (bFromHedge)
+        {
+            DropHedge();
+        }
+        else
+        {
+            ActiveRequest = HedgeRequest;
+            bActiveIsHedge = true;
+            DropHedge();
+        }
+        return true;
+    }
+
+    // First usable response wins; the other request is cancelled without reporting back
+    TSharedPtr<IHttpRequest, ESPMode::NotThreadSafe> Loser = bFromHedge ? ActiveRequest : HedgeRequest;
+    if (Loser.IsValid())
+    {
+        Loser->OnProcessRequestComplete().Unbind();
+        Loser->CancelRequest();
+    }
+    if (bFromHedge)
+    {
+        ActiveRequest = HedgeRequest;
+        bActiveIsHedge = true;
+    }
+    DropHedge();
+    return false;
+}
+
+void UHttpJsonRequestAsync::DropHedge()
+{
+    // Both requests of a race hold a slot on the same host; one of them is handed back here
+    if (bHoldsHedgeSlot)
+    {
+        bHoldsHedgeSlot = false;
+        if (FQuickHttpModule::IsAvailable())
+        {
+            FQuickHttpModule::Get().GetScheduler().Release(Host);
+        }
+    }
+    HedgeRequest.Reset();
+}
+
+void UHttpJsonRequestAsync::PrepareBody()
+{
+    if (Method == EQuickHttpMethod::GET) { return; }
+
+    if (BodyBytes.Num() == 0 && !BodyJsonOptional.IsEmpty())
+    {
+        // Encode the string body once here instead of on every attempt
+        FTCHARToUTF8 Utf8(*BodyJsonOptional);
+        BodyBytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+    }
+
+    if (Options.BodyFormat != EQuickHttpBodyFormat::Json && !bBodyEncoded && BodyBytes.Num() > 0)
+    {
+        // JSON text bodies are converted once here; a builder body was already encoded directly
+        const double Start = FPlatformTime::Seconds();
+        TSharedPtr<FJsonValue> Value;
+        FString Error;
+        if (!FQuickBinaryJson::Decode(BodyBytes, EQuickHttpBodyFormat::Json, Value, Error))
         {
-            FinishFailure(Status, TEXT("Payload too large"), Body);
+            BodyError = FString::Printf(TEXT("Invalid body: %s"), *Error);
             return;
         }
+        BodyBytes.Reset();
+        FQuickBinaryJson::Encode(Value, Options.BodyFormat, BodyBytes);
+        Stats.CodecSeconds += (float)(FPlatformTime::Seconds() - Start);
+    }
+    bBodyEncoded = true;
+    Stats.RequestBytes = BodyBytes.Num();
+
+    if (Options.bCompressRequestBody && BodyBytes.Num() > 0 && BodyBytes.Num() >= Options.CompressBodyThresholdBytes)
+    {
+        const double Start = FPlatformTime::Seconds();
+        TArray<uint8> Compressed;
+        // Incompressible bodies are sent as they are
+        if (FQuickHttpCompression::GzipCompress(BodyBytes, Compressed) && Compressed.Num() < BodyBytes.Num())
+        {
+            BodyBytes = MoveTemp(Compressed);
+            bBodyGzipped = true;
+        }
+        Stats.CodecSeconds += (float)(FPlatformTime::Seconds() - Start);
+    }
+    Stats.RequestBytesSent = BodyBytes.Num();
+}
 
-        if (Status < 200 || Status >= 300)
+void UHttpJsonRequestAsync::DecodeOnWorker(FHttpResponsePtr Response, const FString& Encoding, float RetryAfterSeconds)
+{
+    // Inflating up to MaxPayloadKB would hitch the frame; the response is handled on the game thread once decoded.
+    // MaxPayloadKB applies to the decoded size too, so a small compressed body cannot expand without bound.
+    TWeakObjectPtr<UHttpJsonRequestAsync> WeakThis(this);
+    const int64 MaxBytes = (int64)MaxPayloadKB * 1024;
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Response, Encoding, MaxBytes, RetryAfterSeconds]()
+    {
+        const double Start = FPlatformTime::Seconds();
+        TArray<uint8> Decoded;
+        const EQuickHttpDecodeResult Result = FQuickHttpCompression::Decode(Encoding, Response->GetContent(), MaxBytes, Decoded);
+        const float CodecSeconds = (float)(FPlatformTime::Seconds() - Start);
+
+        FString Error;
+        switch (Result)
+        {
+        case EQuickHttpDecodeResult::Identity:
+        case EQuickHttpDecodeResult::Decoded:
+            break;
+        case EQuickHttpDecodeResult::TooLarge:
+            Error = TEXT("Payload too large");
+            break;
+        case EQuickHttpDecodeResult::Corrupt:
+            Error = FString::Printf(TEXT("Corrupt %s response body"), *Encoding);
+            break;
+        default:
+            Error = FString::Printf(TEXT("Unsupported Content-Encoding: %s"), *Encoding);
+            break;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Response, RetryAfterSeconds, CodecSeconds,
+            bDecoded = Result == EQuickHttpDecodeResult::Decoded, Decoded = MoveTemp(Decoded), Error = MoveTemp(Error)]()
         {
-            if (Status >= 500 && AttemptIndex < MaxRetries)
+            UHttpJsonRequestAsync* Node = WeakThis.Get();
+            if (!Node || Node->bCancelled) { return; }
+            Node->Stats.CodecSeconds += CodecSeconds;
+            if (!Error.IsEmpty())
+            {
+                Node->FinishFailure(Response->GetResponseCode(), Error, FString());
+                return;
+            }
+            if (bDecoded)
             {
-                const float Delay = ComputeBackoffSeconds(AttemptIndex);
-                AttemptIndex++;
-                ScheduleRetry(Delay);
+                Node->Stats.ResponseBytesDecoded = Decoded.Num();
+                Node->HandleResponseBody(Response, Decoded, RetryAfterSeconds);
                 return;
             }
-            FinishFailure(Status, TEXT("HTTP error"), Body);
+            Node->HandleResponseBody(Response, Response->GetContent(), RetryAfterSeconds);
+        });
+    });
+}
+
+/** Error body text for FQuickHttpError::RawBody; binary bodies are shown as JSON when they decode. */
+static FString ResponseBodyToString(const TArray<uint8>& Body, EQuickHttpBodyFormat Format)
+{
+    if (Format == EQuickHttpBodyFormat::Json) { return QuickHttp::Utf8BytesToString(Body); }
+    TSharedPtr<FJsonValue> Value;
+    FString Error;
+    TArray<uint8> Json;
+    if (FQuickBinaryJson::Decode(Body, Format, Value, Error))
+    {
+        FQuickBinaryJson::Encode(Value, EQuickHttpBodyFormat::Json, Json);
+    }
+    return QuickHttp::Utf8BytesToString(Json);
+}
+
+void UHttpJsonRequestAsync::HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+    if (HedgeRequest.IsValid() && !bCompleted)
+    {
+        const bool bUsable = bSucceeded && Response.IsValid() && Response->GetResponseCode() < 500;
+        if (SettleHedgeRace(Request, bUsable)) { return; }
+    }
+    ReleaseSlot();
+    if (bCompleted) { return; }
+    bCompleted = true;
+    CancelTimeout();
+
+    if (FirstByteAtSeconds > 0.0)
+    {
+        Stats.TimeToFirstByteSeconds = (float)(FirstByteAtSeconds - AttemptStartSeconds);
+        Stats.DownloadSeconds = (float)(FPlatformTime::Seconds() - FirstByteAtSeconds);
+    }
+
+    const int32 Status = Response.IsValid() ? Response->GetResponseCode() : 0;
+
+    // 429/503 may say how long to stay away; 429 and 5xx count against the host like network failures do
+    const float RetryAfterSeconds = (Status == 429 || Status == 503)
+        ? FQuickHttpCircuitBreaker::ParseRetryAfter(Response->GetHeader(TEXT("Retry-After"))) : -1.f;
+    if (!bPayloadTooLarge)
+    {
+        const bool bHostFailed = !bSucceeded || !Response.IsValid() || Status >= 500 || Status == 429;
+        FQuickHttpModule::Get().GetCircuitBreaker().RecordOutcome(Host, !bHostFailed, RetryAfterSeconds);
+    }
+
+    if (UsesHedging() && bSucceeded && Response.IsValid() && Status < 500)
+    {
+        // Answered attempts feed the adaptive hedge delay (as seen by the caller, from the first send)
+        FQuickHttpModule::Get().GetHedgePolicy().RecordLatency(Host, FPlatformTime::Seconds() - AttemptStartSeconds);
+        Stats.bHedgeWon = bActiveIsHedge;
+    }
+
+    if (bPayloadTooLarge || (Response.IsValid() && Response->GetContent().Num() > (int64)MaxPayloadKB * 1024))
+    {
+        // Never widen an oversized body into an FString just to report it
+        FinishFailure(Status, TEXT("Payload too large"), FString());
+        return;
+    }
+
+    if (!bSucceeded || !Response.IsValid())
+    {
+        RetryOrFail(Status, TEXT("Network failure or timeout"), Response.IsValid() ? Response->GetContentAsString() : FString(), -1.f);
+        return;
+    }
+
+    if (Status == 304 && CachedEntry.IsValid())
+    {
+        int32 MaxAgeSeconds = 0;
+        bool bPublic = false;
+        const bool bStorable = FQuickHttpResponseCache::ParseCacheControl(Response->GetHeader(TEXT("Cache-Control")), MaxAgeSeconds, &bPublic)
+            && (!bHasCredentials || bPublic);
+
+        // The cached body is still valid; it is only kept for later when the server still allows storing it
+        FQuickHttpCacheEntryPtr Renewed = bStorable
+            ? FQuickHttpModule::Get().GetResponseCache().Revalidate(CacheKey, CachedEntry, MaxAgeSeconds, Response->GetHeader(TEXT("ETag")))
+            : CachedEntry;
+        FinishSuccessBody(Renewed->Body, Renewed->StatusCode, FQuickBinaryJson::FormatFromContentType(Renewed->ContentType));
+        return;
+    }
+
+    Stats.ResponseBytesReceived = Response->GetContent().Num();
+    Stats.ResponseBytesDecoded = Stats.ResponseBytesReceived;
+    const FString Encoding = Response->GetHeader(TEXT("Content-Encoding"));
+    if (!Encoding.IsEmpty())
+    {
+        DecodeOnWorker(Response, Encoding, RetryAfterSeconds);
+        return;
+    }
+    HandleResponseBody(Response, Response->GetContent(), RetryAfterSeconds);
+}
+
+void UHttpJsonRequestAsync::HandleResponseBody(FHttpResponsePtr Response, const TArray<uint8>& Content, float RetryAfterSeconds)
+{
+    const int32 Status = Response->GetResponseCode();
+    const EQuickHttpBodyFormat Format = FQuickBinaryJson::FormatFromContentType(Response->GetContentType());
+
+    if (Status < 200 || Status >= 300)
+    {
+        const FString Body = ResponseBodyToString(Content, Format);
+        if (Status >= 500 || Status == 429)
+        {
+            RetryOrFail(Status, TEXT("HTTP error"), Body, RetryAfterSeconds);
             return;
         }
+        FinishFailure(Status, TEXT("HTTP error"), Body);
+        return;
+    }
 
-        FinishSuccess(Body, Status);
-    });
+    if (UsesCache())
+    {
+        StoreInCache(Response, Content);
+    }
 
-    Req->ProcessRequest();
+    FinishSuccessBody(Content, Status, Format);
 }
 
-void UHttpJsonRequestAsync::ScheduleRetry(float DelaySeconds)
+void UHttpJsonRequestAsync::RetryOrFail(int32 StatusCode, const FString& Message, const FString& RawBody, float RetryAfterSeconds)
 {
-    Async(EAsyncExecution::ThreadPool, [this, DelaySeconds](){
-        FPlatformProcess::Sleep(FMath::Max(0.0f, DelaySeconds));
-        AsyncTask(ENamedThreads::GameThread, [this](){
-            Attempt();
-        });
+    if (AttemptIndex >= MaxRetries || RetryAfterSeconds > GetDefault<UQuickHttpSettings>()->MaxRetryAfterSeconds)
+    {
+        // Out of retries, or the server wants a longer pause than a request should sit through
+        FinishFailure(StatusCode, Message, RawBody);
+        return;
+    }
+    if (!FQuickHttpModule::Get().GetCircuitBreaker().TryConsumeRetry(Host))
+    {
+        FinishFailure(StatusCode, TEXT("Retry budget exhausted"), RawBody);
+        return;
+    }
+
+    const float Delay = FMath::Max(ComputeBackoffSeconds(AttemptIndex), RetryAfterSeconds);
+    AttemptIndex++;
+    if (ScheduleRetry(Delay)) { return; }
+    FinishFailure(StatusCode, TEXT("Retry queue full"), RawBody);
+}
+
+bool UHttpJsonRequestAsync::ScheduleRetry(float DelaySeconds)
+{
+    LastBackoffSeconds = DelaySeconds;
+
+    // Wait in the shared deadline queue instead of parking a pool thread
+    TWeakObjectPtr<UHttpJsonRequestAsync> WeakThis(this);
+    return FQuickHttpModule::Get().GetRetryQueue().Enqueue(DelaySeconds, [WeakThis]()
+    {
+        if (UHttpJsonRequestAsync* Node = WeakThis.Get())
+        {
+            Node->Attempt();
+        }
     });
 }
 
+void UHttpJsonRequestAsync::ReleaseSlot()
+{
+    if (!bHoldsSlot) { return; }
+    bHoldsSlot = false;
+    Stats.NetworkSeconds += (float)(FPlatformTime::Seconds() - AttemptStartSeconds);
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetScheduler().Release(Host);
+    }
+}
+
+void UHttpJsonRequestAsync::CancelTimeout()
+{
+    if (FQuickHttpModule::IsAvailable())
+    {
+        if (TimeoutHandle.IsValid())
+        {
+            FQuickHttpModule::Get().GetTimerWheel().Cancel(TimeoutHandle);
+        }
+        if (HedgeTimerHandle.IsValid())
+        {
+            FQuickHttpModule::Get().GetTimerWheel().Cancel(HedgeTimerHandle);
+        }
+    }
+    TimeoutHandle.Invalidate();
+    HedgeTimerHandle.Invalidate();
+}
+
 float UHttpJsonRequestAsync::ComputeBackoffSeconds(int32 Index) const
 {
-    const float Exp = FMath::Pow(2.f, FMath::Clamp(Index, 0, 10));
-    const float Jitter = FMath::FRandRange(0.f, 0.25f);
-    return (BackoffBaseSeconds * Exp) + Jitter;
+    return FQuickHttpRetryQueue::ComputeBackoffSeconds(BackoffBaseSeconds, Index, LastBackoffSeconds);
 }
 
-void UHttpJsonRequestAsync::FinishSuccess(const FString& Response, int32 StatusCode)
+bool UHttpJsonRequestAsync::UsesCache() const
+{
+    return Options.bUseCache && Method == EQuickHttpMethod::GET;
+}
+
+void UHttpJsonRequestAsync::StoreInCache(FHttpResponsePtr Response, const TArray<uint8>& Body)
 {
-    if (CancelToken != 0)
+    FQuickHttpResponseCache& Cache = FQuickHttpModule::Get().GetResponseCache();
+    if (CachedEntry.IsValid())
     {
-        if (TSet<TWeakObjectPtr<UHttpJsonRequestAsync>>* SetPtr = TokenMap.Find(CancelToken))
+        // Stale entry was replaced by a full download
+        Cache.NoteMiss();
+    }
+    if (Response->GetResponseCode() != 200) { return; }
+
+    FQuickHttpCacheEntry Entry;
+    bool bPublic = false;
+    if (!FQuickHttpResponseCache::ParseCacheControl(Response->GetHeader(TEXT("Cache-Control")), Entry.MaxAgeSeconds, &bPublic)) { return; }
+
+    // The cache key leaves credentials out, so only a response the server says anyone may see is shared
+    if (bHasCredentials && !bPublic) { return; }
+    Entry.ETag = Response->GetHeader(TEXT("ETag"));
+    Entry.LastModified = Response->GetHeader(TEXT("Last-Modified"));
+    if (Entry.MaxAgeSeconds <= 0 && !Entry.HasValidator()) { return; }
+
+    Entry.ContentType = Response->GetContentType();
+    Entry.StatusCode = Response->GetResponseCode();
+    Entry.StoredAtUnix = FDateTime::UtcNow().ToUnixTimestamp();
+    Entry.Body = Body;
+    Cache.Store(CacheKey, MoveTemp(Entry));
+}
+
+bool UHttpJsonRequestAsync::UsesSingleFlight() const
+{
+    return Options.bCoalesceIdenticalRequests && Method == EQuickHttpMethod::GET;
+}
+
+bool UHttpJsonRequestAsync::LeaveFlight()
+{
+    if (!bInFlight || !FQuickHttpModule::IsAvailable()) { return false; }
+    FQuickHttpSingleFlight& Flights = FQuickHttpModule::Get().GetSingleFlight();
+
+    if (bFlightLeader)
+    {
+        if (Flights.NumFollowers(RequestKey) == 0)
         {
-            SetPtr->Remove(this);
-            if (SetPtr->Num() == 0) { TokenMap.Remove(CancelToken); }
+            // Nobody else is waiting: cancel the shared request like any other
+            Flights.Complete(RequestKey);
+            bInFlight = false;
+            bFlightLeader = false;
+            return false;
         }
+        // Keep driving the shared request for the remaining followers, but stop reporting to this node
+        bFlightMuted = true;
+        return true;
+    }
+
+    UHttpJsonRequestAsync* Leader = Flights.RemoveFollower(RequestKey, this);
+    bInFlight = false;
+    bCancelled = true;
+    bCompleted = true;
+
+    if (Leader && Leader->bFlightMuted && Flights.NumFollowers(RequestKey) == 0)
+    {
+        // Last waiter went away
+        Flights.Complete(RequestKey);
+        Leader->bInFlight = false;
+        Leader->bFlightLeader = false;
+        Leader->AbortLocally();
+        Leader->SetReadyToDestroy();
     }
+    return true;
+}
+
+TArray<UHttpJsonRequestAsync*> UHttpJsonRequestAsync::TakeFlightFollowers()
+{
+    if (!bInFlight || !bFlightLeader || !FQuickHttpModule::IsAvailable()) { return TArray<UHttpJsonRequestAsync*>(); }
+    bInFlight = false;
+    bFlightLeader = false;
+    return FQuickHttpModule::Get().GetSingleFlight().Complete(RequestKey);
+}
+
+void UHttpJsonRequestAsync::AbortLocally()
+{
+    bCancelled = true;
+    bCompleted = true;
+    CancelTimeout();
+    ReleaseSlot();
+    if (SchedulerTicket != 0 && FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetScheduler().Cancel(SchedulerTicket);
+        SchedulerTicket = 0;
+    }
+    if (ActiveRequest.IsValid())
+    {
+        ActiveRequest->CancelRequest();
+    }
+    if (HedgeRequest.IsValid())
+    {
+        HedgeRequest->CancelRequest();
+        DropHedge();
+    }
+}
+
+void UHttpJsonRequestAsync::FinishSuccessBody(const TArray<uint8>& Body, int32 StatusCode, EQuickHttpBodyFormat Format)
+{
+    for (UHttpJsonRequestAsync* Follower : TakeFlightFollowers())
+    {
+        Follower->bInFlight = false;
+        Follower->bCompleted = true;
+        Follower->FinishSuccessBody(Body, StatusCode, Format);
+    }
+
+    if (bFlightMuted)
+    {
+        UnregisterToken();
+        SetReadyToDestroy();
+        return;
+    }
+    // Binary bodies are always decoded off the game thread, even when only the JSON text is wanted
+    const bool bBinary = Format != EQuickHttpBodyFormat::Json;
+    if (Options.ExtractPaths.Num() > 0 || ((Options.bParseOnWorker || ResponseStruct || bBinary) && !Options.bDeliverRawBytes))
+    {
+        FinishOnWorker(Body, StatusCode, Format);
+        return;
+    }
+    if (Options.bDeliverRawBytes)
+    {
+        FinishSuccessBytes(Body, StatusCode);
+        return;
+    }
+    const double ConvertStart = FPlatformTime::Seconds();
+    const FString Text = QuickHttp::Utf8BytesToString(Body);
+    Stats.ParseSeconds = (float)(FPlatformTime::Seconds() - ConvertStart);
+    FinishSuccess(Text, StatusCode);
+}
+
+void UHttpJsonRequestAsync::UnregisterToken()
+{
+    if (!bRegistered) { return; }
+    bRegistered = false;
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetCancelRegistry().Unregister(CancelToken, this);
+    }
+}
+
+void UHttpJsonRequestAsync::BeginDestroy()
+{
+    // Nodes collected without finishing (never activated, or abandoned) must not linger in the registry
+    UnregisterToken();
+
+    // HandleResponse is bound to this object and will never run once it is collected, so nothing else
+    // would hand back its scheduler and hedge slots or stop its transfers and timers
+    if (bInFlight && bFlightLeader)
+    {
+        // Followers that are still referenced send the request themselves instead of waiting forever
+        for (UHttpJsonRequestAsync* Follower : TakeFlightFollowers())
+        {
+            Follower->bInFlight = false;
+            if (!Follower->IsUnreachable())
+            {
+                Follower->Attempt();
+            }
+        }
+    }
+    else
+    {
+        LeaveFlight();
+    }
+    if (ActiveRequest.IsValid())
+    {
+        ActiveRequest->OnProcessRequestComplete().Unbind();
+    }
+    if (HedgeRequest.IsValid())
+    {
+        HedgeRequest->OnProcessRequestComplete().Unbind();
+    }
+    AbortLocally();
+    Super::BeginDestroy();
+}
+
+void UHttpJsonRequestAsync::RecordCompletion(bool bSucceeded)
+{
+    Stats.TotalSeconds = (float)(FPlatformTime::Seconds() - ActivatedAtSeconds);
+#if QUICKHTTP_WITH_METRICS
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetMetrics().Record(Host, Stats, bSucceeded);
+    }
+#endif
+}
+
+void UHttpJsonRequestAsync::FinishSuccess(const FString& Response, int32 StatusCode)
+{
+    UnregisterToken();
+    RecordCompletion(true);
+    OnFinishedNative.Broadcast(this, Response, StatusCode, FQuickHttpError());
     OnSuccess.Broadcast(Response, StatusCode);
     SetReadyToDestroy();
 }
 
-void UHttpJsonRequestAsync::FinishFailure(int32 StatusCode, const FString& Message, const FString& RawBody)
+void UHttpJsonRequestAsync::FinishSuccessBytes(const TArray<uint8>& Response, int32 StatusCode)
+{
+    UnregisterToken();
+    RecordCompletion(true);
+    OnFinishedNative.Broadcast(this, FString(), StatusCode, FQuickHttpError());
+    OnSuccessBytesView.Broadcast(TArrayView<const uint8>(Response), StatusCode);
+    OnSuccessBytes.Broadcast(Response, StatusCode);
+    SetReadyToDestroy();
+}
+
+void UHttpJsonRequestAsync::FinishOnWorker(const TArray<uint8>& Body, int32 StatusCode, EQuickHttpBodyFormat Format)
 {
-    if (CancelToken != 0)
+    // Extract paths, parse and decode on a worker; only the results come back to the game thread.
+    // The node stays registered under its token meanwhile, so it can still be cancelled.
+    // A response struct takes precedence over the document and text results.
+    const UScriptStruct* StructType = Options.bDeliverRawBytes ? nullptr : ResponseStruct;
+    const bool bParse = !StructType && Options.bParseOnWorker && !Options.bDeliverRawBytes;
+    const bool bDecode = !StructType && !bParse && !Options.bDeliverRawBytes;
+    TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Bytes = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>(Body);
+    TWeakObjectPtr<UHttpJsonRequestAsync> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Bytes, StatusCode, Format, bParse, bDecode, StructType, Paths = Options.ExtractPaths]()
     {
-        if (TSet<TWeakObjectPtr<UHttpJsonRequestAsync>>* SetPtr = TokenMap.Find(CancelToken))
+        const double Start = FPlatformTime::Seconds();
+        FString Error;
+
+        // A binary body is decoded once; its JSON text is only produced when paths or text are wanted
+        TSharedPtr<FJsonValue> Value;
+        TArray<uint8> JsonBytes;
+        const TArray<uint8>* Json = &*Bytes;
+        if (Format != EQuickHttpBodyFormat::Json)
         {
-            SetPtr->Remove(this);
-            if (SetPtr->Num() == 0) { TokenMap.Remove(CancelToken); }
+            FString DecodeError;
+            if (!FQuickBinaryJson::Decode(*Bytes, Format, Value, DecodeError))
+            {
+                Error = FString::Printf(TEXT("Invalid %s: %s"), FQuickBinaryJson::GetFormatName(Format), *DecodeError);
+            }
+            else if (bDecode || StructType || Paths.Num() > 0)
+            {
+                FQuickBinaryJson::Encode(Value, EQuickHttpBodyFormat::Json, JsonBytes);
+                Json = &JsonBytes;
+            }
         }
+
+        TMap<FString, TArray<FQuickJsonPathMatch>> Extracted;
+        for (const FString& Selector : Paths)
+        {
+            if (!Error.IsEmpty()) { break; }
+            FString PathError;
+            FQuickJsonPathPtr Path = FQuickJsonPath::Compile(Selector, &PathError);
+            if (!Path.IsValid())
+            {
+                Error = FString::Printf(TEXT("Invalid JSON path '%s': %s"), *Selector, *PathError);
+                break;
+            }
+            if (!Path->ExtractUtf8(*Json, Extracted.FindOrAdd(Selector), &PathError))
+            {
+                Error = FString::Printf(TEXT("Invalid JSON: %s"), *PathError);
+                break;
+            }
+        }
+
+        if (bParse && Error.IsEmpty() && !Value.IsValid())
+        {
+            FString ParseError;
+            if (!UQuickJsonDocument::ParseUtf8(*Bytes, Value, ParseError))
+            {
+                Error = FString::Printf(TEXT("Invalid JSON: %s"), *ParseError);
+            }
+        }
+
+        if (!bParse)
+        {
+            Value.Reset();
+        }
+
+        TSharedPtr<FStructOnScope, ESPMode::ThreadSafe> Decoded;
+        if (StructType && Error.IsEmpty())
+        {
+            Decoded = MakeShared<FStructOnScope, ESPMode::ThreadSafe>(StructType);
+            FString DecodeError;
+            if (!FQuickJsonStruct::FromBytes(*Json, StructType, Decoded->GetStructMemory(), DecodeError))
+            {
+                Error = FString::Printf(TEXT("Invalid JSON for %s: %s"), *StructType->GetName(), *DecodeError);
+                Decoded.Reset();
+            }
+        }
+
+        // Binary bodies that failed to decode have no text form
+        FString Text;
+        if ((bDecode || !Error.IsEmpty()) && (Format == EQuickHttpBodyFormat::Json || Json == &JsonBytes))
+        {
+            Text = QuickHttp::Utf8BytesToString(*Json);
+        }
+        const double WorkerDone = FPlatformTime::Seconds();
+        const float WorkerSeconds = (float)(WorkerDone - Start);
+
+        // Move the tree into the game-thread task so its (non thread-safe) refcount is never shared
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Bytes, StatusCode, bParse, bDecode, WorkerSeconds, WorkerDone,
+            Value = MoveTemp(Value), Decoded = MoveTemp(Decoded), Error = MoveTemp(Error), Text = MoveTemp(Text),
+            Extracted = MoveTemp(Extracted)]() mutable
+        {
+            UHttpJsonRequestAsync* Node = WeakThis.Get();
+            if (!Node || Node->bCancelled) { return; }
+            Node->Stats.ParseSeconds = WorkerSeconds;
+            Node->Stats.DispatchSeconds = (float)(FPlatformTime::Seconds() - WorkerDone);
+            Node->ExtractedValues = MoveTemp(Extracted);
+            if (!Error.IsEmpty())
+            {
+                Node->FinishFailure(StatusCode, Error, Text);
+                return;
+            }
+            if (Decoded.IsValid())
+            {
+                Node->FinishSuccessStruct(UQuickJsonStructValue::Wrap(Node->ResponseStruct, Decoded), StatusCode);
+                return;
+            }
+            if (bParse)
+            {
+                Node->FinishSuccessDocument(UQuickJsonDocument::Wrap(Value), StatusCode);
+                return;
+            }
+            if (bDecode)
+            {
+                Node->FinishSuccess(Text, StatusCode);
+                return;
+            }
+            Node->FinishSuccessBytes(*Bytes, StatusCode);
+        });
+    });
+}
+
+TArray<FQuickJsonPathMatch> UHttpJsonRequestAsync::GetExtractedValues(const FString& Path) const
+{
+    const TArray<FQuickJsonPathMatch>* Found = ExtractedValues.Find(Path);
+    return Found ? *Found : TArray<FQuickJsonPathMatch>();
+}
+
+void UHttpJsonRequestAsync::FinishSuccessDocument(UQuickJsonDocument* Document, int32 StatusCode)
+{
+    UnregisterToken();
+    RecordCompletion(true);
+    OnFinishedNative.Broadcast(this, FString(), StatusCode, FQuickHttpError());
+    OnSuccessDocument.Broadcast(Document, StatusCode);
+    SetReadyToDestroy();
+}
+
+void UHttpJsonRequestAsync::FinishSuccessStruct(UQuickJsonStructValue* Value, int32 StatusCode)
+{
+    UnregisterToken();
+    RecordCompletion(true);
+    OnFinishedNative.Broadcast(this, FString(), StatusCode, FQuickHttpError());
+    OnSuccessStruct.Broadcast(Value, StatusCode);
+    SetReadyToDestroy();
+}
+
+void UHttpJsonRequestAsync::FinishFailure(int32 StatusCode, const FString& Message, const FString& RawBody)
+{
+    for (UHttpJsonRequestAsync* Follower : TakeFlightFollowers())
+    {
+        Follower->bInFlight = false;
+        Follower->bCompleted = true;
+        Follower->FinishFailure(StatusCode, Message, RawBody);
+    }
+
+    UnregisterToken();
+    if (bFlightMuted)
+    {
+        SetReadyToDestroy();
+        return;
     }
+    RecordCompletion(false);
     FQuickHttpError Err; Err.bIsError = true; Err.StatusCode = StatusCode; Err.Message = Message; Err.RawBody = RawBody;
+    OnFinishedNative.Broadcast(this, FString(), StatusCode, Err);
     OnFailure.Broadcast(Err);
     SetReadyToDestroy();
 }
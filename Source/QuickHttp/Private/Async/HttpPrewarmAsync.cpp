@@ -0,0 +1,31 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Async/HttpPrewarmAsync.h"
+#include "QuickHttpModule.h"
+
+UHttpPrewarmAsync* UHttpPrewarmAsync::PrewarmHttpConnections(UObject* InWorldContextObject, const TArray<FString>& InUrls, bool bInForce)
+{
+    UHttpPrewarmAsync* Node = NewObject<UHttpPrewarmAsync>();
+    Node->WorldContextObject = InWorldContextObject;
+    Node->Urls = InUrls;
+    Node->bForce = bInForce;
+    return Node;
+}
+
+void UHttpPrewarmAsync::Activate()
+{
+    TWeakObjectPtr<UHttpPrewarmAsync> WeakThis(this);
+    FQuickHttpModule::Get().GetPrewarmer().Prewarm(Urls, bForce, [WeakThis](const TArray<FQuickHttpPrewarmResult>& Results)
+    {
+        UHttpPrewarmAsync* Node = WeakThis.Get();
+        if (!Node) { return; }
+
+        int32 NumSucceeded = 0;
+        for (const FQuickHttpPrewarmResult& Result : Results)
+        {
+            NumSucceeded += Result.bSucceeded ? 1 : 0;
+        }
+        Node->OnCompleted.Broadcast(Results, NumSucceeded);
+        Node->SetReadyToDestroy();
+    });
+}
@@ -0,0 +1,438 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Async/HttpStreamRequestAsync.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpRequestKey.h"
+#include "QuickHttpCompat.h"
+#include "Network/QuickHttpStreamParser.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Serialization/Archive.h"
+#include "Async/Async.h"
+
+/**
+ * Parser and finished records of one stream node, shared between the thread that receives the body
+ * and the game thread. Bytes from a connection the node already moved past are ignored.
+ */
+class FQuickHttpStreamState : public TSharedFromThis<FQuickHttpStreamState, ESPMode::ThreadSafe>
+{
+public:
+    FQuickHttpStreamState(UHttpStreamRequestAsync* InNode, EQuickHttpStreamFormat InFormat, int32 InMaxBufferBytes)
+        : Node(InNode), Parser(InFormat, InMaxBufferBytes), MaxBufferBytes(InMaxBufferBytes)
+    {
+    }
+
+    /** Start reading a new connection and return its id. Game thread. */
+    uint32 BeginConnection()
+    {
+        FScopeLock ScopeLock(&Lock);
+        Parser.ResetConnection();
+        Held.Reset();
+        bAccepted = false;
+        bRejected = false;
+        return ++Connection;
+    }
+
+    /**
+     * Report the status code of connection InConnection once it is known. Bytes that arrived before are
+     * parsed now if it is a 2xx, otherwise they and the rest of the body (an error page) are dropped. Game thread.
+     */
+    void SetConnectionStatus(uint32 InConnection, bool bSuccessStatus)
+    {
+        bool bScheduleDrain = false;
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (InConnection != Connection || bAccepted || bRejected) { return; }
+            bAccepted = bSuccessStatus;
+            bRejected = !bSuccessStatus;
+            if (bAccepted && Held.Num() > 0)
+            {
+                bScheduleDrain = ParseLocked(Held.GetData(), Held.Num());
+            }
+            Held.Empty();
+        }
+        if (bScheduleDrain)
+        {
+            ScheduleDrain();
+        }
+    }
+
+    /** Stop accepting bytes for the current connection, flushing a last unterminated NDJSON line. */
+    void EndConnection(bool bFlush)
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (bFlush && bAccepted && !bOverflow)
+        {
+            Parser.Finish(Ready);
+        }
+        Held.Empty();
+        ++Connection;
+    }
+
+    /** Parse body bytes of connection InConnection, or hold them until its status code is known. Any thread. */
+    void Feed(uint32 InConnection, const uint8* Data, int64 Num)
+    {
+        bool bScheduleDrain = false;
+        {
+            FScopeLock ScopeLock(&Lock);
+            if (InConnection != Connection || bOverflow || bRejected) { return; }
+
+            if (!bAccepted)
+            {
+                Held.Append(Data, (int32)Num);
+                bOverflow = Held.Num() > MaxBufferBytes;
+                bScheduleDrain = bOverflow && !bDrainScheduled;
+                bDrainScheduled |= bScheduleDrain;
+            }
+            else
+            {
+                bScheduleDrain = ParseLocked(Data, Num);
+            }
+        }
+        if (bScheduleDrain)
+        {
+            ScheduleDrain();
+        }
+    }
+
+    /** Take the finished records. Game thread. */
+    void Take(TArray<FQuickHttpStreamRecord>& OutRecords, bool& bOutOverflow)
+    {
+        FScopeLock ScopeLock(&Lock);
+        OutRecords = MoveTemp(Ready);
+        Ready.Reset();
+        ReadyBytes = 0;
+        bDrainScheduled = false;
+        bOutOverflow = bOverflow;
+    }
+
+    FString GetLastEventId()
+    {
+        FScopeLock ScopeLock(&Lock);
+        return Parser.GetLastEventId();
+    }
+
+    int32 GetRetryMs()
+    {
+        FScopeLock ScopeLock(&Lock);
+        return Parser.GetRetryMs();
+    }
+
+private:
+    /** Returns true if the caller must schedule a drain. Lock held. */
+    bool ParseLocked(const uint8* Data, int64 Num)
+    {
+        const int32 Before = Ready.Num();
+        bOverflow = !Parser.Feed(Data, Num, Ready);
+        for (int32 Index = Before; Index < Ready.Num(); ++Index)
+        {
+            ReadyBytes += Ready[Index].Data.Len() * sizeof(TCHAR);
+        }
+        // The game thread is not keeping up; fail rather than grow without bound
+        bOverflow |= ReadyBytes > MaxBufferBytes;
+
+        if ((Ready.Num() > Before || bOverflow) && !bDrainScheduled)
+        {
+            bDrainScheduled = true;
+            return true;
+        }
+        return false;
+    }
+
+    /** One game-thread task per frame at most, however many records arrive meanwhile. */
+    void ScheduleDrain()
+    {
+        TSharedRef<FQuickHttpStreamState, ESPMode::ThreadSafe> Self = AsShared();
+        AsyncTask(ENamedThreads::GameThread, [Self]()
+        {
+            if (UHttpStreamRequestAsync* StreamNode = Self->Node.Get())
+            {
+                StreamNode->DrainRecords();
+            }
+        });
+    }
+
+    TWeakObjectPtr<UHttpStreamRequestAsync> Node;
+    FCriticalSection Lock;
+    FQuickHttpStreamParser Parser;
+    TArray<FQuickHttpStreamRecord> Ready;
+    int64 ReadyBytes = 0;
+    int32 MaxBufferBytes = 0;
+    uint32 Connection = 0;
+    /** Body bytes received before the connection's status code was known. */
+    TArray<uint8> Held;
+    bool bAccepted = false;
+    bool bRejected = false;
+    bool bOverflow = false;
+    bool bDrainScheduled = false;
+};
+
+#if QUICKHTTP_HAS_RESPONSE_STREAM
+
+/** Receives the response body from the HTTP thread chunk by chunk and feeds it to the stream state. */
+class FQuickHttpStreamArchive : public FArchive
+{
+public:
+    FQuickHttpStreamArchive(TSharedRef<FQuickHttpStreamState, ESPMode::ThreadSafe> InState, uint32 InConnection)
+        : State(InState), Connection(InConnection)
+    {
+        SetIsSaving(true);
+    }
+
+    virtual void Serialize(void* Data, int64 Num) override
+    {
+        State->Feed(Connection, (const uint8*)Data, Num);
+    }
+
+private:
+    TSharedRef<FQuickHttpStreamState, ESPMode::ThreadSafe> State;
+    uint32 Connection;
+};
+
+#endif
+
+UHttpStreamRequestAsync* UHttpStreamRequestAsync::HttpStreamRequest(
+    UObject* InWorldContextObject,
+    EQuickHttpMethod InMethod,
+    const FString& InUrl,
+    const TArray<FQuickHttpHeader>& InHeaders,
+    const FString& InBodyJsonOptional,
+    EQuickHttpStreamFormat InFormat,
+    int32 InMaxBufferKB,
+    int32 InMaxReconnects,
+    float InReconnectDelaySeconds)
+{
+    UHttpStreamRequestAsync* Node = NewObject<UHttpStreamRequestAsync>();
+    Node->WorldContextObject = InWorldContextObject;
+    Node->Method = InMethod;
+    Node->Url = InUrl;
+    Node->Headers = InHeaders;
+    Node->BodyJsonOptional = InBodyJsonOptional;
+    Node->Format = InFormat;
+    Node->MaxBufferBytes = FMath::Clamp(InMaxBufferKB, 1, 64 * 1024) * 1024;
+    Node->MaxReconnects = FMath::Max(0, InMaxReconnects);
+    Node->ReconnectDelaySeconds = FMath::Max(0.1f, InReconnectDelaySeconds);
+    return Node;
+}
+
+void UHttpStreamRequestAsync::Activate()
+{
+    if (bCancelled || bFinished) { return; }
+    State = MakeShared<FQuickHttpStreamState, ESPMode::ThreadSafe>(this, Format, MaxBufferBytes);
+    Connect();
+}
+
+void UHttpStreamRequestAsync::Connect()
+{
+    if (bCancelled || bFinished) { return; }
+    ConnectionId = State->BeginConnection();
+
+    TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> Req = FHttpModule::Get().CreateRequest();
+    ActiveRequest = Req;
+    Req->SetURL(Url);
+    Req->SetVerb(QuickHttp::MethodToVerb(Method));
+
+    if (Format == EQuickHttpStreamFormat::ServerSentEvents)
+    {
+        Req->SetHeader(TEXT("Accept"), TEXT("text/event-stream"));
+        Req->SetHeader(TEXT("Cache-Control"), TEXT("no-cache"));
+        const FString LastEventId = State->GetLastEventId();
+        if (!LastEventId.IsEmpty())
+        {
+            Req->SetHeader(TEXT("Last-Event-ID"), LastEventId);
+        }
+    }
+    else
+    {
+        Req->SetHeader(TEXT("Accept"), TEXT("application/x-ndjson, application/jsonl;q=0.9, application/json;q=0.5"));
+    }
+    // Records are parsed from the raw bytes as they arrive, so they must not be compressed
+    Req->SetHeader(TEXT("Accept-Encoding"), TEXT("identity"));
+    for (const FQuickHttpHeader& H : Headers)
+    {
+        Req->SetHeader(H.Name, H.Value);
+    }
+    if (!BodyJsonOptional.IsEmpty() && Method != EQuickHttpMethod::GET)
+    {
+        Req->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+        Req->SetContentAsString(BodyJsonOptional);
+    }
+
+#if QUICKHTTP_HAS_RESPONSE_STREAM
+    Req->SetResponseBodyReceiveStream(MakeShared<FQuickHttpStreamArchive>(State.ToSharedRef(), ConnectionId));
+    // The body of every response is streamed, error pages included; records only come from a 2xx.
+    // Headers follow the status line, so the first one tells whether to parse or drop the body.
+    const uint32 HeaderConnection = ConnectionId;
+    Req->OnHeaderReceived().BindWeakLambda(this, [this, HeaderConnection](FHttpRequestPtr Request, const FString& HeaderName, const FString& HeaderValue)
+    {
+        FHttpResponsePtr Response = Request.IsValid() ? Request->GetResponse() : nullptr;
+        const int32 Status = Response.IsValid() ? Response->GetResponseCode() : 0;
+        if (Status > 0 && State.IsValid())
+        {
+            State->SetConnectionStatus(HeaderConnection, Status >= 200 && Status < 300);
+        }
+    });
+#endif
+    Req->OnProcessRequestComplete().BindUObject(this, &UHttpStreamRequestAsync::HandleResponse);
+    Req->ProcessRequest();
+}
+
+void UHttpStreamRequestAsync::HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+    ActiveRequest.Reset();
+    if (bCancelled || bFinished) { return; }
+
+    const int32 Status = Response.IsValid() ? Response->GetResponseCode() : 0;
+    const bool bOk = bSucceeded && Response.IsValid() && Status >= 200 && Status < 300;
+    State->SetConnectionStatus(ConnectionId, bOk);
+#if !QUICKHTTP_HAS_RESPONSE_STREAM
+    if (bOk)
+    {
+        const TArray<uint8>& Content = Response->GetContent();
+        State->Feed(ConnectionId, Content.GetData(), Content.Num());
+    }
+#endif
+
+    // Deliver what this connection produced before reporting how it ended
+    State->EndConnection(bOk);
+    DrainRecords();
+    if (bFinished) { return; }
+
+    if (!bSucceeded || !Response.IsValid())
+    {
+        ReconnectOrFail(Status, TEXT("Network failure"));
+        return;
+    }
+    if (Format == EQuickHttpStreamFormat::ServerSentEvents && Status == 204)
+    {
+        // The server's way of saying "stop reconnecting"
+        Close(Status);
+        return;
+    }
+    if (!bOk)
+    {
+        if (Status >= 500)
+        {
+            ReconnectOrFail(Status, TEXT("HTTP error"));
+            return;
+        }
+        Fail(Status, TEXT("HTTP error"));
+        return;
+    }
+    if (Format == EQuickHttpStreamFormat::ServerSentEvents && MaxReconnects > 0)
+    {
+        // An event stream that ends normally is resumed, as browsers do
+        ReconnectOrFail(Status, TEXT("Stream ended"));
+        return;
+    }
+    Close(Status);
+}
+
+void UHttpStreamRequestAsync::DrainRecords()
+{
+    if (!State.IsValid() || bCancelled || bFinished) { return; }
+
+    TArray<FQuickHttpStreamRecord> Records;
+    bool bOverflow = false;
+    State->Take(Records, bOverflow);
+
+    // Records only come from a 2xx connection, so a failing server cannot keep resetting the reconnect limit
+    if (Records.Num() > 0)
+    {
+        ReconnectCount = 0;
+        LastBackoffSeconds = 0.f;
+        OnRecords.Broadcast(Records);
+    }
+    if (bOverflow && !bFinished && !bCancelled)
+    {
+        Fail(0, FString::Printf(TEXT("Stream buffer of %d KB exceeded"), MaxBufferBytes / 1024));
+    }
+}
+
+void UHttpStreamRequestAsync::ReconnectOrFail(int32 StatusCode, const FString& Message)
+{
+    if (Format != EQuickHttpStreamFormat::ServerSentEvents || ReconnectCount >= MaxReconnects)
+    {
+        Fail(StatusCode, Message);
+        return;
+    }
+
+    // The server's retry: value (or ReconnectDelaySeconds) is the base; repeated failures back off from it
+    const int32 RetryMs = State->GetRetryMs();
+    const float BaseSeconds = RetryMs >= 0 ? FMath::Max(0.01f, RetryMs / 1000.f) : ReconnectDelaySeconds;
+    const float Delay = FQuickHttpRetryQueue::ComputeBackoffSeconds(BaseSeconds, ReconnectCount, LastBackoffSeconds);
+    LastBackoffSeconds = Delay;
+    ReconnectCount++;
+
+    TWeakObjectPtr<UHttpStreamRequestAsync> WeakThis(this);
+    const bool bQueued = FQuickHttpModule::Get().GetRetryQueue().Enqueue(Delay, [WeakThis]()
+    {
+        if (UHttpStreamRequestAsync* Node = WeakThis.Get())
+        {
+            Node->Connect();
+        }
+    });
+    if (!bQueued)
+    {
+        Fail(StatusCode, TEXT("Retry queue full"));
+    }
+}
+
+void UHttpStreamRequestAsync::Close(int32 StatusCode)
+{
+    if (bFinished) { return; }
+    bFinished = true;
+    AbortRequest();
+    OnClosed.Broadcast(StatusCode);
+    SetReadyToDestroy();
+}
+
+void UHttpStreamRequestAsync::Fail(int32 StatusCode, const FString& Message)
+{
+    if (bFinished) { return; }
+    bFinished = true;
+    AbortRequest();
+
+    FQuickHttpError Err;
+    Err.bIsError = true;
+    Err.StatusCode = StatusCode;
+    Err.Message = Message;
+    OnFailure.Broadcast(Err);
+    SetReadyToDestroy();
+}
+
+void UHttpStreamRequestAsync::Cancel()
+{
+    if (bCancelled || bFinished) { return; }
+    bCancelled = true;
+    bFinished = true;
+    AbortRequest();
+
+    FQuickHttpError Err;
+    Err.bIsError = true;
+    Err.Message = TEXT("Cancelled");
+    OnCancelled.Broadcast(Err);
+    SetReadyToDestroy();
+}
+
+void UHttpStreamRequestAsync::AbortRequest()
+{
+    if (State.IsValid())
+    {
+        State->EndConnection(false);
+    }
+    if (ActiveRequest.IsValid())
+    {
+        ActiveRequest->OnProcessRequestComplete().Unbind();
+        ActiveRequest->CancelRequest();
+        ActiveRequest.Reset();
+    }
+}
+
+void UHttpStreamRequestAsync::BeginDestroy()
+{
+    bCancelled = true;
+    AbortRequest();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,109 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Benchmarks/QuickHttpBenchReport.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "QuickHttpModule.h"
+#include "Json/QuickJsonWriter.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/EngineVersion.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformProperties.h"
+
+void FQuickHttpBenchReport::AddRow(const FString& Name)
+{
+    Rows.AddDefaulted_GetRef().Name = Name;
+}
+
+void FQuickHttpBenchReport::Set(const FString& Column, double Value)
+{
+    if (Rows.Num() == 0) { AddRow(FString()); }
+    Columns.AddUnique(Column);
+    Rows.Last().Values.Add(Column, Value);
+}
+
+FString FQuickHttpBenchReport::Save() const
+{
+    // Log
+    FString Header = FString::Printf(TEXT("  %-28s"), TEXT("case"));
+    for (const FString& Column : Columns)
+    {
+        Header += FString::Printf(TEXT(" %14s"), *Column);
+    }
+    UE_LOG(LogQuickHttp, Display, TEXT("QuickHttp benchmark '%s'"), *Suite);
+    UE_LOG(LogQuickHttp, Display, TEXT("%s"), *Header);
+    for (const FRow& Row : Rows)
+    {
+        FString Line = FString::Printf(TEXT("  %-28s"), *Row.Name);
+        for (const FString& Column : Columns)
+        {
+            const double* Value = Row.Values.Find(Column);
+            Line += Value ? FString::Printf(TEXT(" %14.3f"), *Value) : FString::Printf(TEXT(" %14s"), TEXT("-"));
+        }
+        UE_LOG(LogQuickHttp, Display, TEXT("%s"), *Line);
+    }
+
+    // CSV: one row per case, empty cells for unset columns
+    FString Csv = TEXT("case");
+    for (const FString& Column : Columns)
+    {
+        Csv += TEXT(",") + Column;
+    }
+    Csv += TEXT("\n");
+    for (const FRow& Row : Rows)
+    {
+        Csv += TEXT("\"") + Row.Name.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+        for (const FString& Column : Columns)
+        {
+            const double* Value = Row.Values.Find(Column);
+            Csv += Value ? FString::Printf(TEXT(",%.6f"), *Value) : FString(TEXT(","));
+        }
+        Csv += TEXT("\n");
+    }
+
+    // JSON: run metadata plus the same rows
+    FQuickJsonWriter Json;
+    Json.BeginObject();
+    Json.Key(TEXT("suite")); Json.String(Suite);
+    Json.Key(TEXT("timestamp")); Json.String(FDateTime::UtcNow().ToIso8601());
+    Json.Key(TEXT("engine")); Json.String(FEngineVersion::Current().ToString());
+    Json.Key(TEXT("platform")); Json.String(FPlatformProperties::IniPlatformName());
+    Json.Key(TEXT("cpu")); Json.String(FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+    Json.Key(TEXT("params"));
+    Json.BeginObject();
+    for (const TPair<FString, FString>& Param : Params)
+    {
+        Json.Key(Param.Key); Json.String(Param.Value);
+    }
+    Json.EndObject();
+    Json.Key(TEXT("results"));
+    Json.BeginArray();
+    for (const FRow& Row : Rows)
+    {
+        Json.BeginObject();
+        Json.Key(TEXT("case")); Json.String(Row.Name);
+        for (const FString& Column : Columns)
+        {
+            if (const double* Value = Row.Values.Find(Column))
+            {
+                Json.Key(Column); Json.Number(*Value);
+            }
+        }
+        Json.EndObject();
+    }
+    Json.EndArray();
+    Json.EndObject();
+
+    const FString Base = FPaths::ProjectSavedDir() / TEXT("QuickHttp") / TEXT("Bench") /
+        FString::Printf(TEXT("%s-%s"), *Suite, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")));
+    const FString JsonPath = Base + TEXT(".json");
+    FFileHelper::SaveStringToFile(Csv, *(Base + TEXT(".csv")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+    FFileHelper::SaveArrayToFile(Json.GetBytes(), *JsonPath);
+    UE_LOG(LogQuickHttp, Display, TEXT("  results written to %s(.csv)"), *JsonPath);
+    return JsonPath;
+}
+
+#endif
@@ -0,0 +1,43 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Benchmark results as named rows of numeric columns.
+ * Save() logs a table and writes matching .csv and .json files under Saved/QuickHttp/Bench,
+ * so runs from different builds or engine versions can be diffed by tooling.
+ */
+class FQuickHttpBenchReport
+{
+public:
+    explicit FQuickHttpBenchReport(const FString& InSuite) : Suite(InSuite) {}
+
+    /** Start a new row; following Set calls fill it. */
+    void AddRow(const FString& Name);
+
+    /** Set a column of the current row. Columns appear in first-use order. */
+    void Set(const FString& Column, double Value);
+
+    /** Free-form run parameters written to the JSON header (e.g. sizes, engine version). */
+    void SetParam(const FString& Key, const FString& Value) { Params.Add(Key, Value); }
+
+    /** Log the table and write the files. Returns the path of the JSON file. */
+    FString Save() const;
+
+private:
+    struct FRow
+    {
+        FString Name;
+        TMap<FString, double> Values;
+    };
+
+    FString Suite;
+    TArray<FString> Columns;
+    TArray<FRow> Rows;
+    TMap<FString, FString> Params;
+};
+
+#endif
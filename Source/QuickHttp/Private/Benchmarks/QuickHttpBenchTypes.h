@@ -0,0 +1,42 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpBenchTypes.generated.h"
+
+// Reflection cannot be compiled out, so these ship; only the benchmarks that use them are non-shipping.
+
+/** One record of the struct JSON benchmark, shaped like the JSON Builder benchmark items. */
+USTRUCT()
+struct FQuickHttpBenchRecord
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Id = 0;
+
+    UPROPERTY()
+    FString Name;
+
+    UPROPERTY()
+    float Score = 0.f;
+
+    UPROPERTY()
+    bool bActive = false;
+
+    UPROPERTY()
+    TArray<FString> Tags;
+
+    UPROPERTY()
+    FVector2D Pos = FVector2D::ZeroVector;
+};
+
+/** Payload of the struct JSON benchmark: {"items":[...]} */
+USTRUCT()
+struct FQuickHttpBenchPayload
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FQuickHttpBenchRecord> Items;
+};
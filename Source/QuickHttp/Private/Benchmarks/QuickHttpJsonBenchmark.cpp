@@ -0,0 +1,243 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpBPLibrary.h"
+#include "Benchmarks/QuickHttpBenchReport.h"
+#include "Json/QuickJsonBuilder.h"
+#include "Json/QuickBinaryJson.h"
+#include "Json/QuickJsonReformatter.h"
+#include "Json/QuickJsonWriter.h"
+#include "Json/QuickJsonPatch.h"
+#include "Compression/QuickHttpCompression.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace QuickHttpJsonBenchmark
+{
+    /** Pretty-printed array of records, roughly TargetBytes long, shaped like a typical debug dump. */
+    static FString MakeSample(int32 TargetBytes)
+    {
+        FQuickJsonWriter Writer(TargetBytes);
+        Writer.BeginArray();
+        for (int32 i = 0; Writer.GetBytes().Num() < TargetBytes; ++i)
+        {
+            Writer.BeginObject();
+            Writer.Key(TEXT("id")); Writer.Int(i);
+            Writer.Key(TEXT("name")); Writer.String(FString::Printf(TEXT("Item \"%d\" with a longer description\tand escapes"), i));
+            Writer.Key(TEXT("score")); Writer.Number(i * 0.37);
+            Writer.Key(TEXT("active")); Writer.Bool((i & 1) == 0);
+            Writer.Key(TEXT("tags"));
+            Writer.BeginArray();
+            Writer.String(TEXT("alpha")); Writer.String(TEXT("beta")); Writer.Null();
+            Writer.EndArray();
+            Writer.Key(TEXT("pos"));
+            Writer.BeginObject();
+            Writer.Key(TEXT("x")); Writer.Number(i * 1.5); Writer.Key(TEXT("y")); Writer.Number(-i * 2.25);
+            Writer.EndObject();
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+
+        FString Pretty;
+        FQuickJsonReformatter::Reformat(Writer.ToString(), EQuickJsonFormat::Pretty, Pretty);
+        return Pretty;
+    }
+
+    /** Average milliseconds per call over Iterations runs. */
+    template <typename FuncType>
+    static double TimeMs(int32 Iterations, FuncType&& Func)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i) { Func(); }
+        return (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+    }
+
+    /** Builder with an "items" array of records, roughly TargetBytes when serialized compactly. */
+    static UQuickJsonBuilder* MakeBuilder(int32 TargetBytes)
+    {
+        TArray<UQuickJsonBuilder*> Items;
+        for (int32 i = 0; i < FMath::Max(1, TargetBytes / 150); ++i)
+        {
+            UQuickJsonBuilder* Pos = UQuickJsonBuilder::NewJsonBuilder()->SetNumber(TEXT("x"), i * 1.5f)->SetNumber(TEXT("y"), -i * 2.25f);
+            Items.Add(UQuickJsonBuilder::NewJsonBuilder()
+                ->SetInt(TEXT("id"), i)
+                ->SetString(TEXT("name"), FString::Printf(TEXT("Item \"%d\" with a longer description"), i))
+                ->SetBool(TEXT("active"), (i & 1) == 0)
+                ->SetArrayString(TEXT("tags"), { TEXT("alpha"), TEXT("beta") })
+                ->SetObject(TEXT("pos"), Pos));
+        }
+        return UQuickJsonBuilder::NewJsonBuilder()->SetArrayObjects(TEXT("items"), Items);
+    }
+
+    static void Report(FQuickHttpBenchReport& Results, const TCHAR* Name, double Ms, int64 Bytes)
+    {
+        Results.AddRow(Name);
+        Results.Set(TEXT("ms"), Ms);
+        Results.Set(TEXT("mb_per_s"), Ms > 0.0 ? (Bytes / (1024.0 * 1024.0)) / (Ms / 1000.0) : 0.0);
+        Results.Set(TEXT("bytes"), (double)Bytes);
+    }
+
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 SizeKB = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2048;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+
+        const FString Json = MakeSample(SizeKB * 1024);
+        FTCHARToUTF8 Utf8(*Json);
+        TArray<uint8> Bytes;
+        Bytes.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        const int64 NumBytes = Bytes.Num();
+
+        FQuickHttpBenchReport Results(TEXT("JsonFormat"));
+        Results.SetParam(TEXT("size_kb"), FString::FromInt(SizeKB));
+        Results.SetParam(TEXT("iterations"), FString::FromInt(Iterations));
+        Results.SetParam(TEXT("simd"), FQuickJsonReformatter::GetSimdPathName());
+
+        const double DomMs = TimeMs(Iterations, [&Json]()
+        {
+            TSharedPtr<FJsonValue> Value;
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+            FJsonSerializer::Deserialize(Reader, Value);
+            FString Out;
+            TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Out);
+            FJsonSerializer::Serialize(Value->AsArray(), Writer);
+        });
+        Report(Results, TEXT("DOM round-trip (pretty)"), DomMs, NumBytes);
+
+        FString Out;
+        Report(Results, TEXT("Reformat pretty"), TimeMs(Iterations, [&]() { FQuickJsonReformatter::Reformat(Json, EQuickJsonFormat::Pretty, Out); }), NumBytes);
+        Report(Results, TEXT("Reformat minify"), TimeMs(Iterations, [&]() { FQuickJsonReformatter::Reformat(Json, EQuickJsonFormat::Minify, Out); }), NumBytes);
+        Report(Results, TEXT("Validate"), TimeMs(Iterations, [&]() { FQuickJsonReformatter::Validate(Json); }), NumBytes);
+
+        TArray<uint8> OutBytes;
+        Report(Results, TEXT("Reformat minify (UTF-8)"), TimeMs(Iterations, [&]() { FQuickJsonReformatter::ReformatUtf8(Bytes, EQuickJsonFormat::Minify, OutBytes); }), NumBytes);
+        Report(Results, TEXT("Validate (UTF-8)"), TimeMs(Iterations, [&]() { FQuickJsonReformatter::ValidateUtf8(Bytes); }), NumBytes);
+        Report(Results, TEXT("PrettyPrintJson (BP)"), TimeMs(Iterations, [&]() { UQuickHttpBPLibrary::PrettyPrintJson(Json, Out); }), NumBytes);
+
+        UQuickJsonBuilder* Builder = MakeBuilder(SizeKB * 1024);
+        const int64 BuilderBytes = Builder->ToString(false).Len();
+        Report(Results, TEXT("Builder ToString"), TimeMs(Iterations, [&]() { Out = Builder->ToString(false); }), BuilderBytes);
+        Report(Results, TEXT("Builder ToString (pretty)"), TimeMs(Iterations, [&]() { Out = Builder->ToString(true); }), BuilderBytes);
+
+        Results.Save();
+    }
+
+    static void RunBinary(const TArray<FString>& Args)
+    {
+        const int32 SizeKB = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 256;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+        FQuickHttpBenchReport Results(TEXT("BinaryJson"));
+        Results.SetParam(TEXT("size_kb"), FString::FromInt(SizeKB));
+        Results.SetParam(TEXT("iterations"), FString::FromInt(Iterations));
+
+        UQuickJsonBuilder* Builder = MakeBuilder(SizeKB * 1024);
+        int64 JsonBytes = 0;
+        const EQuickHttpBodyFormat Formats[] = { EQuickHttpBodyFormat::Json, EQuickHttpBodyFormat::MessagePack, EQuickHttpBodyFormat::Cbor };
+        for (EQuickHttpBodyFormat Format : Formats)
+        {
+            const FString Name = FQuickBinaryJson::GetFormatName(Format);
+            TArray<uint8> Encoded;
+            Builder->WriteBytes(Format, Encoded);
+            const int64 NumBytes = Encoded.Num();
+            if (Format == EQuickHttpBodyFormat::Json) { JsonBytes = NumBytes; }
+
+            TArray<uint8> Gzipped;
+            FQuickHttpCompression::GzipCompress(Encoded, Gzipped);
+
+            TArray<uint8> Out(Encoded);
+            Report(Results, *(Name + TEXT(" encode")), TimeMs(Iterations, [&]() { Out.Reset(); Builder->WriteBytes(Format, Out); }), NumBytes);
+            Results.Set(TEXT("gzip_bytes"), Gzipped.Num());
+            Results.Set(TEXT("size_vs_json"), JsonBytes > 0 ? (double)NumBytes / JsonBytes : 0.0);
+
+            TSharedPtr<FJsonValue> Value;
+            FString Error;
+            Report(Results, *(Name + TEXT(" decode")), TimeMs(Iterations, [&]() { FQuickBinaryJson::Decode(Encoded, Format, Value, Error); }), NumBytes);
+            Results.Set(TEXT("gzip_bytes"), Gzipped.Num());
+            Results.Set(TEXT("size_vs_json"), JsonBytes > 0 ? (double)NumBytes / JsonBytes : 0.0);
+        }
+
+        // The string path requests used before binary bodies existed
+        FString Text;
+        Report(Results, TEXT("JSON encode (ToString)"), TimeMs(Iterations, [&]() { Text = Builder->ToString(false); }), JsonBytes);
+        Results.Save();
+    }
+
+    static void RunPatch(const TArray<FString>& Args)
+    {
+        const int32 SizeKB = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 256;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+        FQuickHttpBenchReport Results(TEXT("JsonPatch"));
+        Results.SetParam(TEXT("size_kb"), FString::FromInt(SizeKB));
+        Results.SetParam(TEXT("iterations"), FString::FromInt(Iterations));
+
+        // A state-sync update: the same object with one field of one record changed
+        UQuickJsonBuilder* SourceBuilder = MakeBuilder(SizeKB * 1024);
+        UQuickJsonBuilder* TargetBuilder = MakeBuilder(SizeKB * 1024);
+        const TArray<TSharedPtr<FJsonValue>>& Items = TargetBuilder->GetObject()->GetArrayField(TEXT("items"));
+        Items[Items.Num() / 2]->AsObject()->SetStringField(TEXT("name"), TEXT("renamed"));
+        const TSharedPtr<FJsonValue> Source = MakeShared<FJsonValueObject>(SourceBuilder->GetObject());
+        const TSharedPtr<FJsonValue> Target = MakeShared<FJsonValueObject>(TargetBuilder->GetObject());
+
+        TArray<uint8> Full;
+        const double EncodeMs = TimeMs(Iterations, [&]() { Full.Reset(); TargetBuilder->WriteBytes(EQuickHttpBodyFormat::Json, Full); });
+        Report(Results, TEXT("Full body encode"), EncodeMs, Full.Num());
+        Results.Set(TEXT("body_bytes"), Full.Num());
+        Results.Set(TEXT("size_vs_full"), 1.0);
+
+        // Throughput columns count the document bytes walked; body_bytes is what would go on the wire
+        bool bRoundTrip = true;
+        const EQuickJsonPatchFormat Formats[] = { EQuickJsonPatchFormat::MergePatch, EQuickJsonPatchFormat::JsonPatch };
+        for (EQuickJsonPatchFormat Format : Formats)
+        {
+            const FString Name = Format == EQuickJsonPatchFormat::MergePatch ? TEXT("Merge patch") : TEXT("JSON Patch");
+            TSharedPtr<FJsonValue> Patch;
+            TArray<uint8> Encoded;
+            const double DiffMs = TimeMs(Iterations, [&]()
+            {
+                Patch = FQuickJsonPatch::Diff(Source, Target, Format);
+                Encoded.Reset();
+                FQuickBinaryJson::Encode(Patch, EQuickHttpBodyFormat::Json, Encoded);
+            });
+            Report(Results, *(Name + TEXT(" diff + encode")), DiffMs, Full.Num());
+            Results.Set(TEXT("body_bytes"), Encoded.Num());
+            Results.Set(TEXT("size_vs_full"), Full.Num() > 0 ? (double)Encoded.Num() / Full.Num() : 0.0);
+
+            TSharedPtr<FJsonValue> Applied;
+            FString Error;
+            Report(Results, *(Name + TEXT(" apply")), TimeMs(Iterations, [&]() { FQuickJsonPatch::Apply(Source, Patch, Format, Applied, Error); }), Full.Num());
+            bRoundTrip = bRoundTrip && FQuickJsonPatch::Equals(Applied, Target);
+        }
+
+        // What comparing the two documents costs without the patch
+        Report(Results, TEXT("Deep compare"), TimeMs(Iterations, [&]() { FQuickJsonPatch::Equals(Source, Target); }), Full.Num());
+        Results.SetParam(TEXT("round_trip_equal"), bRoundTrip ? TEXT("true") : TEXT("false"));
+        Results.Save();
+    }
+
+    static FAutoConsoleCommand PatchCommand(
+        TEXT("QuickHttp.Bench.JsonPatch"),
+        TEXT("Compare a full JSON Builder body against JSON Merge Patch and JSON Patch bodies for a one-field change: size and diff/apply time. Args: [SizeKB=256] [Iterations=20]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunPatch));
+
+    static FAutoConsoleCommand BinaryCommand(
+        TEXT("QuickHttp.Bench.BinaryJson"),
+        TEXT("Compare payload size (raw and gzipped) and encode/decode time of JSON, MessagePack and CBOR for a JSON Builder payload. Args: [SizeKB=256] [Iterations=20]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunBinary));
+
+    static FAutoConsoleCommand Command(
+        TEXT("QuickHttp.Bench.JsonFormat"),
+        TEXT("Compare the single-pass JSON reformatter against a DOM round-trip, plus PrettyPrintJson and JSON Builder serialization. Args: [SizeKB=2048] [Iterations=10]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
+
+#endif
@@ -0,0 +1,325 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Benchmarks/QuickHttpMockServer.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "IPAddress.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Async/Async.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    // Socket waits use this slice so shutdown is noticed quickly
+    const FTimespan PollInterval = FTimespan::FromMilliseconds(50);
+
+    struct FMockRequest
+    {
+        FString Method;
+        TMap<FString, FString> Query;
+        FString IfNoneMatch;
+        bool bKeepAlive = true;
+
+        int32 GetInt(const TCHAR* Key, int32 Default) const
+        {
+            const FString* Value = Query.Find(Key);
+            return Value ? FCString::Atoi(**Value) : Default;
+        }
+
+        float GetFloat(const TCHAR* Key, float Default) const
+        {
+            const FString* Value = Query.Find(Key);
+            return Value ? FCString::Atof(**Value) : Default;
+        }
+    };
+
+    const TCHAR* ReasonPhrase(int32 Status)
+    {
+        switch (Status)
+        {
+            case 200: return TEXT("OK");
+            case 201: return TEXT("Created");
+            case 204: return TEXT("No Content");
+            case 304: return TEXT("Not Modified");
+            case 400: return TEXT("Bad Request");
+            case 404: return TEXT("Not Found");
+            case 429: return TEXT("Too Many Requests");
+            case 500: return TEXT("Internal Server Error");
+            case 502: return TEXT("Bad Gateway");
+            case 503: return TEXT("Service Unavailable");
+            case 504: return TEXT("Gateway Timeout");
+        }
+        return TEXT("Status");
+    }
+
+    int32 FindHeadEnd(const TArray<uint8>& Buffer)
+    {
+        for (int32 i = 3; i < Buffer.Num(); ++i)
+        {
+            if (Buffer[i] == '\n' && Buffer[i - 1] == '\r' && Buffer[i - 2] == '\n' && Buffer[i - 3] == '\r')
+            {
+                return i + 1;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    /** Parse the request line and headers; returns the Content-Length. */
+    int32 ParseHead(const TArray<uint8>& Buffer, int32 HeadEnd, FMockRequest& Out)
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), HeadEnd);
+        const FString Head(Converted.Length(), Converted.Get());
+        TArray<FString> Lines;
+        Head.ParseIntoArray(Lines, TEXT("\r\n"), true);
+        if (Lines.Num() == 0) { return 0; }
+
+        TArray<FString> RequestLine;
+        Lines[0].ParseIntoArrayWS(RequestLine);
+        Out.Method = RequestLine.Num() > 0 ? RequestLine[0] : FString();
+        FString Target = RequestLine.Num() > 1 ? RequestLine[1] : FString();
+
+        FString Path, QueryString;
+        if (Target.Split(TEXT("?"), &Path, &QueryString))
+        {
+            TArray<FString> Pairs;
+            QueryString.ParseIntoArray(Pairs, TEXT("&"), true);
+            for (const FString& Pair : Pairs)
+            {
+                FString Key, Value;
+                if (!Pair.Split(TEXT("="), &Key, &Value)) { Key = Pair; }
+                Out.Query.Add(Key.ToLower(), Value);
+            }
+        }
+
+        int32 ContentLength = 0;
+        for (int32 i = 1; i < Lines.Num(); ++i)
+        {
+            FString Name, Value;
+            if (!Lines[i].Split(TEXT(":"), &Name, &Value)) { continue; }
+            Name.TrimStartAndEndInline();
+            Value.TrimStartAndEndInline();
+            if (Name.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+            {
+                ContentLength = FMath::Max(0, FCString::Atoi(*Value));
+            }
+            else if (Name.Equals(TEXT("Connection"), ESearchCase::IgnoreCase))
+            {
+                Out.bKeepAlive = !Value.Equals(TEXT("close"), ESearchCase::IgnoreCase);
+            }
+            else if (Name.Equals(TEXT("If-None-Match"), ESearchCase::IgnoreCase))
+            {
+                Out.IfNoneMatch = Value;
+            }
+        }
+        return ContentLength;
+    }
+
+    /** {"data":"xxx..."} padded to roughly NumBytes. */
+    void MakeBody(int32 NumBytes, TArray<uint8>& Out)
+    {
+        static const ANSICHAR Prefix[] = "{\"data\":\"";
+        static const ANSICHAR Suffix[] = "\"}";
+        const int32 Fill = FMath::Max(0, NumBytes - (int32)(sizeof(Prefix) - 1) - (int32)(sizeof(Suffix) - 1));
+        Out.Reset();
+        Out.Append(reinterpret_cast<const uint8*>(Prefix), sizeof(Prefix) - 1);
+        const int32 Start = Out.AddUninitialized(Fill);
+        FMemory::Memset(Out.GetData() + Start, 'x', Fill);
+        Out.Append(reinterpret_cast<const uint8*>(Suffix), sizeof(Suffix) - 1);
+    }
+
+    bool SendAll(FSocket* Socket, const uint8* Data, int32 Num)
+    {
+        while (Num > 0)
+        {
+            int32 Sent = 0;
+            if (!Socket->Send(Data, Num, Sent) || Sent <= 0) { return false; }
+            Data += Sent;
+            Num -= Sent;
+        }
+        return true;
+    }
+}
+
+FQuickHttpMockServer::~FQuickHttpMockServer()
+{
+    Shutdown();
+}
+
+bool FQuickHttpMockServer::Start(int32 InPort)
+{
+    if (Listener) { return true; }
+    ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!Sockets) { return false; }
+
+    Listener = Sockets->CreateSocket(NAME_Stream, TEXT("QuickHttpMockServer"), false);
+    if (!Listener) { return false; }
+
+    TSharedRef<FInternetAddr> Addr = Sockets->CreateInternetAddr();
+    bool bValidIp = false;
+    Addr->SetIp(TEXT("127.0.0.1"), bValidIp);
+    Addr->SetPort(InPort);
+    Listener->SetReuseAddr(true);
+    if (!bValidIp || !Listener->Bind(*Addr) || !Listener->Listen(128))
+    {
+        Sockets->DestroySocket(Listener);
+        Listener = nullptr;
+        return false;
+    }
+
+    Port = Listener->GetPortNo();
+    bStopping = false;
+    NumServed.Reset();
+    NumNotModified.Reset();
+    Thread = FRunnableThread::Create(this, TEXT("QuickHttpMockServer"));
+    if (!Thread)
+    {
+        Sockets->DestroySocket(Listener);
+        Listener = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void FQuickHttpMockServer::Shutdown()
+{
+    if (!Listener) { return; }
+    bStopping = true;
+    if (Thread)
+    {
+        Thread->WaitForCompletion();
+        delete Thread;
+        Thread = nullptr;
+    }
+    // Connection threads notice bStopping within one poll interval
+    while (NumConnections.GetValue() > 0)
+    {
+        FPlatformProcess::Sleep(0.01f);
+    }
+    Listener->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Listener);
+    Listener = nullptr;
+}
+
+uint32 FQuickHttpMockServer::Run()
+{
+    while (!bStopping)
+    {
+        bool bPending = false;
+        if (!Listener->WaitForPendingConnection(bPending, PollInterval) || !bPending) { continue; }
+        if (FSocket* Socket = Listener->Accept(TEXT("QuickHttpMockConnection")))
+        {
+            NumConnections.Increment();
+            Async(EAsyncExecution::Thread, [this, Socket]() { ServeConnection(Socket); });
+        }
+    }
+    return 0;
+}
+
+bool FQuickHttpMockServer::ReadSome(FSocket* Socket, TArray<uint8>& Buffer) const
+{
+    while (!bStopping)
+    {
+        if (!Socket->Wait(ESocketWaitConditions::WaitForRead, PollInterval))
+        {
+            if (Socket->GetConnectionState() == SCS_ConnectionError) { return false; }
+            continue;
+        }
+        uint8 Chunk[16 * 1024];
+        int32 Read = 0;
+        // Readable with nothing to read means the peer closed the connection
+        if (!Socket->Recv(Chunk, sizeof(Chunk), Read) || Read <= 0) { return false; }
+        Buffer.Append(Chunk, Read);
+        return true;
+    }
+    return false;
+}
+
+void FQuickHttpMockServer::ServeConnection(FSocket* Socket)
+{
+    FRandomStream Random((int32)FPlatformTime::Cycles());
+    TArray<uint8> Buffer;
+    TArray<uint8> Body;
+
+    while (!bStopping)
+    {
+        int32 HeadEnd = FindHeadEnd(Buffer);
+        while (HeadEnd == INDEX_NONE && ReadSome(Socket, Buffer))
+        {
+            HeadEnd = FindHeadEnd(Buffer);
+        }
+        if (HeadEnd == INDEX_NONE) { break; }
+
+        FMockRequest Request;
+        const int32 ContentLength = ParseHead(Buffer, HeadEnd, Request);
+        while (Buffer.Num() < HeadEnd + ContentLength && ReadSome(Socket, Buffer)) {}
+        if (Buffer.Num() < HeadEnd + ContentLength) { break; }
+
+        const int32 LatencyMs = Request.GetInt(TEXT("latency_ms"), 0);
+        const double WakeAt = FPlatformTime::Seconds() + LatencyMs / 1000.0;
+        while (!bStopping && FPlatformTime::Seconds() < WakeAt)
+        {
+            FPlatformProcess::Sleep(FMath::Min(0.01f, (float)(WakeAt - FPlatformTime::Seconds())));
+        }
+
+        int32 Status = Request.GetInt(TEXT("status"), 200);
+        const float FailRate = Request.GetFloat(TEXT("fail_rate"), 0.f);
+        if (FailRate > 0.f && Random.FRand() < FailRate)
+        {
+            if (Request.GetInt(TEXT("drop"), 0) != 0)
+            {
+                NumServed.Increment();
+                break;
+            }
+            Status = Request.GetInt(TEXT("fail_status"), 503);
+            MakeBody(64, Body);
+        }
+        else if (Request.GetInt(TEXT("echo"), 0) != 0)
+        {
+            Body.Reset();
+            Body.Append(Buffer.GetData() + HeadEnd, ContentLength);
+        }
+        else
+        {
+            MakeBody(Request.GetInt(TEXT("bytes"), 64), Body);
+        }
+        Buffer.RemoveAt(0, HeadEnd + ContentLength);
+
+        // Cacheable responses: the ETag is answered with 304 when the client already has it
+        FString CacheHeaders;
+        if (const FString* MaxAge = Request.Query.Find(TEXT("max_age")))
+        {
+            CacheHeaders += FString::Printf(TEXT("Cache-Control: max-age=%s\r\n"), **MaxAge);
+        }
+        if (const FString* Tag = Request.Query.Find(TEXT("etag")))
+        {
+            const FString ETag = FString::Printf(TEXT("\"%s\""), **Tag);
+            CacheHeaders += FString::Printf(TEXT("ETag: %s\r\n"), *ETag);
+            if (Status == 200 && Request.IfNoneMatch == ETag)
+            {
+                Status = 304;
+                NumNotModified.Increment();
+            }
+        }
+
+        const bool bHasBody = Status != 204 && Status != 304 && Request.Method != TEXT("HEAD");
+        const FString Head = FString::Printf(TEXT("HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %d\r\n%sConnection: %s\r\n\r\n"),
+            Status, ReasonPhrase(Status), bHasBody ? Body.Num() : 0, *CacheHeaders, Request.bKeepAlive ? TEXT("keep-alive") : TEXT("close"));
+        FTCHARToUTF8 HeadUtf8(*Head);
+        if (!SendAll(Socket, reinterpret_cast<const uint8*>(HeadUtf8.Get()), HeadUtf8.Length())) { break; }
+        if (bHasBody && !SendAll(Socket, Body.GetData(), Body.Num())) { break; }
+        NumServed.Increment();
+
+        if (!Request.bKeepAlive) { break; }
+    }
+
+    Socket->Close();
+    ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+    NumConnections.Decrement();
+}
+
+#endif
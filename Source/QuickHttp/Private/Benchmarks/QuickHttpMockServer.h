@@ -0,0 +1,71 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/Runnable.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+class FSocket;
+class FRunnableThread;
+
+/**
+ * Minimal in-process HTTP/1.1 server on 127.0.0.1 for benchmarks and manual testing.
+ *
+ * Every response is driven by the query string of the request, so one server covers every scenario:
+ *   latency_ms=N    sleep N ms before answering
+ *   status=N        status code to answer with (default 200)
+ *   bytes=N         size of the JSON body (default 64)
+ *   fail_rate=F     probability (0-1) of injecting a failure instead
+ *   fail_status=N   status code of injected failures (default 503)
+ *   drop=1          injected failures close the connection without answering
+ *   echo=1          answer with the request body
+ *   max_age=N       send Cache-Control: max-age=N
+ *   etag=T          send ETag: "T", and answer 304 when If-None-Match already carries it
+ *
+ * Connections are kept alive and each one is served on its own thread, so latency on one request
+ * never delays another. Not for production use.
+ */
+class FQuickHttpMockServer : public FRunnable
+{
+public:
+    virtual ~FQuickHttpMockServer();
+
+    /** Listen on Port (0 picks a free port). Returns false if the socket could not be bound. */
+    bool Start(int32 InPort = 0);
+
+    /** Stop accepting, close every connection and join all threads. */
+    void Shutdown();
+
+    bool IsRunning() const { return Listener != nullptr; }
+    int32 GetPort() const { return Port; }
+    FString GetBaseUrl() const { return FString::Printf(TEXT("http://127.0.0.1:%d"), Port); }
+
+    /** Responses sent (including injected failures) since Start. */
+    int64 GetNumServed() const { return NumServed.GetValue(); }
+
+    /** 304 answers among the responses served. */
+    int64 GetNumNotModified() const { return NumNotModified.GetValue(); }
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override { bStopping = true; }
+
+private:
+    void ServeConnection(FSocket* Socket);
+    bool ReadSome(FSocket* Socket, TArray<uint8>& Buffer) const;
+
+    FSocket* Listener = nullptr;
+    FRunnableThread* Thread = nullptr;
+    int32 Port = 0;
+    FThreadSafeBool bStopping = false;
+    FThreadSafeCounter NumConnections;
+    FThreadSafeCounter64 NumServed;
+    FThreadSafeCounter64 NumNotModified;
+};
+
+#endif
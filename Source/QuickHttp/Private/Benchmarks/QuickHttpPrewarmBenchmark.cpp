@@ -0,0 +1,179 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "QuickHttpModule.h"
+#include "Async/HttpJsonRequestAsync.h"
+#include "Benchmarks/QuickHttpBenchReport.h"
+#include "Benchmarks/QuickHttpMockServer.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "UObject/GCObject.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace QuickHttpPrewarmBenchmark
+{
+    /**
+     * Each round starts two fresh loopback servers, so neither has a pooled connection yet. The first
+     * request to one is sent cold; the other is prewarmed first. Comparing the two first-request
+     * latencies shows what warming saves (TCP only here; TLS and DNS add to it against real hosts).
+     * Game thread only.
+     */
+    class FRunner : public FGCObject
+    {
+    public:
+        FRunner(int32 InRounds, int32 InLatencyMs) : Rounds(InRounds), LatencyMs(InLatencyMs), Report(TEXT("Prewarm")) {}
+
+        void Start()
+        {
+            Report.SetParam(TEXT("rounds"), FString::FromInt(Rounds));
+            Report.SetParam(TEXT("latency_ms"), FString::FromInt(LatencyMs));
+            UE_LOG(LogQuickHttp, Display, TEXT("QuickHttp prewarm benchmark: %d rounds"), Rounds);
+            StartRound();
+        }
+
+        virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+        {
+            Collector.AddReferencedObject(InFlight);
+        }
+
+        virtual FString GetReferencerName() const override { return TEXT("QuickHttpPrewarmBenchmark"); }
+
+    private:
+        bool StartServer()
+        {
+            TUniquePtr<FQuickHttpMockServer>& Server = Servers.Add_GetRef(MakeUnique<FQuickHttpMockServer>());
+            if (Server->Start()) { return true; }
+            UE_LOG(LogQuickHttp, Error, TEXT("QuickHttp prewarm benchmark: could not start a loopback server"));
+            Finish();
+            return false;
+        }
+
+        FString BenchUrl() const
+        {
+            return Servers.Last()->GetBaseUrl() + FString::Printf(TEXT("/bench?latency_ms=%d&bytes=64"), LatencyMs);
+        }
+
+        void StartRound()
+        {
+            // Cold: first request to a server nothing has connected to yet
+            if (!StartServer()) { return; }
+            SendRequest(false);
+        }
+
+        void SendRequest(bool bWarm)
+        {
+            UHttpJsonRequestAsync* Request = UHttpJsonRequestAsync::HttpJsonRequest(nullptr, EQuickHttpMethod::GET, BenchUrl(),
+                TArray<FQuickHttpHeader>(), 10, 0, 0.01f, 64, 0, FString());
+            Request->OnFinishedNative.AddRaw(this, bWarm ? &FRunner::HandleWarmFinished : &FRunner::HandleColdFinished);
+            InFlight = Request;
+            Request->Activate();
+        }
+
+        void HandleColdFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            InFlight = nullptr;
+            Record(ColdMs, Request, Error);
+
+            // Warm: prewarm a second fresh server, then send the same first request to it
+            if (!StartServer()) { return; }
+            FQuickHttpModule::Get().GetPrewarmer().Prewarm({ Servers.Last()->GetBaseUrl() }, true,
+                [this](const TArray<FQuickHttpPrewarmResult>& Results)
+                {
+                    if (Results.Num() == 1 && Results[0].bSucceeded)
+                    {
+                        ProbeColdMs.Add(Results[0].ColdMs);
+                        ProbeWarmMs.Add(Results[0].WarmMs);
+                    }
+                    SendRequest(true);
+                });
+        }
+
+        void HandleWarmFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            InFlight = nullptr;
+            Record(WarmMs, Request, Error);
+
+            if (++Round < Rounds)
+            {
+                StartRound();
+                return;
+            }
+            Finish();
+        }
+
+        void Record(TArray<double>& Samples, UHttpJsonRequestAsync* Request, const FQuickHttpError& Error)
+        {
+            if (Error.bIsError)
+            {
+                ++Failures;
+                return;
+            }
+            Samples.Add(Request->GetRequestStats().TotalSeconds * 1000.0);
+        }
+
+        void AddRow(const FString& Name, TArray<double>& Samples)
+        {
+            Samples.Sort();
+            double Sum = 0.0;
+            for (double Sample : Samples) { Sum += Sample; }
+
+            Report.AddRow(Name);
+            Report.Set(TEXT("samples"), Samples.Num());
+            Report.Set(TEXT("mean_ms"), Samples.Num() > 0 ? Sum / Samples.Num() : 0.0);
+            Report.Set(TEXT("p50_ms"), Samples.Num() > 0 ? Samples[Samples.Num() / 2] : 0.0);
+            Report.Set(TEXT("max_ms"), Samples.Num() > 0 ? Samples.Last() : 0.0);
+        }
+
+        void Finish()
+        {
+            AddRow(TEXT("first request cold"), ColdMs);
+            AddRow(TEXT("first request prewarmed"), WarmMs);
+            AddRow(TEXT("prewarm probe cold"), ProbeColdMs);
+            AddRow(TEXT("prewarm probe warm"), ProbeWarmMs);
+            Report.SetParam(TEXT("failures"), FString::FromInt(Failures));
+            Report.Save();
+            // Deleting the runner joins the server threads; do it outside of this request's callback
+            AsyncTask(ENamedThreads::GameThread, []() { ActiveRunner.Reset(); });
+        }
+
+        int32 Rounds = 10;
+        int32 LatencyMs = 0;
+        int32 Round = 0;
+        int32 Failures = 0;
+        FQuickHttpBenchReport Report;
+        TArray<TUniquePtr<FQuickHttpMockServer>> Servers;
+        UHttpJsonRequestAsync* InFlight = nullptr;
+        TArray<double> ColdMs;
+        TArray<double> WarmMs;
+        TArray<double> ProbeColdMs;
+        TArray<double> ProbeWarmMs;
+
+    public:
+        static TUniquePtr<FRunner> ActiveRunner;
+    };
+
+    TUniquePtr<FRunner> FRunner::ActiveRunner;
+
+    static void RunPrewarm(const TArray<FString>& Args)
+    {
+        if (FRunner::ActiveRunner.IsValid())
+        {
+            UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp prewarm benchmark is already running"));
+            return;
+        }
+
+        const int32 Rounds = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 100) : 10;
+        const int32 LatencyMs = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 0;
+        FRunner::ActiveRunner = MakeUnique<FRunner>(Rounds, LatencyMs);
+        FRunner::ActiveRunner->Start();
+    }
+
+    static FAutoConsoleCommand PrewarmCommand(
+        TEXT("QuickHttp.Bench.Prewarm"),
+        TEXT("Compare cold vs prewarmed first-request latency against fresh loopback mock servers. ")
+        TEXT("Args: [Rounds=10] [LatencyMs=0]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunPrewarm));
+}
+
+#endif
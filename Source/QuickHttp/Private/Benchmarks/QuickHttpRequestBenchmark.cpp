@@ -0,0 +1,280 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpSettings.h"
+#include "Async/HttpJsonRequestAsync.h"
+#include "Benchmarks/QuickHttpBenchReport.h"
+#include "Benchmarks/QuickHttpMockServer.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "UObject/GCObject.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace QuickHttpRequestBenchmark
+{
+    /** One scenario: Count requests against the mock server with at most Concurrency in flight. */
+    struct FCase
+    {
+        FString Name;
+        FString Query;
+        int32 Count = 100;
+        int32 Concurrency = 1;
+        int32 TimeoutSeconds = 10;
+        int32 MaxRetries = 0;
+        float BackoffSeconds = 0.01f;
+    };
+
+    /**
+     * Drives the cases one after another through UHttpJsonRequestAsync, exactly as Blueprint would,
+     * with the scheduler's limits raised to each case's concurrency. Game thread only.
+     */
+    class FRunner : public FGCObject
+    {
+    public:
+        FRunner(TArray<FCase>&& InCases, int32 InPayloadKB)
+            : Cases(MoveTemp(InCases)), PayloadKB(InPayloadKB), Report(TEXT("Requests"))
+        {
+        }
+
+        bool Start()
+        {
+            if (!Server.Start())
+            {
+                UE_LOG(LogQuickHttp, Error, TEXT("QuickHttp request benchmark: could not start the loopback server"));
+                return false;
+            }
+            Report.SetParam(TEXT("server"), Server.GetBaseUrl());
+            Report.SetParam(TEXT("payload_kb"), FString::FromInt(PayloadKB));
+            UE_LOG(LogQuickHttp, Display, TEXT("QuickHttp request benchmark: %d cases against %s"), Cases.Num(), *Server.GetBaseUrl());
+            StartCase();
+            return true;
+        }
+
+        virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+        {
+            Collector.AddReferencedObjects(InFlight);
+        }
+
+        virtual FString GetReferencerName() const override { return TEXT("QuickHttpRequestBenchmark"); }
+
+    private:
+        void StartCase()
+        {
+            const FCase& Case = Cases[CaseIndex];
+            FQuickHttpModule::Get().GetScheduler().Configure(Case.Concurrency, FMath::Max(Case.Concurrency, 1));
+            Launched = 0;
+            Completed = 0;
+            Failed = 0;
+            Attempts = 0;
+            LatenciesMs.Reset(Case.Count);
+            CaseStartSeconds = FPlatformTime::Seconds();
+            LaunchMore();
+        }
+
+        void LaunchMore()
+        {
+            if (bLaunching) { return; }
+            bLaunching = true;
+            const FCase& Case = Cases[CaseIndex];
+            const FString Url = Server.GetBaseUrl() + TEXT("/bench?") + Case.Query;
+            while (InFlight.Num() < Case.Concurrency && Launched < Case.Count)
+            {
+                Launched++;
+                UHttpJsonRequestAsync* Request = UHttpJsonRequestAsync::HttpJsonRequest(nullptr, EQuickHttpMethod::GET, Url,
+                    TArray<FQuickHttpHeader>(), Case.TimeoutSeconds, Case.MaxRetries, Case.BackoffSeconds, PayloadKB + 64, 0, FString());
+                Request->OnFinishedNative.AddRaw(this, &FRunner::HandleFinished);
+                InFlight.Add(Request);
+                Request->Activate();
+            }
+            bLaunching = false;
+
+            // Everything may have finished synchronously while launching
+            if (Completed == Case.Count) { FinishCase(); }
+        }
+
+        void HandleFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            InFlight.Remove(Request);
+            const FQuickHttpRequestStats Stats = Request->GetRequestStats();
+            LatenciesMs.Add(Stats.TotalSeconds * 1000.0);
+            Attempts += Stats.Attempts;
+            Failed += Error.bIsError ? 1 : 0;
+            Completed++;
+
+            if (bLaunching) { return; }
+            if (Completed == Cases[CaseIndex].Count)
+            {
+                FinishCase();
+                return;
+            }
+            LaunchMore();
+        }
+
+        double Percentile(double P) const
+        {
+            if (LatenciesMs.Num() == 0) { return 0.0; }
+            const int32 Index = FMath::Clamp(FMath::CeilToInt(P / 100.0 * LatenciesMs.Num()) - 1, 0, LatenciesMs.Num() - 1);
+            return LatenciesMs[Index];
+        }
+
+        void FinishCase()
+        {
+            const FCase& Case = Cases[CaseIndex];
+            const double WallSeconds = FPlatformTime::Seconds() - CaseStartSeconds;
+            LatenciesMs.Sort();
+
+            Report.AddRow(Case.Name);
+            Report.Set(TEXT("requests"), Case.Count);
+            Report.Set(TEXT("concurrency"), Case.Concurrency);
+            Report.Set(TEXT("wall_s"), WallSeconds);
+            Report.Set(TEXT("req_per_s"), WallSeconds > 0.0 ? Case.Count / WallSeconds : 0.0);
+            Report.Set(TEXT("p50_ms"), Percentile(50.0));
+            Report.Set(TEXT("p90_ms"), Percentile(90.0));
+            Report.Set(TEXT("p99_ms"), Percentile(99.0));
+            Report.Set(TEXT("max_ms"), LatenciesMs.Num() > 0 ? LatenciesMs.Last() : 0.0);
+            Report.Set(TEXT("failures"), Failed);
+            Report.Set(TEXT("attempts_per_req"), Case.Count > 0 ? (double)Attempts / Case.Count : 0.0);
+
+            if (++CaseIndex < Cases.Num())
+            {
+                StartCase();
+                return;
+            }
+            Finish();
+        }
+
+        void Finish()
+        {
+            const UQuickHttpSettings* Settings = GetDefault<UQuickHttpSettings>();
+            FQuickHttpModule::Get().GetScheduler().Configure(Settings->MaxConcurrentRequestsPerHost, Settings->MaxConcurrentRequests);
+            Report.SetParam(TEXT("responses_served"), LexToString(Server.GetNumServed()));
+            Report.Save();
+            // Deleting the runner joins the server threads; do it outside of this request's callback
+            AsyncTask(ENamedThreads::GameThread, []() { ActiveRunner.Reset(); });
+        }
+
+        TArray<FCase> Cases;
+        int32 PayloadKB = 4;
+        FQuickHttpBenchReport Report;
+        FQuickHttpMockServer Server;
+        TArray<UHttpJsonRequestAsync*> InFlight;
+        TArray<double> LatenciesMs;
+        int32 CaseIndex = 0;
+        int32 Launched = 0;
+        int32 Completed = 0;
+        int32 Failed = 0;
+        int64 Attempts = 0;
+        double CaseStartSeconds = 0.0;
+        bool bLaunching = false;
+
+    public:
+        static TUniquePtr<FRunner> ActiveRunner;
+    };
+
+    TUniquePtr<FRunner> FRunner::ActiveRunner;
+
+    static void RunRequests(const TArray<FString>& Args)
+    {
+        if (FRunner::ActiveRunner.IsValid())
+        {
+            UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp request benchmark is already running"));
+            return;
+        }
+
+        const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 200;
+        TArray<FString> LevelArgs;
+        (Args.Num() > 1 ? Args[1] : FString(TEXT("1,4,16,64"))).ParseIntoArray(LevelArgs, TEXT(","), true);
+        const int32 LatencyMs = Args.Num() > 2 ? FMath::Max(0, FCString::Atoi(*Args[2])) : 20;
+        const int32 PayloadKB = Args.Num() > 3 ? FMath::Clamp(FCString::Atoi(*Args[3]), 0, 4096) : 4;
+        const FString Base = FString::Printf(TEXT("latency_ms=%d&bytes=%d"), LatencyMs, PayloadKB * 1024);
+
+        TArray<FCase> Cases;
+        for (const FString& Level : LevelArgs)
+        {
+            FCase& Case = Cases.AddDefaulted_GetRef();
+            Case.Concurrency = FMath::Max(1, FCString::Atoi(*Level));
+            Case.Name = FString::Printf(TEXT("throughput c=%d"), Case.Concurrency);
+            Case.Query = Base;
+            Case.Count = Count;
+        }
+
+        // Retry overhead: half the attempts fail and are retried with the minimum backoff
+        {
+            FCase& Case = Cases.AddDefaulted_GetRef();
+            Case.Name = TEXT("retry 50% 503");
+            Case.Query = Base + TEXT("&fail_rate=0.5");
+            Case.Concurrency = 16;
+            Case.MaxRetries = 3;
+            Case.Count = Count;
+        }
+        {
+            FCase& Case = Cases.AddDefaulted_GetRef();
+            Case.Name = TEXT("retry 50% dropped");
+            Case.Query = Base + TEXT("&fail_rate=0.5&drop=1");
+            Case.Concurrency = 16;
+            Case.MaxRetries = 3;
+            Case.Count = Count;
+        }
+        // Timeout overhead: p50 minus 1000 ms is the cost of detecting and reporting a timeout
+        {
+            FCase& Case = Cases.AddDefaulted_GetRef();
+            Case.Name = TEXT("timeout 1s");
+            Case.Query = TEXT("latency_ms=3000");
+            Case.Concurrency = 16;
+            Case.TimeoutSeconds = 1;
+            Case.Count = FMath::Min(Count, 32);
+        }
+
+        FRunner::ActiveRunner = MakeUnique<FRunner>(MoveTemp(Cases), PayloadKB);
+        if (!FRunner::ActiveRunner->Start())
+        {
+            FRunner::ActiveRunner.Reset();
+        }
+    }
+
+    static FAutoConsoleCommand RequestsCommand(
+        TEXT("QuickHttp.Bench.Requests"),
+        TEXT("Measure request throughput, latency and retry/timeout overhead against a loopback mock server. ")
+        TEXT("Args: [Count=200] [Concurrency=1,4,16,64] [LatencyMs=20] [PayloadKB=4]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunRequests));
+
+    static TUniquePtr<FQuickHttpMockServer> StandaloneServer;
+
+    static void StartServer(const TArray<FString>& Args)
+    {
+        if (!StandaloneServer.IsValid())
+        {
+            StandaloneServer = MakeUnique<FQuickHttpMockServer>();
+        }
+        const int32 Port = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0;
+        if (StandaloneServer->Start(Port))
+        {
+            UE_LOG(LogQuickHttp, Display, TEXT("QuickHttp mock server listening on %s"), *StandaloneServer->GetBaseUrl());
+        }
+        else
+        {
+            UE_LOG(LogQuickHttp, Error, TEXT("QuickHttp mock server could not listen on port %d"), Port);
+            StandaloneServer.Reset();
+        }
+    }
+
+    static void StopServer()
+    {
+        StandaloneServer.Reset();
+    }
+
+    static FAutoConsoleCommand StartServerCommand(
+        TEXT("QuickHttp.MockServer.Start"),
+        TEXT("Start the loopback mock HTTP server. Args: [Port=0 (any free port)]. ")
+        TEXT("Query parameters: latency_ms, status, bytes, fail_rate, fail_status, drop, echo."),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&StartServer));
+
+    static FAutoConsoleCommand StopServerCommand(
+        TEXT("QuickHttp.MockServer.Stop"),
+        TEXT("Stop the loopback mock HTTP server."),
+        FConsoleCommandDelegate::CreateStatic(&StopServer));
+}
+
+#endif
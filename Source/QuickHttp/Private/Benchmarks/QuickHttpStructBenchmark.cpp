@@ -0,0 +1,132 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "QuickHttpRequestKey.h"
+#include "Benchmarks/QuickHttpBenchReport.h"
+#include "Benchmarks/QuickHttpBenchTypes.h"
+#include "Json/QuickJsonBuilder.h"
+#include "Json/QuickJsonStruct.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "JsonObjectConverter.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace QuickHttpStructBenchmark
+{
+    /** Average milliseconds per call over Iterations runs. */
+    template <typename FuncType>
+    static double TimeMs(int32 Iterations, FuncType&& Func)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 i = 0; i < Iterations; ++i) { Func(); }
+        return (FPlatformTime::Seconds() - Start) * 1000.0 / Iterations;
+    }
+
+    static void Report(FQuickHttpBenchReport& Results, const TCHAR* Name, double Ms, int64 Bytes)
+    {
+        Results.AddRow(Name);
+        Results.Set(TEXT("ms"), Ms);
+        Results.Set(TEXT("mb_per_s"), Ms > 0.0 ? (Bytes / (1024.0 * 1024.0)) / (Ms / 1000.0) : 0.0);
+        Results.Set(TEXT("bytes"), (double)Bytes);
+    }
+
+    static FQuickHttpBenchPayload MakePayload(int32 NumItems)
+    {
+        FQuickHttpBenchPayload Payload;
+        Payload.Items.Reserve(NumItems);
+        for (int32 i = 0; i < NumItems; ++i)
+        {
+            FQuickHttpBenchRecord& Item = Payload.Items.AddDefaulted_GetRef();
+            Item.Id = i;
+            Item.Name = FString::Printf(TEXT("Item \"%d\" with a longer description"), i);
+            Item.Score = i * 0.37f;
+            Item.bActive = (i & 1) == 0;
+            Item.Tags = { TEXT("alpha"), TEXT("beta") };
+            Item.Pos = FVector2D(i * 1.5f, -i * 2.25f);
+        }
+        return Payload;
+    }
+
+    /** The Blueprint way of sending the same payload: fill a JSON Builder field by field and serialize it. */
+    static FString BuildWithBuilder(const FQuickHttpBenchPayload& Payload)
+    {
+        TArray<UQuickJsonBuilder*> Items;
+        Items.Reserve(Payload.Items.Num());
+        for (const FQuickHttpBenchRecord& Item : Payload.Items)
+        {
+            UQuickJsonBuilder* Pos = UQuickJsonBuilder::NewJsonBuilder()->SetNumber(TEXT("x"), (float)Item.Pos.X)->SetNumber(TEXT("y"), (float)Item.Pos.Y);
+            Items.Add(UQuickJsonBuilder::NewJsonBuilder()
+                ->SetInt(TEXT("id"), Item.Id)
+                ->SetString(TEXT("name"), Item.Name)
+                ->SetNumber(TEXT("score"), Item.Score)
+                ->SetBool(TEXT("bActive"), Item.bActive)
+                ->SetArrayString(TEXT("tags"), Item.Tags)
+                ->SetObject(TEXT("pos"), Pos));
+        }
+        return UQuickJsonBuilder::NewJsonBuilder()->SetArrayObjects(TEXT("items"), Items)->ToString(false);
+    }
+
+    static void Run(const TArray<FString>& Args)
+    {
+        const int32 NumItems = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 5000;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+
+        const FQuickHttpBenchPayload Payload = MakePayload(NumItems);
+        TArray<uint8> Bytes;
+        FString Error;
+        FQuickJsonStruct::ToBytes(Payload, Bytes, Error);
+        const int64 NumBytes = Bytes.Num();
+
+        FQuickHttpBenchReport Results(TEXT("StructJson"));
+        Results.SetParam(TEXT("items"), FString::FromInt(NumItems));
+        Results.SetParam(TEXT("iterations"), FString::FromInt(Iterations));
+
+        // Encode: every path ends with the UTF-8 bytes a request body needs
+        TArray<uint8> Out;
+        Report(Results, TEXT("Builder encode (UTF-8)"), TimeMs(Iterations, [&]()
+        {
+            FTCHARToUTF8 Utf8(*BuildWithBuilder(Payload));
+            Out.Reset();
+            Out.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        }), NumBytes);
+        Report(Results, TEXT("JsonObjectConverter encode (UTF-8)"), TimeMs(Iterations, [&]()
+        {
+            FString Text;
+            FJsonObjectConverter::UStructToJsonObjectString(Payload, Text, 0, 0, 0, nullptr, false);
+            FTCHARToUTF8 Utf8(*Text);
+            Out.Reset();
+            Out.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        }), NumBytes);
+        Report(Results, TEXT("QuickJsonStruct encode"), TimeMs(Iterations, [&]() { FQuickJsonStruct::ToBytes(Payload, Out, Error); }), NumBytes);
+        Report(Results, TEXT("QuickJsonStruct encode (cold cache)"), TimeMs(Iterations, [&]()
+        {
+            FQuickJsonStruct::ClearCache();
+            FQuickJsonStruct::ToBytes(Payload, Out, Error);
+        }), NumBytes);
+
+        // Decode: from the response bytes to a filled struct
+        FQuickHttpBenchPayload Decoded;
+        Report(Results, TEXT("JsonObjectConverter decode (UTF-8)"), TimeMs(Iterations, [&]()
+        {
+            Decoded = FQuickHttpBenchPayload();
+            FJsonObjectConverter::JsonObjectStringToUStruct(QuickHttp::Utf8BytesToString(Bytes), &Decoded, 0, 0);
+        }), NumBytes);
+        Report(Results, TEXT("QuickJsonStruct decode"), TimeMs(Iterations, [&]()
+        {
+            Decoded = FQuickHttpBenchPayload();
+            FQuickJsonStruct::FromBytes(Bytes, Decoded, Error);
+        }), NumBytes);
+
+        const bool bRoundTrip = FQuickHttpBenchPayload::StaticStruct()->CompareScriptStruct(&Payload, &Decoded, PPF_None);
+        Results.SetParam(TEXT("round_trip_equal"), bRoundTrip ? TEXT("true") : TEXT("false"));
+        Results.Save();
+    }
+
+    static FAutoConsoleCommand Command(
+        TEXT("QuickHttp.Bench.StructJson"),
+        TEXT("Compare USTRUCT <-> UTF-8 JSON through FQuickJsonStruct against the JSON Builder and FJsonObjectConverter. Args: [Items=5000] [Iterations=10]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
+
+#endif
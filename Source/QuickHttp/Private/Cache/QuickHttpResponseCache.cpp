@@ -0,0 +1,429 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Cache/QuickHttpResponseCache.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static constexpr uint32 QuickHttpCacheMagic = 0x32434851; // "QHC2"
+
+/**
+ * Second hash of the key, stored in the file to tell apart keys whose file names collide.
+ * The key text itself never goes to disk: it holds the URL and every non-credential header.
+ */
+static uint64 GetKeyCheck(const FString& Key)
+{
+    FTCHARToUTF8 Utf8(*Key);
+    return CityHash64WithSeed(Utf8.Get(), Utf8.Length(), 0x51484332ull);
+}
+
+static FQuickHttpCacheEntryPtr ParseDiskEntry(const FString& Key, const uint8* Data, int64 Size)
+{
+    FBufferReader Reader((void*)Data, Size, false);
+
+    uint32 Magic = 0;
+    uint64 StoredCheck = 0;
+    TSharedPtr<FQuickHttpCacheEntry, ESPMode::ThreadSafe> Entry = MakeShared<FQuickHttpCacheEntry, ESPMode::ThreadSafe>();
+    int32 BodySize = 0;
+
+    Reader << Magic;
+    if (Magic != QuickHttpCacheMagic) { return nullptr; }
+    Reader << StoredCheck << Entry->ETag << Entry->LastModified << Entry->ContentType;
+    Reader << Entry->StatusCode << Entry->StoredAtUnix << Entry->MaxAgeSeconds << BodySize;
+
+    // File names are hashes, so a colliding file for another key is simply ignored
+    if (Reader.IsError() || StoredCheck != GetKeyCheck(Key) || BodySize < 0 || Reader.Tell() + BodySize > Size) { return nullptr; }
+
+    Entry->Body.Append(Data + Reader.Tell(), BodySize);
+    return Entry;
+}
+
+/** Delete the oldest cache files until the directory fits in Budget. Returns the remaining size. */
+static int64 TrimDirectory(const FString& Dir, int64 Budget)
+{
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.qhc2")), true, false);
+
+    TArray<TPair<FDateTime, FString>> ByAge;
+    int64 Total = 0;
+    for (const FString& File : Files)
+    {
+        const FString Path = Dir / File;
+        Total += IFileManager::Get().FileSize(*Path);
+        ByAge.Emplace(IFileManager::Get().GetTimeStamp(*Path), Path);
+    }
+
+    ByAge.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B) { return A.Key < B.Key; });
+    for (const TPair<FDateTime, FString>& Old : ByAge)
+    {
+        if (Total <= Budget) { break; }
+        Total -= IFileManager::Get().FileSize(*Old.Value);
+        IFileManager::Get().Delete(*Old.Value, false, true, true);
+    }
+    return Total;
+}
+
+int64 FQuickHttpCacheEntry::GetSizeBytes() const
+{
+    return Body.Num() + (ETag.Len() + LastModified.Len() + ContentType.Len()) * sizeof(TCHAR) + sizeof(FQuickHttpCacheEntry);
+}
+
+void FQuickHttpResponseCache::Configure(int64 InMaxMemoryBytes, const FString& InDiskDirectory, int64 InMaxDiskBytes)
+{
+    {
+        FScopeLock ScopeLock(&Lock);
+        MaxMemoryBytes = FMath::Max<int64>(0, InMaxMemoryBytes);
+        DiskDirectory = InDiskDirectory;
+        MaxDiskBytes = FMath::Max<int64>(0, InMaxDiskBytes);
+        EvictLocked();
+    }
+
+    if (!DiskDirectory.IsEmpty())
+    {
+        IFileManager::Get().MakeDirectory(*DiskDirectory, true);
+
+        // Files of the first format stored the full request key, headers included; nothing reads them any more
+        TArray<FString> Legacy;
+        IFileManager::Get().FindFiles(Legacy, *(DiskDirectory / TEXT("*.qhc")), true, false);
+        for (const FString& File : Legacy)
+        {
+            IFileManager::Get().Delete(*(DiskDirectory / File), false, true, true);
+        }
+        TrimDiskStore();
+    }
+}
+
+EQuickHttpCacheLookup FQuickHttpResponseCache::Lookup(const FString& Key, FQuickHttpCacheEntryPtr& OutEntry)
+{
+    OutEntry.Reset();
+    {
+        FScopeLock ScopeLock(&Lock);
+        if (FSlot* Slot = Slots.Find(Key))
+        {
+            Touch(*Slot);
+            OutEntry = Slot->Entry;
+        }
+    }
+
+    if (!OutEntry.IsValid())
+    {
+        // Disk reads stay outside the lock
+        FQuickHttpCacheEntryPtr FromDisk = ReadFromDisk(Key);
+        if (FromDisk.IsValid())
+        {
+            FScopeLock ScopeLock(&Lock);
+            ++Stats.DiskHits;
+            InsertLocked(Key, FromDisk);
+            OutEntry = FromDisk;
+        }
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    if (!OutEntry.IsValid())
+    {
+        ++Stats.Misses;
+        return EQuickHttpCacheLookup::Miss;
+    }
+    if (OutEntry->IsFresh(FDateTime::UtcNow().ToUnixTimestamp()))
+    {
+        ++Stats.Hits;
+        Stats.BytesSaved += OutEntry->Body.Num();
+        return EQuickHttpCacheLookup::Fresh;
+    }
+    if (!OutEntry->HasValidator())
+    {
+        OutEntry.Reset();
+        ++Stats.Misses;
+        return EQuickHttpCacheLookup::Miss;
+    }
+    return EQuickHttpCacheLookup::Stale;
+}
+
+void FQuickHttpResponseCache::Store(const FString& Key, FQuickHttpCacheEntry&& Entry)
+{
+    FQuickHttpCacheEntryPtr Shared = MakeShared<FQuickHttpCacheEntry, ESPMode::ThreadSafe>(MoveTemp(Entry));
+    if (Shared->GetSizeBytes() > MaxMemoryBytes) { return; }
+
+    FScopeLock ScopeLock(&Lock);
+    InsertLocked(Key, Shared);
+    EvictLocked();
+}
+
+FQuickHttpCacheEntryPtr FQuickHttpResponseCache::Revalidate(const FString& Key, const FQuickHttpCacheEntryPtr& Stale, int32 MaxAgeSeconds, const FString& NewETag)
+{
+    if (!Stale.IsValid()) { return nullptr; }
+
+    FScopeLock ScopeLock(&Lock);
+    TSharedPtr<FQuickHttpCacheEntry, ESPMode::ThreadSafe> Renewed = MakeShared<FQuickHttpCacheEntry, ESPMode::ThreadSafe>(*Stale);
+    Renewed->StoredAtUnix = FDateTime::UtcNow().ToUnixTimestamp();
+    Renewed->MaxAgeSeconds = MaxAgeSeconds;
+    if (!NewETag.IsEmpty()) { Renewed->ETag = NewETag; }
+
+    InsertLocked(Key, Renewed);
+    EvictLocked();
+    ++Stats.Revalidations;
+    Stats.BytesSaved += Renewed->Body.Num();
+    return Renewed;
+}
+
+void FQuickHttpResponseCache::NoteMiss()
+{
+    FScopeLock ScopeLock(&Lock);
+    ++Stats.Misses;
+}
+
+void FQuickHttpResponseCache::Flush()
+{
+    if (DiskDirectory.IsEmpty()) { return; }
+
+    TArray<TPair<FString, FQuickHttpCacheEntryPtr>> Pending;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Pending.Reserve(Slots.Num());
+        for (const TPair<FString, FSlot>& Pair : Slots)
+        {
+            Pending.Emplace(Pair.Key, Pair.Value.Entry);
+        }
+    }
+
+    for (const TPair<FString, FQuickHttpCacheEntryPtr>& Pair : Pending)
+    {
+        WriteToDisk(DiskDirectory, Pair.Key, *Pair.Value);
+    }
+    TrimDiskStore();
+}
+
+void FQuickHttpResponseCache::Clear()
+{
+    FScopeLock ScopeLock(&Lock);
+    Slots.Empty();
+    Lru.Empty();
+    MemoryBytes = 0;
+    if (!DiskDirectory.IsEmpty())
+    {
+        IFileManager::Get().DeleteDirectory(*DiskDirectory, false, true);
+        IFileManager::Get().MakeDirectory(*DiskDirectory, true);
+        DiskBytes = 0;
+    }
+    DiskIndex.Reset();
+}
+
+FQuickHttpCacheStats FQuickHttpResponseCache::GetStats() const
+{
+    FScopeLock ScopeLock(&Lock);
+    FQuickHttpCacheStats Out = Stats;
+    Out.Entries = Slots.Num();
+    Out.MemoryBytes = MemoryBytes;
+    return Out;
+}
+
+bool FQuickHttpResponseCache::ParseCacheControl(const FString& Header, int32& OutMaxAgeSeconds, bool* bOutPublic)
+{
+    OutMaxAgeSeconds = 0;
+    if (bOutPublic) { *bOutPublic = false; }
+    bool bNoCache = false;
+
+    TArray<FString> Directives;
+    Header.ParseIntoArray(Directives, TEXT(","), true);
+    for (FString& Directive : Directives)
+    {
+        Directive.TrimStartAndEndInline();
+        // "private" may carry a field list (private="set-cookie"); any form keeps the response out of a shared store
+        if (Directive.Equals(TEXT("no-store"), ESearchCase::IgnoreCase)
+            || Directive.Equals(TEXT("private"), ESearchCase::IgnoreCase)
+            || Directive.StartsWith(TEXT("private="), ESearchCase::IgnoreCase))
+        {
+            return false;
+        }
+        if (Directive.Equals(TEXT("no-cache"), ESearchCase::IgnoreCase))
+        {
+            bNoCache = true;
+        }
+        else if (Directive.Equals(TEXT("public"), ESearchCase::IgnoreCase))
+        {
+            if (bOutPublic) { *bOutPublic = true; }
+        }
+        else if (Directive.StartsWith(TEXT("max-age="), ESearchCase::IgnoreCase))
+        {
+            OutMaxAgeSeconds = FMath::Max(0, FCString::Atoi(*Directive.Mid(8)));
+        }
+    }
+
+    if (bNoCache) { OutMaxAgeSeconds = 0; }
+    return true;
+}
+
+void FQuickHttpResponseCache::Touch(FSlot& Slot)
+{
+    Lru.RemoveNode(Slot.LruNode, false);
+    Lru.AddHead(Slot.LruNode);
+}
+
+void FQuickHttpResponseCache::InsertLocked(const FString& Key, const FQuickHttpCacheEntryPtr& Entry)
+{
+    RemoveLocked(Key);
+
+    Lru.AddHead(Key);
+    FSlot& Slot = Slots.Add(Key);
+    Slot.Entry = Entry;
+    Slot.LruNode = Lru.GetHead();
+    MemoryBytes += Entry->GetSizeBytes();
+}
+
+void FQuickHttpResponseCache::RemoveLocked(const FString& Key)
+{
+    FSlot Slot;
+    if (Slots.RemoveAndCopyValue(Key, Slot))
+    {
+        Lru.RemoveNode(Slot.LruNode);
+        MemoryBytes -= Slot.Entry->GetSizeBytes();
+    }
+}
+
+void FQuickHttpResponseCache::EvictLocked()
+{
+    while (MemoryBytes > MaxMemoryBytes && Lru.GetTail())
+    {
+        const FString Key = Lru.GetTail()->GetValue();
+        if (const FSlot* Slot = Slots.Find(Key))
+        {
+            SpillLocked(Key, Slot->Entry);
+        }
+        RemoveLocked(Key);
+        ++Stats.Evictions;
+    }
+}
+
+void FQuickHttpResponseCache::SpillLocked(const FString& Key, const FQuickHttpCacheEntryPtr& Entry)
+{
+    if (DiskDirectory.IsEmpty() || MaxDiskBytes <= 0) { return; }
+
+    // Entries are immutable, so the write can run on a worker without holding the lock
+    const FString Directory = DiskDirectory;
+    DiskIndex.Add(GetDiskHash(Key));
+    Async(EAsyncExecution::ThreadPool, [Directory, Key, Entry]()
+    {
+        WriteToDisk(Directory, Key, *Entry);
+    });
+
+    DiskBytes += Entry->GetSizeBytes();
+    if (DiskBytes > MaxDiskBytes)
+    {
+        const FString Dir = DiskDirectory;
+        const int64 Budget = MaxDiskBytes;
+        DiskBytes = Budget;
+        Async(EAsyncExecution::ThreadPool, [Dir, Budget]()
+        {
+            TrimDirectory(Dir, Budget);
+        });
+    }
+}
+
+FQuickHttpCacheEntryPtr FQuickHttpResponseCache::ReadFromDisk(const FString& Key)
+{
+    const uint64 Hash = GetDiskHash(Key);
+    FString Path;
+    {
+        // Keys that were never spilled are the common miss; answer those without a file system call
+        FScopeLock ScopeLock(&Lock);
+        if (DiskDirectory.IsEmpty() || !DiskIndex.Contains(Hash)) { return nullptr; }
+        Path = GetDiskPath(DiskDirectory, Key);
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Path))
+    {
+        // Trimmed since it was indexed
+        FScopeLock ScopeLock(&Lock);
+        DiskIndex.Remove(Hash);
+        return nullptr;
+    }
+
+    // Map the file instead of reading it through a temporary buffer; the region is released before the handle
+    TUniquePtr<IMappedFileHandle> Handle(PlatformFile.OpenMapped(*Path));
+    if (Handle.IsValid())
+    {
+        TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(0, Handle->GetFileSize()));
+        if (Region.IsValid())
+        {
+            return ParseDiskEntry(Key, Region->GetMappedPtr(), Region->GetMappedSize());
+        }
+    }
+
+    TArray<uint8> Raw;
+    if (FFileHelper::LoadFileToArray(Raw, *Path, FILEREAD_Silent))
+    {
+        return ParseDiskEntry(Key, Raw.GetData(), Raw.Num());
+    }
+    return nullptr;
+}
+
+void FQuickHttpResponseCache::TrimDiskStore()
+{
+    FString Dir;
+    int64 Budget = 0;
+    {
+        FScopeLock ScopeLock(&Lock);
+        Dir = DiskDirectory;
+        Budget = MaxDiskBytes;
+    }
+    if (Dir.IsEmpty()) { return; }
+
+    const int64 Total = TrimDirectory(Dir, Budget);
+
+    // Rebuild the index from what is left, including files written by earlier sessions
+    TArray<FString> Files;
+    IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.qhc2")), true, false);
+    TSet<uint64> Index;
+    Index.Reserve(Files.Num());
+    for (const FString& File : Files)
+    {
+        Index.Add(FCString::Strtoui64(*FPaths::GetBaseFilename(File), nullptr, 16));
+    }
+
+    FScopeLock ScopeLock(&Lock);
+    DiskBytes = Total;
+    // Spills that raced the scan are not lost
+    DiskIndex.Append(Index);
+}
+
+uint64 FQuickHttpResponseCache::GetDiskHash(const FString& Key)
+{
+    FTCHARToUTF8 Utf8(*Key);
+    return CityHash64(Utf8.Get(), Utf8.Length());
+}
+
+FString FQuickHttpResponseCache::GetDiskPath(const FString& Directory, const FString& Key)
+{
+    return Directory / FString::Printf(TEXT("%016llx.qhc2"), GetDiskHash(Key));
+}
+
+bool FQuickHttpResponseCache::WriteToDisk(const FString& Directory, const FString& Key, const FQuickHttpCacheEntry& Entry)
+{
+    TArray<uint8> Data;
+    Data.Reserve(Entry.Body.Num() + 256);
+    FMemoryWriter Writer(Data);
+
+    uint32 Magic = QuickHttpCacheMagic;
+    uint64 KeyCheck = GetKeyCheck(Key);
+    FString ETag = Entry.ETag;
+    FString LastModified = Entry.LastModified;
+    FString ContentType = Entry.ContentType;
+    int32 StatusCode = Entry.StatusCode;
+    int64 StoredAtUnix = Entry.StoredAtUnix;
+    int32 MaxAgeSeconds = Entry.MaxAgeSeconds;
+    int32 BodySize = Entry.Body.Num();
+
+    Writer << Magic << KeyCheck << ETag << LastModified << ContentType;
+    Writer << StatusCode << StoredAtUnix << MaxAgeSeconds << BodySize;
+    Data.Append(Entry.Body);
+
+    return FFileHelper::SaveArrayToFile(Data, *GetDiskPath(Directory, Key));
+}
@@ -0,0 +1,119 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Compression/QuickHttpCompression.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+    // Output is grown (and checked against the limit) this much at a time
+    constexpr int64 InflateChunkBytes = 64 * 1024;
+
+    EQuickHttpDecodeResult Inflate(TArrayView<const uint8> In, int32 WindowBits, bool bRequireAllInput, int64 MaxOutputBytes, TArray<uint8>& Out)
+    {
+        z_stream Stream;
+        FMemory::Memzero(Stream);
+        if (inflateInit2(&Stream, WindowBits) != Z_OK) { return EQuickHttpDecodeResult::Corrupt; }
+        Stream.next_in = const_cast<Bytef*>(In.GetData());
+        Stream.avail_in = (uInt)In.Num();
+
+        // One byte past the limit is enough to prove the body is too large
+        const int64 Limit = MaxOutputBytes + 1;
+        int64 Produced = 0;
+        Out.Reset((int32)FMath::Min<int64>((int64)In.Num() * 4, Limit));
+
+        EQuickHttpDecodeResult Result = EQuickHttpDecodeResult::Corrupt;
+        while (true)
+        {
+            if (Produced >= Limit)
+            {
+                Result = EQuickHttpDecodeResult::TooLarge;
+                break;
+            }
+            const int64 Chunk = FMath::Min(InflateChunkBytes, Limit - Produced);
+            Out.SetNumUninitialized((int32)(Produced + Chunk));
+            Stream.next_out = Out.GetData() + Produced;
+            Stream.avail_out = (uInt)Chunk;
+
+            const int Ret = inflate(&Stream, Z_NO_FLUSH);
+            Produced += Chunk - Stream.avail_out;
+            if (Ret == Z_STREAM_END)
+            {
+                if (Produced > MaxOutputBytes) { Result = EQuickHttpDecodeResult::TooLarge; }
+                else if (!bRequireAllInput || Stream.avail_in == 0) { Result = EQuickHttpDecodeResult::Decoded; }
+                break;
+            }
+            // Z_BUF_ERROR here means the input ran out before the end of the stream (truncated body)
+            if (Ret != Z_OK) { break; }
+        }
+        inflateEnd(&Stream);
+
+        Out.SetNum(Result == EQuickHttpDecodeResult::Decoded ? (int32)Produced : 0);
+        return Result;
+    }
+
+    bool HasZlibHeader(TArrayView<const uint8> In)
+    {
+        return In.Num() >= 2 && (In[0] & 0x0F) == Z_DEFLATED && ((In[0] << 8) | In[1]) % 31 == 0;
+    }
+}
+
+bool FQuickHttpCompression::GzipCompress(TArrayView<const uint8> In, TArray<uint8>& Out, int32 Level)
+{
+    z_stream Stream;
+    FMemory::Memzero(Stream);
+    if (deflateInit2(&Stream, FMath::Clamp(Level, 1, 9), Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return false;
+    }
+
+    Out.SetNumUninitialized((int32)deflateBound(&Stream, (uLong)In.Num()));
+    Stream.next_in = const_cast<Bytef*>(In.GetData());
+    Stream.avail_in = (uInt)In.Num();
+    Stream.next_out = Out.GetData();
+    Stream.avail_out = (uInt)Out.Num();
+
+    const int Ret = deflate(&Stream, Z_FINISH);
+    const int32 Written = (int32)Stream.total_out;
+    deflateEnd(&Stream);
+
+    if (Ret != Z_STREAM_END)
+    {
+        Out.Reset();
+        return false;
+    }
+    Out.SetNum(Written);
+    return true;
+}
+
+EQuickHttpDecodeResult FQuickHttpCompression::Decode(const FString& ContentEncoding, TArrayView<const uint8> In, int64 MaxOutputBytes, TArray<uint8>& Out)
+{
+    const FString Encoding = ContentEncoding.TrimStartAndEnd();
+    if (Encoding.IsEmpty() || Encoding.Equals(TEXT("identity"), ESearchCase::IgnoreCase) || In.Num() == 0)
+    {
+        return EQuickHttpDecodeResult::Identity;
+    }
+
+    if (Encoding.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Encoding.Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase))
+    {
+        // No gzip magic: the transport (e.g. libcurl) already inflated it and left the header in place
+        if (In.Num() < 2 || In[0] != 0x1f || In[1] != 0x8b) { return EQuickHttpDecodeResult::Identity; }
+        return Inflate(In, 16 + MAX_WBITS, false, MaxOutputBytes, Out);
+    }
+
+    if (Encoding.Equals(TEXT("deflate"), ESearchCase::IgnoreCase))
+    {
+        if (HasZlibHeader(In))
+        {
+            return Inflate(In, MAX_WBITS, false, MaxOutputBytes, Out);
+        }
+        // Some servers send raw deflate without the zlib wrapper. Only trust it if it decodes
+        // cleanly to the last byte; anything else is a body the transport already decoded.
+        const EQuickHttpDecodeResult Raw = Inflate(In, -MAX_WBITS, true, MaxOutputBytes, Out);
+        return Raw == EQuickHttpDecodeResult::Corrupt ? EQuickHttpDecodeResult::Identity : Raw;
+    }
+
+    return EQuickHttpDecodeResult::Unsupported;
+}
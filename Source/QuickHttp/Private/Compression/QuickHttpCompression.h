@@ -0,0 +1,39 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** Outcome of decoding a response body. */
+enum class EQuickHttpDecodeResult : uint8
+{
+    /** Nothing to do: no Content-Encoding, or the transport already decoded the body. */
+    Identity,
+    Decoded,
+    /** Decoded size would exceed the caller's limit; decoding stopped at the limit. */
+    TooLarge,
+    Corrupt,
+    Unsupported
+};
+
+/**
+ * gzip / deflate codecs for HTTP bodies, built on the engine's zlib.
+ * Brotli is not offered: the engine ships no brotli decoder, so "br" is never advertised.
+ * Thread-safe (no shared state).
+ */
+class FQuickHttpCompression
+{
+public:
+    /** Accept-Encoding value for the codecs this class can decode. */
+    static const TCHAR* GetAcceptEncoding() { return TEXT("gzip, deflate"); }
+
+    /** gzip In into Out. Returns false if zlib fails. */
+    static bool GzipCompress(TArrayView<const uint8> In, TArray<uint8>& Out, int32 Level = 6);
+
+    /**
+     * Decode In according to a Content-Encoding header value.
+     * Inflates in fixed-size chunks and stops as soon as the output passes MaxOutputBytes, so a
+     * small compressed bomb never expands past the limit. Bodies whose bytes do not carry the
+     * codec's header were already decoded by the platform HTTP layer and report Identity.
+     */
+    static EQuickHttpDecodeResult Decode(const FString& ContentEncoding, TArrayView<const uint8> In, int64 MaxOutputBytes, TArray<uint8>& Out);
+};
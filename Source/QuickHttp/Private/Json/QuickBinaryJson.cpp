@@ -0,0 +1,754 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickBinaryJson.h"
+#include "Json/QuickJsonWriter.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include <cmath>
+
+namespace
+{
+    /** Exact integers in int64 range go out as integers. */
+    bool AsInteger(double Value, int64& Out)
+    {
+        if (!(Value >= -9223372036854775808.0 && Value < 9223372036854775808.0)) { return false; }
+        const int64 Integer = (int64)Value;
+        if ((double)Integer != Value) { return false; }
+        Out = Integer;
+        return true;
+    }
+
+    void AppendBigEndian(TArray<uint8>& Out, uint64 Value, int32 NumBytes)
+    {
+        const int32 At = Out.AddUninitialized(NumBytes);
+        uint8* Dest = Out.GetData() + At;
+        for (int32 i = NumBytes - 1; i >= 0; --i)
+        {
+            Dest[i] = (uint8)Value;
+            Value >>= 8;
+        }
+    }
+
+    void AppendFloat(TArray<uint8>& Out, uint8 Marker32, uint8 Marker64, double Value)
+    {
+        const float Single = (float)Value;
+        if ((double)Single == Value)
+        {
+            uint32 Bits;
+            FMemory::Memcpy(&Bits, &Single, sizeof(Bits));
+            Out.Add(Marker32);
+            AppendBigEndian(Out, Bits, 4);
+            return;
+        }
+        uint64 Bits;
+        FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+        Out.Add(Marker64);
+        AppendBigEndian(Out, Bits, 8);
+    }
+
+    void WriteJson(FQuickJsonWriter& Writer, const TSharedPtr<FJsonValue>& Value)
+    {
+        if (!Value.IsValid()) { Writer.Null(); return; }
+        switch (Value->Type)
+        {
+        case EJson::String:
+            Writer.String(Value->AsString());
+            return;
+        case EJson::Number:
+        {
+            const double Number = Value->AsNumber();
+            int64 Integer;
+            if (AsInteger(Number, Integer)) { Writer.Int(Integer); } else { Writer.Number(Number); }
+            return;
+        }
+        case EJson::Boolean:
+            Writer.Bool(Value->AsBool());
+            return;
+        case EJson::Array:
+            Writer.BeginArray();
+            for (const TSharedPtr<FJsonValue>& Element : Value->AsArray()) { WriteJson(Writer, Element); }
+            Writer.EndArray();
+            return;
+        case EJson::Object:
+        {
+            const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+            if (!Object.IsValid()) { Writer.Null(); return; }
+            Writer.BeginObject();
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+            {
+                Writer.Key(Field.Key);
+                WriteJson(Writer, Field.Value);
+            }
+            Writer.EndObject();
+            return;
+        }
+        default:
+            Writer.Null();
+            return;
+        }
+    }
+
+    /** Shared by both binary encoders: walks the tree and asks Derived for the type-specific heads. */
+    template <typename Derived>
+    class TBinaryEncoder
+    {
+    public:
+        explicit TBinaryEncoder(TArray<uint8>& InOut) : Out(InOut) {}
+
+        void Write(const TSharedPtr<FJsonValue>& Value)
+        {
+            Derived& Self = static_cast<Derived&>(*this);
+            if (!Value.IsValid()) { Self.WriteNull(); return; }
+            switch (Value->Type)
+            {
+            case EJson::String:
+                WriteString(Value->AsString());
+                return;
+            case EJson::Number:
+                Self.WriteNumber(Value->AsNumber());
+                return;
+            case EJson::Boolean:
+                Self.WriteBool(Value->AsBool());
+                return;
+            case EJson::Array:
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+                Self.WriteArrayHead(Elements.Num());
+                for (const TSharedPtr<FJsonValue>& Element : Elements) { Write(Element); }
+                return;
+            }
+            case EJson::Object:
+            {
+                const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+                if (!Object.IsValid()) { Self.WriteNull(); return; }
+                Self.WriteMapHead(Object->Values.Num());
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+                {
+                    WriteString(Field.Key);
+                    Write(Field.Value);
+                }
+                return;
+            }
+            default:
+                Self.WriteNull();
+                return;
+            }
+        }
+
+    protected:
+        void WriteString(const FString& Value)
+        {
+            FTCHARToUTF8 Utf8(*Value, Value.Len());
+            static_cast<Derived&>(*this).WriteStringHead(Utf8.Length());
+            Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+        }
+
+        TArray<uint8>& Out;
+    };
+
+    class FMessagePackEncoder : public TBinaryEncoder<FMessagePackEncoder>
+    {
+    public:
+        using TBinaryEncoder::TBinaryEncoder;
+
+        void WriteNull() { Out.Add(0xc0); }
+        void WriteBool(bool bValue) { Out.Add(bValue ? 0xc3 : 0xc2); }
+
+        void WriteNumber(double Value)
+        {
+            int64 Integer;
+            if (!AsInteger(Value, Integer))
+            {
+                AppendFloat(Out, 0xca, 0xcb, Value);
+                return;
+            }
+            if (Integer >= 0)
+            {
+                if (Integer < 128)              { Out.Add((uint8)Integer); }
+                else if (Integer <= 0xff)       { Out.Add(0xcc); AppendBigEndian(Out, Integer, 1); }
+                else if (Integer <= 0xffff)     { Out.Add(0xcd); AppendBigEndian(Out, Integer, 2); }
+                else if (Integer <= 0xffffffff) { Out.Add(0xce); AppendBigEndian(Out, Integer, 4); }
+                else                            { Out.Add(0xcf); AppendBigEndian(Out, Integer, 8); }
+                return;
+            }
+            if (Integer >= -32)                { Out.Add((uint8)(int8)Integer); }
+            else if (Integer >= MIN_int8)      { Out.Add(0xd0); AppendBigEndian(Out, (uint64)Integer, 1); }
+            else if (Integer >= MIN_int16)     { Out.Add(0xd1); AppendBigEndian(Out, (uint64)Integer, 2); }
+            else if (Integer >= MIN_int32)     { Out.Add(0xd2); AppendBigEndian(Out, (uint64)Integer, 4); }
+            else                               { Out.Add(0xd3); AppendBigEndian(Out, (uint64)Integer, 8); }
+        }
+
+        void WriteStringHead(int32 Len)
+        {
+            if (Len < 32)           { Out.Add((uint8)(0xa0 | Len)); }
+            else if (Len <= 0xff)   { Out.Add(0xd9); AppendBigEndian(Out, Len, 1); }
+            else if (Len <= 0xffff) { Out.Add(0xda); AppendBigEndian(Out, Len, 2); }
+            else                    { Out.Add(0xdb); AppendBigEndian(Out, Len, 4); }
+        }
+
+        void WriteArrayHead(int32 Num)
+        {
+            if (Num < 16)           { Out.Add((uint8)(0x90 | Num)); }
+            else if (Num <= 0xffff) { Out.Add(0xdc); AppendBigEndian(Out, Num, 2); }
+            else                    { Out.Add(0xdd); AppendBigEndian(Out, Num, 4); }
+        }
+
+        void WriteMapHead(int32 Num)
+        {
+            if (Num < 16)           { Out.Add((uint8)(0x80 | Num)); }
+            else if (Num <= 0xffff) { Out.Add(0xde); AppendBigEndian(Out, Num, 2); }
+            else                    { Out.Add(0xdf); AppendBigEndian(Out, Num, 4); }
+        }
+    };
+
+    class FCborEncoder : public TBinaryEncoder<FCborEncoder>
+    {
+    public:
+        using TBinaryEncoder::TBinaryEncoder;
+
+        void WriteNull() { Out.Add(0xf6); }
+        void WriteBool(bool bValue) { Out.Add(bValue ? 0xf5 : 0xf4); }
+
+        void WriteNumber(double Value)
+        {
+            int64 Integer;
+            if (!AsInteger(Value, Integer))
+            {
+                AppendFloat(Out, 0xfa, 0xfb, Value);
+                return;
+            }
+            // Major type 1 stores -1 - N, which cannot overflow for any negative int64
+            if (Integer >= 0) { WriteHead(0, (uint64)Integer); } else { WriteHead(1, (uint64)(-1 - Integer)); }
+        }
+
+        void WriteStringHead(int32 Len) { WriteHead(3, Len); }
+        void WriteArrayHead(int32 Num) { WriteHead(4, Num); }
+        void WriteMapHead(int32 Num) { WriteHead(5, Num); }
+
+    private:
+        void WriteHead(uint8 Major, uint64 Argument)
+        {
+            const uint8 Type = (uint8)(Major << 5);
+            if (Argument < 24)               { Out.Add(Type | (uint8)Argument); }
+            else if (Argument <= 0xff)       { Out.Add(Type | 24); AppendBigEndian(Out, Argument, 1); }
+            else if (Argument <= 0xffff)     { Out.Add(Type | 25); AppendBigEndian(Out, Argument, 2); }
+            else if (Argument <= 0xffffffff) { Out.Add(Type | 26); AppendBigEndian(Out, Argument, 4); }
+            else                             { Out.Add(Type | 27); AppendBigEndian(Out, Argument, 8); }
+        }
+    };
+
+    /** Bounds-checked cursor shared by both decoders. The first error stops decoding. */
+    class FBinaryReader
+    {
+    public:
+        explicit FBinaryReader(TArrayView<const uint8> InBytes) : Data(InBytes.GetData()), Num(InBytes.Num()) {}
+
+        bool Fail(const FString& Message)
+        {
+            if (Error.IsEmpty()) { Error = FString::Printf(TEXT("%s at byte %d"), *Message, Pos); }
+            return false;
+        }
+
+        bool Need(uint64 Count)
+        {
+            return Count <= (uint64)(Num - Pos) ? true : Fail(TEXT("Unexpected end of data"));
+        }
+
+        bool ReadBigEndian(int32 NumBytes, uint64& Out)
+        {
+            if (!Need(NumBytes)) { return false; }
+            Out = 0;
+            for (int32 i = 0; i < NumBytes; ++i) { Out = (Out << 8) | Data[Pos++]; }
+            return true;
+        }
+
+        bool ReadString(uint64 Len, FString& Out)
+        {
+            if (!Need(Len)) { return false; }
+            if (Len > 0)
+            {
+                FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Pos), (int32)Len);
+                Out = FString(Converted.Length(), Converted.Get());
+            }
+            Pos += (int32)Len;
+            return true;
+        }
+
+        bool ReadBase64(uint64 Len, FString& Out)
+        {
+            if (!Need(Len)) { return false; }
+            Out = FBase64::Encode(Data + Pos, (uint32)Len);
+            Pos += (int32)Len;
+            return true;
+        }
+
+        /** Each element takes at least one byte, so larger counts are malformed and never allocated. */
+        bool CheckCount(uint64 Count, uint64 BytesPerItem)
+        {
+            return Count <= (uint64)(Num - Pos) / BytesPerItem ? true : Fail(TEXT("Container length exceeds the data"));
+        }
+
+        static TSharedPtr<FJsonValue> MakeNumber(double Value)
+        {
+            if (!FMath::IsFinite(Value)) { return MakeShared<FJsonValueNull>(); }
+            return MakeShared<FJsonValueNumber>(Value);
+        }
+
+        static FString KeyFromValue(const TSharedPtr<FJsonValue>& Key)
+        {
+            int64 Integer;
+            const double Number = Key->AsNumber();
+            return AsInteger(Number, Integer) ? FString::Printf(TEXT("%lld"), (long long)Integer) : FString::SanitizeFloat(Number);
+        }
+
+        const uint8* Data;
+        int32 Num;
+        int32 Pos = 0;
+        FString Error;
+    };
+
+    class FMessagePackDecoder : public FBinaryReader
+    {
+    public:
+        using FBinaryReader::FBinaryReader;
+
+        bool Read(TSharedPtr<FJsonValue>& Out, int32 Depth)
+        {
+            if (!Need(1)) { return false; }
+            const uint8 Marker = Data[Pos++];
+
+            if (Marker <= 0x7f) { Out = MakeShared<FJsonValueNumber>(Marker); return true; }
+            if (Marker >= 0xe0) { Out = MakeShared<FJsonValueNumber>((int8)Marker); return true; }
+            if (Marker <= 0x8f) { return ReadMap(Marker & 0x0f, Out, Depth); }
+            if (Marker <= 0x9f) { return ReadArray(Marker & 0x0f, Out, Depth); }
+            if (Marker <= 0xbf) { return ReadStringValue(Marker & 0x1f, Out); }
+
+            uint64 Raw = 0;
+            switch (Marker)
+            {
+            case 0xc0: Out = MakeShared<FJsonValueNull>(); return true;
+            case 0xc2: Out = MakeShared<FJsonValueBoolean>(false); return true;
+            case 0xc3: Out = MakeShared<FJsonValueBoolean>(true); return true;
+            case 0xc4: case 0xc5: case 0xc6:
+            {
+                FString Encoded;
+                if (!ReadBigEndian(1 << (Marker - 0xc4), Raw) || !ReadBase64(Raw, Encoded)) { return false; }
+                Out = MakeShared<FJsonValueString>(Encoded);
+                return true;
+            }
+            case 0xca:
+            {
+                if (!ReadBigEndian(4, Raw)) { return false; }
+                const uint32 Bits = (uint32)Raw;
+                float Value;
+                FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+                Out = MakeNumber(Value);
+                return true;
+            }
+            case 0xcb:
+            {
+                if (!ReadBigEndian(8, Raw)) { return false; }
+                double Value;
+                FMemory::Memcpy(&Value, &Raw, sizeof(Value));
+                Out = MakeNumber(Value);
+                return true;
+            }
+            case 0xcc: case 0xcd: case 0xce: case 0xcf:
+                if (!ReadBigEndian(1 << (Marker - 0xcc), Raw)) { return false; }
+                Out = MakeShared<FJsonValueNumber>((double)Raw);
+                return true;
+            case 0xd0: if (!ReadBigEndian(1, Raw)) { return false; } Out = MakeShared<FJsonValueNumber>((int8)Raw); return true;
+            case 0xd1: if (!ReadBigEndian(2, Raw)) { return false; } Out = MakeShared<FJsonValueNumber>((int16)Raw); return true;
+            case 0xd2: if (!ReadBigEndian(4, Raw)) { return false; } Out = MakeShared<FJsonValueNumber>((int32)Raw); return true;
+            case 0xd3: if (!ReadBigEndian(8, Raw)) { return false; } Out = MakeShared<FJsonValueNumber>((double)(int64)Raw); return true;
+            case 0xd9: case 0xda: case 0xdb:
+                return ReadBigEndian(1 << (Marker - 0xd9), Raw) && ReadStringValue(Raw, Out);
+            case 0xdc: case 0xdd:
+                return ReadBigEndian(Marker == 0xdc ? 2 : 4, Raw) && ReadArray(Raw, Out, Depth);
+            case 0xde: case 0xdf:
+                return ReadBigEndian(Marker == 0xde ? 2 : 4, Raw) && ReadMap(Raw, Out, Depth);
+            default:
+                // 0xc1 is never used; extension types have no JSON equivalent
+                --Pos;
+                return Fail(FString::Printf(TEXT("Unsupported type 0x%02x"), Marker));
+            }
+        }
+
+    private:
+        bool ReadStringValue(uint64 Len, TSharedPtr<FJsonValue>& Out)
+        {
+            FString Value;
+            if (!ReadString(Len, Value)) { return false; }
+            Out = MakeShared<FJsonValueString>(Value);
+            return true;
+        }
+
+        bool ReadArray(uint64 Count, TSharedPtr<FJsonValue>& Out, int32 Depth)
+        {
+            if (Depth >= FQuickBinaryJson::MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+            if (!CheckCount(Count, 1)) { return false; }
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            Elements.SetNum((int32)Count);
+            for (TSharedPtr<FJsonValue>& Element : Elements)
+            {
+                if (!Read(Element, Depth + 1)) { return false; }
+            }
+            Out = MakeShared<FJsonValueArray>(Elements);
+            return true;
+        }
+
+        bool ReadMap(uint64 Count, TSharedPtr<FJsonValue>& Out, int32 Depth)
+        {
+            if (Depth >= FQuickBinaryJson::MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+            if (!CheckCount(Count, 2)) { return false; }
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            Object->Values.Reserve((int32)Count);
+            for (uint64 i = 0; i < Count; ++i)
+            {
+                FString Key;
+                TSharedPtr<FJsonValue> Value;
+                if (!ReadKey(Key, Depth) || !Read(Value, Depth + 1)) { return false; }
+                Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+            }
+            Out = MakeShared<FJsonValueObject>(Object);
+            return true;
+        }
+
+        bool ReadKey(FString& Out, int32 Depth)
+        {
+            if (!Need(1)) { return false; }
+            const uint8 Marker = Data[Pos];
+            uint64 Len = 0;
+            if (Marker >= 0xa0 && Marker <= 0xbf)
+            {
+                ++Pos;
+                return ReadString(Marker & 0x1f, Out);
+            }
+            if (Marker >= 0xd9 && Marker <= 0xdb)
+            {
+                ++Pos;
+                return ReadBigEndian(1 << (Marker - 0xd9), Len) && ReadString(Len, Out);
+            }
+
+            TSharedPtr<FJsonValue> Key;
+            if (!Read(Key, Depth + 1)) { return false; }
+            if (Key->Type != EJson::Number) { return Fail(TEXT("Map keys must be strings or numbers")); }
+            Out = KeyFromValue(Key);
+            return true;
+        }
+    };
+
+    class FCborDecoder : public FBinaryReader
+    {
+    public:
+        using FBinaryReader::FBinaryReader;
+
+        bool Read(TSharedPtr<FJsonValue>& Out, int32 Depth)
+        {
+            if (!Need(1)) { return false; }
+            const uint8 Initial = Data[Pos++];
+            const uint8 Major = Initial >> 5;
+            const uint8 Info = Initial & 0x1f;
+
+            if (Major == 7) { return ReadSimple(Info, Out); }
+
+            uint64 Argument = 0;
+            bool bIndefinite = false;
+            if (!ReadArgument(Info, Argument, bIndefinite)) { return false; }
+            if (bIndefinite && (Major == 0 || Major == 1 || Major == 6))
+            {
+                --Pos;
+                return Fail(TEXT("Indefinite length on a type without length"));
+            }
+
+            switch (Major)
+            {
+            case 0:
+                Out = MakeShared<FJsonValueNumber>((double)Argument);
+                return true;
+            case 1:
+                Out = MakeShared<FJsonValueNumber>(-1.0 - (double)Argument);
+                return true;
+            case 2:
+            case 3:
+            {
+                FString Value;
+                if (!ReadText(Major, Argument, bIndefinite, Value)) { return false; }
+                Out = MakeShared<FJsonValueString>(Value);
+                return true;
+            }
+            case 4:
+                return ReadArray(Argument, bIndefinite, Out, Depth);
+            case 5:
+                return ReadMap(Argument, bIndefinite, Out, Depth);
+            default:
+                // Tag: keep the tagged item as it is
+                if (Depth >= FQuickBinaryJson::MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+                return Read(Out, Depth + 1);
+            }
+        }
+
+    private:
+        bool ReadArgument(uint8 Info, uint64& Out, bool& bOutIndefinite)
+        {
+            bOutIndefinite = false;
+            if (Info < 24) { Out = Info; return true; }
+            if (Info <= 27) { return ReadBigEndian(1 << (Info - 24), Out); }
+            if (Info == 31) { bOutIndefinite = true; return true; }
+            --Pos;
+            return Fail(TEXT("Reserved additional information"));
+        }
+
+        bool AtBreak()
+        {
+            if (Pos < Num && Data[Pos] == 0xff)
+            {
+                ++Pos;
+                return true;
+            }
+            return false;
+        }
+
+        bool ReadSimple(uint8 Info, TSharedPtr<FJsonValue>& Out)
+        {
+            uint64 Raw = 0;
+            switch (Info)
+            {
+            case 20: Out = MakeShared<FJsonValueBoolean>(false); return true;
+            case 21: Out = MakeShared<FJsonValueBoolean>(true); return true;
+            case 22: case 23: Out = MakeShared<FJsonValueNull>(); return true;
+            case 25:
+            {
+                if (!ReadBigEndian(2, Raw)) { return false; }
+                const int32 Exponent = (int32)(Raw >> 10) & 0x1f;
+                const double Mantissa = (double)(Raw & 0x3ff);
+                double Value = Exponent == 0 ? std::ldexp(Mantissa, -24)
+                    : Exponent != 31 ? std::ldexp(Mantissa + 1024.0, Exponent - 25)
+                    : (Mantissa == 0.0 ? INFINITY : NAN);
+                Out = MakeNumber((Raw & 0x8000) ? -Value : Value);
+                return true;
+            }
+            case 26:
+            {
+                if (!ReadBigEndian(4, Raw)) { return false; }
+                const uint32 Bits = (uint32)Raw;
+                float Value;
+                FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+                Out = MakeNumber(Value);
+                return true;
+            }
+            case 27:
+            {
+                if (!ReadBigEndian(8, Raw)) { return false; }
+                double Value;
+                FMemory::Memcpy(&Value, &Raw, sizeof(Value));
+                Out = MakeNumber(Value);
+                return true;
+            }
+            case 31:
+                --Pos;
+                return Fail(TEXT("Unexpected break"));
+            default:
+                --Pos;
+                return Fail(TEXT("Unsupported simple value"));
+            }
+        }
+
+        /** Byte (major 2, Base64) or text (major 3) string; indefinite strings are a run of definite chunks of the same type. */
+        bool ReadText(uint8 Major, uint64 Len, bool bIndefinite, FString& Out)
+        {
+            if (!bIndefinite)
+            {
+                return Major == 3 ? ReadString(Len, Out) : ReadBase64(Len, Out);
+            }
+
+            TArray<uint8> Joined;
+            while (!AtBreak())
+            {
+                if (!Need(1)) { return false; }
+                const uint8 Initial = Data[Pos++];
+                uint64 ChunkLen = 0;
+                bool bChunkIndefinite = false;
+                if ((Initial >> 5) != Major || !ReadArgument(Initial & 0x1f, ChunkLen, bChunkIndefinite) || bChunkIndefinite)
+                {
+                    return Fail(TEXT("Invalid indefinite-length string chunk"));
+                }
+                if (!Need(ChunkLen)) { return false; }
+                Joined.Append(Data + Pos, (int32)ChunkLen);
+                Pos += (int32)ChunkLen;
+            }
+            FBinaryReader Chunks(Joined);
+            return Major == 3 ? Chunks.ReadString(Joined.Num(), Out) : Chunks.ReadBase64(Joined.Num(), Out);
+        }
+
+        bool ReadArray(uint64 Count, bool bIndefinite, TSharedPtr<FJsonValue>& Out, int32 Depth)
+        {
+            if (Depth >= FQuickBinaryJson::MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+            TArray<TSharedPtr<FJsonValue>> Elements;
+            if (bIndefinite)
+            {
+                while (!AtBreak())
+                {
+                    if (!Read(Elements.AddDefaulted_GetRef(), Depth + 1)) { return false; }
+                }
+            }
+            else
+            {
+                if (!CheckCount(Count, 1)) { return false; }
+                Elements.SetNum((int32)Count);
+                for (TSharedPtr<FJsonValue>& Element : Elements)
+                {
+                    if (!Read(Element, Depth + 1)) { return false; }
+                }
+            }
+            Out = MakeShared<FJsonValueArray>(Elements);
+            return true;
+        }
+
+        bool ReadMap(uint64 Count, bool bIndefinite, TSharedPtr<FJsonValue>& Out, int32 Depth)
+        {
+            if (Depth >= FQuickBinaryJson::MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+            if (!bIndefinite && !CheckCount(Count, 2)) { return false; }
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            if (!bIndefinite) { Object->Values.Reserve((int32)Count); }
+            for (uint64 i = 0; bIndefinite ? !AtBreak() : i < Count; ++i)
+            {
+                FString Key;
+                TSharedPtr<FJsonValue> Value;
+                if (!ReadKey(Key, Depth) || !Read(Value, Depth + 1)) { return false; }
+                Object->Values.Add(MoveTemp(Key), MoveTemp(Value));
+            }
+            Out = MakeShared<FJsonValueObject>(Object);
+            return true;
+        }
+
+        bool ReadKey(FString& Out, int32 Depth)
+        {
+            if (!Need(1)) { return false; }
+            const uint8 Initial = Data[Pos];
+            if ((Initial >> 5) == 3 && (Initial & 0x1f) != 31)
+            {
+                // Definite text key: skip the temporary value
+                ++Pos;
+                uint64 Len = 0;
+                bool bIndefinite = false;
+                return ReadArgument(Initial & 0x1f, Len, bIndefinite) && ReadString(Len, Out);
+            }
+
+            TSharedPtr<FJsonValue> Key;
+            if (!Read(Key, Depth + 1)) { return false; }
+            if (Key->Type == EJson::String) { Out = Key->AsString(); return true; }
+            if (Key->Type != EJson::Number) { return Fail(TEXT("Map keys must be strings or numbers")); }
+            Out = KeyFromValue(Key);
+            return true;
+        }
+    };
+
+    template <typename DecoderType>
+    bool DecodeBinary(TArrayView<const uint8> Bytes, TSharedPtr<FJsonValue>& OutValue, FString& OutError)
+    {
+        DecoderType Decoder(Bytes);
+        if (Decoder.Read(OutValue, 0))
+        {
+            if (Decoder.Pos == Decoder.Num) { return true; }
+            Decoder.Fail(TEXT("Unexpected data after the value"));
+        }
+        OutError = Decoder.Error;
+        OutValue.Reset();
+        return false;
+    }
+}
+
+const TCHAR* FQuickBinaryJson::GetContentType(EQuickHttpBodyFormat Format)
+{
+    switch (Format)
+    {
+    case EQuickHttpBodyFormat::MessagePack: return TEXT("application/msgpack");
+    case EQuickHttpBodyFormat::Cbor:        return TEXT("application/cbor");
+    default:                                return TEXT("application/json");
+    }
+}
+
+EQuickHttpBodyFormat FQuickBinaryJson::FormatFromContentType(const FString& ContentType)
+{
+    FString MimeType = ContentType;
+    int32 Semicolon = INDEX_NONE;
+    if (MimeType.FindChar(TEXT(';'), Semicolon)) { MimeType.LeftInline(Semicolon); }
+    MimeType.TrimStartAndEndInline();
+
+    // application/msgpack is registered; x- and vnd. spellings are still common
+    if (MimeType.EndsWith(TEXT("msgpack")) || MimeType.EndsWith(TEXT("messagepack")))
+    {
+        return EQuickHttpBodyFormat::MessagePack;
+    }
+    if (MimeType.EndsWith(TEXT("/cbor")) || MimeType.EndsWith(TEXT("+cbor")))
+    {
+        return EQuickHttpBodyFormat::Cbor;
+    }
+    return EQuickHttpBodyFormat::Json;
+}
+
+const TCHAR* FQuickBinaryJson::GetFormatName(EQuickHttpBodyFormat Format)
+{
+    switch (Format)
+    {
+    case EQuickHttpBodyFormat::MessagePack: return TEXT("MessagePack");
+    case EQuickHttpBodyFormat::Cbor:        return TEXT("CBOR");
+    default:                                return TEXT("JSON");
+    }
+}
+
+void FQuickBinaryJson::Encode(const TSharedPtr<FJsonValue>& Value, EQuickHttpBodyFormat Format, TArray<uint8>& Out)
+{
+    switch (Format)
+    {
+    case EQuickHttpBodyFormat::MessagePack:
+        FMessagePackEncoder(Out).Write(Value);
+        return;
+    case EQuickHttpBodyFormat::Cbor:
+        FCborEncoder(Out).Write(Value);
+        return;
+    default:
+    {
+        FQuickJsonWriter Writer;
+        WriteJson(Writer, Value);
+        if (Out.Num() == 0) { Out = Writer.MoveBytes(); } else { Out.Append(Writer.GetBytes()); }
+        return;
+    }
+    }
+}
+
+bool FQuickBinaryJson::Decode(TArrayView<const uint8> Bytes, EQuickHttpBodyFormat Format, TSharedPtr<FJsonValue>& OutValue, FString& OutError)
+{
+    OutValue.Reset();
+    if (Bytes.Num() == 0)
+    {
+        OutError = TEXT("Empty body");
+        return false;
+    }
+
+    switch (Format)
+    {
+    case EQuickHttpBodyFormat::MessagePack:
+        return DecodeBinary<FMessagePackDecoder>(Bytes, OutValue, OutError);
+    case EQuickHttpBodyFormat::Cbor:
+        return DecodeBinary<FCborDecoder>(Bytes, OutValue, OutError);
+    default:
+    {
+        FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+        const FString Json(Converted.Length(), Converted.Get());
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+        if (!FJsonSerializer::Deserialize(Reader, OutValue) || !OutValue.IsValid())
+        {
+            OutError = Reader->GetErrorMessage();
+            if (OutError.IsEmpty()) { OutError = TEXT("Invalid JSON"); }
+            OutValue.Reset();
+            return false;
+        }
+        return true;
+    }
+    }
+}
@@ -1,6 +1,7 @@
 // Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
 
 #include "Json/QuickJsonBuilder.h"
+#include "Json/QuickBinaryJson.h"
 #include "Dom/JsonObject.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonSerializer.h"
@@ -150,3 +151,16 @@ FString UQuickJsonBuilder::ToString(bool bPretty)
     }
     return Out;
 }
+
+TArray<uint8> UQuickJsonBuilder::ToBytes(EQuickHttpBodyFormat Format)
+{
+    TArray<uint8> Out;
+    WriteBytes(Format, Out);
+    return Out;
+}
+
+void UQuickJsonBuilder::WriteBytes(EQuickHttpBodyFormat Format, TArray<uint8>& Out)
+{
+    if (!Root.IsValid()) Root = MakeShareable(new FJsonObject());
+    FQuickBinaryJson::Encode(MakeShared<FJsonValueObject>(Root), Format, Out);
+}
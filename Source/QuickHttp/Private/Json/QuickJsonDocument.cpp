@@ -0,0 +1,208 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonDocument.h"
+#include "QuickHttpRequestKey.h"
+#include "Json/QuickBinaryJson.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+static EQuickJsonType ToQuickJsonType(const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Value.IsValid()) { return EQuickJsonType::None; }
+    switch (Value->Type)
+    {
+    case EJson::Null:    return EQuickJsonType::Null;
+    case EJson::String:  return EQuickJsonType::String;
+    case EJson::Number:  return EQuickJsonType::Number;
+    case EJson::Boolean: return EQuickJsonType::Boolean;
+    case EJson::Array:   return EQuickJsonType::Array;
+    case EJson::Object:  return EQuickJsonType::Object;
+    default:             return EQuickJsonType::None;
+    }
+}
+
+UQuickJsonDocument* UQuickJsonDocument::ParseJsonDocument(const FString& Json, FString& OutError)
+{
+    OutError.Reset();
+    TSharedPtr<FJsonValue> Value;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    if (!FJsonSerializer::Deserialize(Reader, Value) || !Value.IsValid())
+    {
+        OutError = Reader->GetErrorMessage();
+        return nullptr;
+    }
+    return Wrap(Value);
+}
+
+UQuickJsonDocument* UQuickJsonDocument::ParseDocumentBytes(const TArray<uint8>& Bytes, EQuickHttpBodyFormat Format, FString& OutError)
+{
+    OutError.Reset();
+    TSharedPtr<FJsonValue> Value;
+    if (!FQuickBinaryJson::Decode(Bytes, Format, Value, OutError)) { return nullptr; }
+    return Wrap(Value);
+}
+
+bool UQuickJsonDocument::ParseUtf8(const TArray<uint8>& Bytes, TSharedPtr<FJsonValue>& OutValue, FString& OutError)
+{
+    const FString Json = QuickHttp::Utf8BytesToString(Bytes);
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    if (!FJsonSerializer::Deserialize(Reader, OutValue) || !OutValue.IsValid())
+    {
+        OutError = Reader->GetErrorMessage();
+        if (OutError.IsEmpty()) { OutError = TEXT("Invalid JSON"); }
+        OutValue.Reset();
+        return false;
+    }
+    return true;
+}
+
+UQuickJsonDocument* UQuickJsonDocument::Wrap(const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Value.IsValid()) { return nullptr; }
+    UQuickJsonDocument* Doc = NewObject<UQuickJsonDocument>();
+    Doc->Root = Value;
+    return Doc;
+}
+
+TSharedPtr<FJsonValue> UQuickJsonDocument::Find(const FString& Path) const
+{
+    TSharedPtr<FJsonValue> Current = Root;
+    const int32 Len = Path.Len();
+    int32 i = 0;
+    while (Current.IsValid() && i < Len)
+    {
+        const TCHAR C = Path[i];
+        if (C == TEXT('.'))
+        {
+            ++i;
+            continue;
+        }
+        if (C == TEXT('['))
+        {
+            const int32 Close = Path.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, i);
+            if (Close == INDEX_NONE || Current->Type != EJson::Array) { return nullptr; }
+            const int32 Index = FCString::Atoi(*Path.Mid(i + 1, Close - i - 1));
+            const TArray<TSharedPtr<FJsonValue>>& Elements = Current->AsArray();
+            if (!Elements.IsValidIndex(Index)) { return nullptr; }
+            Current = Elements[Index];
+            i = Close + 1;
+            continue;
+        }
+
+        int32 End = i;
+        while (End < Len && Path[End] != TEXT('.') && Path[End] != TEXT('[')) { ++End; }
+        if (Current->Type != EJson::Object) { return nullptr; }
+        Current = Current->AsObject()->TryGetField(Path.Mid(i, End - i));
+        i = End;
+    }
+    return Current;
+}
+
+EQuickJsonType UQuickJsonDocument::GetType(const FString& Path) const
+{
+    return ToQuickJsonType(Find(Path));
+}
+
+bool UQuickJsonDocument::HasField(const FString& Path) const
+{
+    return Find(Path).IsValid();
+}
+
+FString UQuickJsonDocument::GetString(const FString& Path, const FString& Default) const
+{
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    FString Out;
+    return Value.IsValid() && Value->TryGetString(Out) ? Out : Default;
+}
+
+float UQuickJsonDocument::GetNumber(const FString& Path, float Default) const
+{
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    double Out = 0.0;
+    return Value.IsValid() && Value->TryGetNumber(Out) ? (float)Out : Default;
+}
+
+int32 UQuickJsonDocument::GetInt(const FString& Path, int32 Default) const
+{
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    double Out = 0.0;
+    return Value.IsValid() && Value->TryGetNumber(Out) ? (int32)Out : Default;
+}
+
+bool UQuickJsonDocument::GetBool(const FString& Path, bool bDefault) const
+{
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    bool bOut = false;
+    return Value.IsValid() && Value->TryGetBool(bOut) ? bOut : bDefault;
+}
+
+UQuickJsonDocument* UQuickJsonDocument::GetDocument(const FString& Path) const
+{
+    return Wrap(Find(Path));
+}
+
+TArray<UQuickJsonDocument*> UQuickJsonDocument::GetArray(const FString& Path) const
+{
+    TArray<UQuickJsonDocument*> Out;
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    if (!Value.IsValid() || Value->Type != EJson::Array) { return Out; }
+
+    const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+    Out.Reserve(Elements.Num());
+    for (const TSharedPtr<FJsonValue>& Element : Elements)
+    {
+        Out.Add(Wrap(Element));
+    }
+    return Out;
+}
+
+int32 UQuickJsonDocument::GetLength(const FString& Path) const
+{
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    if (!Value.IsValid()) { return 0; }
+    if (Value->Type == EJson::Array) { return Value->AsArray().Num(); }
+    if (Value->Type == EJson::Object) { return Value->AsObject()->Values.Num(); }
+    return 0;
+}
+
+TArray<FString> UQuickJsonDocument::GetKeys(const FString& Path) const
+{
+    TArray<FString> Keys;
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    if (Value.IsValid() && Value->Type == EJson::Object)
+    {
+        Value->AsObject()->Values.GetKeys(Keys);
+    }
+    return Keys;
+}
+
+template <class PrintPolicy>
+static FString SerializeValue(const TSharedPtr<FJsonValue>& Value)
+{
+    FString Out;
+    TSharedRef<TJsonWriter<TCHAR, PrintPolicy>> Writer = TJsonWriterFactory<TCHAR, PrintPolicy>::Create(&Out);
+    if (Value->Type == EJson::Object)
+    {
+        FJsonSerializer::Serialize(Value->AsObject().ToSharedRef(), Writer);
+    }
+    else if (Value->Type == EJson::Array)
+    {
+        FJsonSerializer::Serialize(Value->AsArray(), Writer);
+    }
+    else
+    {
+        FJsonSerializer::Serialize(Value, FString(), Writer);
+    }
+    return Out;
+}
+
+FString UQuickJsonDocument::ToJsonString(const FString& Path, bool bPretty) const
+{
+    TSharedPtr<FJsonValue> Value = Find(Path);
+    if (!Value.IsValid()) { return FString(); }
+    return bPretty ? SerializeValue<TPrettyJsonPrintPolicy<TCHAR>>(Value) : SerializeValue<TCondensedJsonPrintPolicy<TCHAR>>(Value);
+}
@@ -0,0 +1,587 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonPatch.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Hash/CityHash.h"
+
+namespace
+{
+    typedef TMap<FString, TSharedPtr<FJsonValue>> FJsonFields;
+
+    bool IsNull(const TSharedPtr<FJsonValue>& Value)
+    {
+        return !Value.IsValid() || Value->Type == EJson::Null || Value->Type == EJson::None;
+    }
+
+    bool IsObject(const TSharedPtr<FJsonValue>& Value)
+    {
+        return Value.IsValid() && Value->Type == EJson::Object && Value->AsObject().IsValid();
+    }
+
+    bool IsArray(const TSharedPtr<FJsonValue>& Value)
+    {
+        return Value.IsValid() && Value->Type == EJson::Array;
+    }
+
+    TSharedPtr<FJsonValue> NullIfInvalid(const TSharedPtr<FJsonValue>& Value)
+    {
+        if (Value.IsValid()) { return Value; }
+        return MakeShared<FJsonValueNull>();
+    }
+
+    /** splitmix64 finalizer: spreads every input bit over the whole hash. */
+    uint64 Mix(uint64 Value)
+    {
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    uint64 HashString(const FString& Value)
+    {
+        return CityHash64((const char*)*Value, Value.Len() * sizeof(TCHAR));
+    }
+
+    /**
+     * Structural hashes, computed once per container and remembered, so comparing the same subtree
+     * again on the way down costs a lookup. Object hashes ignore field order.
+     */
+    class FSubtreeHasher
+    {
+    public:
+        uint64 Hash(const TSharedPtr<FJsonValue>& Value)
+        {
+            if (IsNull(Value)) { return 0x6E756C6Cull; }
+            switch (Value->Type)
+            {
+            case EJson::Boolean:
+                return Mix(Value->AsBool() ? 0xB1ull : 0xB0ull);
+            case EJson::Number:
+            {
+                // -0 and 0 are the same JSON number
+                double Number = Value->AsNumber();
+                if (Number == 0.0) { Number = 0.0; }
+                uint64 Bits;
+                FMemory::Memcpy(&Bits, &Number, sizeof(Bits));
+                return Mix(Bits ^ 0x4E554D42ull);
+            }
+            case EJson::String:
+                return Mix(HashString(Value->AsString()) ^ 0x53545247ull);
+            default:
+                break;
+            }
+
+            if (const uint64* Known = Memo.Find(Value.Get())) { return *Known; }
+            uint64 Result;
+            if (Value->Type == EJson::Array)
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Elements = Value->AsArray();
+                Result = Mix(0x41525259ull + Elements.Num());
+                for (const TSharedPtr<FJsonValue>& Element : Elements)
+                {
+                    Result = Mix(Result + Hash(Element));
+                }
+            }
+            else
+            {
+                const FJsonFields& Fields = Value->AsObject()->Values;
+                uint64 Sum = 0;
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Fields)
+                {
+                    Sum += Mix(HashString(Pair.Key) ^ (Hash(Pair.Value) * 0x9E3779B97F4A7C15ull));
+                }
+                Result = Mix(Sum ^ (0x4F424A00ull + Fields.Num()));
+            }
+            Memo.Add(Value.Get(), Result);
+            return Result;
+        }
+
+        /** Equal hashes are confirmed with a full compare, which never descends into that subtree again. */
+        bool Same(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+        {
+            if (A.Get() == B.Get()) { return true; }
+            return Hash(A) == Hash(B) && FQuickJsonPatch::Equals(A, B);
+        }
+
+    private:
+        TMap<const FJsonValue*, uint64> Memo;
+    };
+
+    TSharedPtr<FJsonValue> MergeDiff(FSubtreeHasher& Hasher, const TSharedPtr<FJsonValue>& Source, const TSharedPtr<FJsonValue>& Target)
+    {
+        // Only objects merge field by field; anything else replaces the source whole
+        if (!IsObject(Source) || !IsObject(Target)) { return NullIfInvalid(Target); }
+
+        const FJsonFields& SourceFields = Source->AsObject()->Values;
+        const FJsonFields& TargetFields = Target->AsObject()->Values;
+        TSharedPtr<FJsonObject> Patch = MakeShared<FJsonObject>();
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : SourceFields)
+        {
+            if (!TargetFields.Contains(Pair.Key))
+            {
+                Patch->Values.Add(Pair.Key, MakeShared<FJsonValueNull>());
+            }
+        }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : TargetFields)
+        {
+            const TSharedPtr<FJsonValue>* SourceValue = SourceFields.Find(Pair.Key);
+            if (!SourceValue)
+            {
+                // A null would read as "remove"; the field is absent from the source anyway
+                if (!IsNull(Pair.Value)) { Patch->Values.Add(Pair.Key, Pair.Value); }
+                continue;
+            }
+            if (Hasher.Same(*SourceValue, Pair.Value)) { continue; }
+            Patch->Values.Add(Pair.Key, MergeDiff(Hasher, *SourceValue, Pair.Value));
+        }
+        return MakeShared<FJsonValueObject>(Patch);
+    }
+
+    /** RFC 6901 reference token: "~" and "/" are escaped. */
+    FString EscapeToken(const FString& Key)
+    {
+        return Key.Replace(TEXT("~"), TEXT("~0")).Replace(TEXT("/"), TEXT("~1"));
+    }
+
+    void AddOperation(TArray<TSharedPtr<FJsonValue>>& Ops, const TCHAR* Op, const FString& Path, const TSharedPtr<FJsonValue>& Value)
+    {
+        TSharedPtr<FJsonObject> Operation = MakeShared<FJsonObject>();
+        Operation->Values.Add(TEXT("op"), MakeShared<FJsonValueString>(Op));
+        Operation->Values.Add(TEXT("path"), MakeShared<FJsonValueString>(Path));
+        if (Value.IsValid()) { Operation->Values.Add(TEXT("value"), Value); }
+        Ops.Add(MakeShared<FJsonValueObject>(Operation));
+    }
+
+    void PatchDiff(FSubtreeHasher& Hasher, const TSharedPtr<FJsonValue>& Source, const TSharedPtr<FJsonValue>& Target,
+        const FString& Path, TArray<TSharedPtr<FJsonValue>>& Ops)
+    {
+        if (Hasher.Same(Source, Target)) { return; }
+
+        if (IsObject(Source) && IsObject(Target))
+        {
+            const FJsonFields& SourceFields = Source->AsObject()->Values;
+            const FJsonFields& TargetFields = Target->AsObject()->Values;
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : SourceFields)
+            {
+                if (!TargetFields.Contains(Pair.Key))
+                {
+                    AddOperation(Ops, TEXT("remove"), Path + TEXT("/") + EscapeToken(Pair.Key), nullptr);
+                }
+            }
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : TargetFields)
+            {
+                const FString FieldPath = Path + TEXT("/") + EscapeToken(Pair.Key);
+                if (const TSharedPtr<FJsonValue>* SourceValue = SourceFields.Find(Pair.Key))
+                {
+                    PatchDiff(Hasher, *SourceValue, Pair.Value, FieldPath, Ops);
+                }
+                else
+                {
+                    AddOperation(Ops, TEXT("add"), FieldPath, NullIfInvalid(Pair.Value));
+                }
+            }
+            return;
+        }
+
+        if (IsArray(Source) && IsArray(Target))
+        {
+            const TArray<TSharedPtr<FJsonValue>>& From = Source->AsArray();
+            const TArray<TSharedPtr<FJsonValue>>& To = Target->AsArray();
+            const int32 Shorter = FMath::Min(From.Num(), To.Num());
+
+            // Trim the common ends; what is left is diffed by position, then grown or shrunk at its end
+            int32 Prefix = 0;
+            while (Prefix < Shorter && Hasher.Same(From[Prefix], To[Prefix])) { ++Prefix; }
+            int32 Suffix = 0;
+            while (Suffix < Shorter - Prefix && Hasher.Same(From[From.Num() - 1 - Suffix], To[To.Num() - 1 - Suffix])) { ++Suffix; }
+
+            const int32 FromCount = From.Num() - Prefix - Suffix;
+            const int32 ToCount = To.Num() - Prefix - Suffix;
+            const int32 Paired = FMath::Min(FromCount, ToCount);
+            for (int32 i = Prefix; i < Prefix + Paired; ++i)
+            {
+                PatchDiff(Hasher, From[i], To[i], Path + TEXT("/") + FString::FromInt(i), Ops);
+            }
+            // Highest index first so earlier removals do not shift later ones
+            for (int32 i = Prefix + FromCount - 1; i >= Prefix + Paired; --i)
+            {
+                AddOperation(Ops, TEXT("remove"), Path + TEXT("/") + FString::FromInt(i), nullptr);
+            }
+            for (int32 i = Prefix + Paired; i < Prefix + ToCount; ++i)
+            {
+                AddOperation(Ops, TEXT("add"), Path + TEXT("/") + FString::FromInt(i), NullIfInvalid(To[i]));
+            }
+            return;
+        }
+
+        AddOperation(Ops, TEXT("replace"), Path, NullIfInvalid(Target));
+    }
+
+    TSharedPtr<FJsonValue> MergeApply(const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch)
+    {
+        if (!IsObject(Patch)) { return NullIfInvalid(Patch); }
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        if (IsObject(Target)) { Result->Values = Target->AsObject()->Values; }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Patch->AsObject()->Values)
+        {
+            if (IsNull(Pair.Value))
+            {
+                Result->Values.Remove(Pair.Key);
+                continue;
+            }
+            const TSharedPtr<FJsonValue>* Existing = Result->Values.Find(Pair.Key);
+            TSharedPtr<FJsonValue> Merged = MergeApply(Existing ? *Existing : TSharedPtr<FJsonValue>(), Pair.Value);
+            Result->Values.Add(Pair.Key, Merged);
+        }
+        return MakeShared<FJsonValueObject>(Result);
+    }
+
+    /** Split an RFC 6901 JSON pointer into unescaped reference tokens. "" is the whole document. */
+    bool ParsePointer(const FString& Pointer, TArray<FString>& OutTokens)
+    {
+        OutTokens.Reset();
+        if (Pointer.IsEmpty()) { return true; }
+        if (Pointer[0] != TEXT('/')) { return false; }
+
+        FString Token;
+        for (int32 i = 1; i <= Pointer.Len(); ++i)
+        {
+            if (i == Pointer.Len() || Pointer[i] == TEXT('/'))
+            {
+                OutTokens.Add(Token);
+                Token.Reset();
+                continue;
+            }
+            TCHAR Char = Pointer[i];
+            if (Char == TEXT('~'))
+            {
+                const TCHAR Next = i + 1 < Pointer.Len() ? Pointer[i + 1] : TEXT('\0');
+                if (Next != TEXT('0') && Next != TEXT('1')) { return false; }
+                Char = Next == TEXT('0') ? TEXT('~') : TEXT('/');
+                ++i;
+            }
+            Token.AppendChar(Char);
+        }
+        return true;
+    }
+
+    /** Array index token: digits without leading zeros, or "-" (one past the end) where allowed. */
+    bool ParseIndex(const FString& Token, int32 Num, bool bAllowEnd, int32& OutIndex)
+    {
+        if (bAllowEnd && Token == TEXT("-"))
+        {
+            OutIndex = Num;
+            return true;
+        }
+        if (Token.IsEmpty() || Token.Len() > 9 || (Token.Len() > 1 && Token[0] == TEXT('0'))) { return false; }
+        for (int32 i = 0; i < Token.Len(); ++i)
+        {
+            if (!FChar::IsDigit(Token[i])) { return false; }
+        }
+        OutIndex = FCString::Atoi(*Token);
+        return OutIndex < Num || (bAllowEnd && OutIndex == Num);
+    }
+
+    TSharedPtr<FJsonValue> FindAt(const TSharedPtr<FJsonValue>& Root, const TArray<FString>& Tokens)
+    {
+        TSharedPtr<FJsonValue> Current = Root;
+        for (const FString& Token : Tokens)
+        {
+            if (IsObject(Current))
+            {
+                const TSharedPtr<FJsonValue>* Child = Current->AsObject()->Values.Find(Token);
+                if (!Child) { return nullptr; }
+                Current = NullIfInvalid(*Child);
+            }
+            else if (IsArray(Current))
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Elements = Current->AsArray();
+                int32 Index;
+                if (!ParseIndex(Token, Elements.Num(), false, Index)) { return nullptr; }
+                Current = NullIfInvalid(Elements[Index]);
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+        return Current;
+    }
+
+    enum class EEdit : uint8
+    {
+        Add,
+        Remove,
+        Replace
+    };
+
+    /** Containers on the path are copied on the way down, so the input document is never changed. */
+    bool EditAt(TSharedPtr<FJsonValue>& Node, const TArray<FString>& Tokens, int32 Depth, EEdit Edit, const TSharedPtr<FJsonValue>& Value)
+    {
+        const FString& Token = Tokens[Depth];
+        const bool bLast = Depth == Tokens.Num() - 1;
+
+        if (IsObject(Node))
+        {
+            TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+            Object->Values = Node->AsObject()->Values;
+            TSharedPtr<FJsonValue>* Child = Object->Values.Find(Token);
+            if (!bLast)
+            {
+                if (!Child || !EditAt(*Child, Tokens, Depth + 1, Edit, Value)) { return false; }
+            }
+            else if (Edit == EEdit::Add)
+            {
+                Object->Values.Add(Token, Value);
+            }
+            else if (!Child)
+            {
+                return false;
+            }
+            else if (Edit == EEdit::Remove)
+            {
+                Object->Values.Remove(Token);
+            }
+            else
+            {
+                *Child = Value;
+            }
+            Node = MakeShared<FJsonValueObject>(Object);
+            return true;
+        }
+
+        if (IsArray(Node))
+        {
+            TArray<TSharedPtr<FJsonValue>> Elements = Node->AsArray();
+            int32 Index;
+            if (!ParseIndex(Token, Elements.Num(), bLast && Edit == EEdit::Add, Index)) { return false; }
+            if (!bLast)
+            {
+                if (!EditAt(Elements[Index], Tokens, Depth + 1, Edit, Value)) { return false; }
+            }
+            else if (Edit == EEdit::Add)
+            {
+                Elements.Insert(Value, Index);
+            }
+            else if (Edit == EEdit::Remove)
+            {
+                Elements.RemoveAt(Index);
+            }
+            else
+            {
+                Elements[Index] = Value;
+            }
+            Node = MakeShared<FJsonValueArray>(Elements);
+            return true;
+        }
+        return false;
+    }
+
+    bool EditDocument(TSharedPtr<FJsonValue>& Document, const TArray<FString>& Tokens, EEdit Edit, const TSharedPtr<FJsonValue>& Value)
+    {
+        if (Tokens.Num() == 0)
+        {
+            if (Edit == EEdit::Remove) { return false; }
+            Document = Value;
+            return true;
+        }
+        return EditAt(Document, Tokens, 0, Edit, Value);
+    }
+
+    bool GetStringField(const FJsonObject& Object, const TCHAR* Name, FString& OutValue)
+    {
+        const TSharedPtr<FJsonValue>* Field = Object.Values.Find(Name);
+        if (!Field || !Field->IsValid() || (*Field)->Type != EJson::String) { return false; }
+        OutValue = (*Field)->AsString();
+        return true;
+    }
+
+    bool ApplyOperations(const TSharedPtr<FJsonValue>& Target, const TArray<TSharedPtr<FJsonValue>>& Ops, TSharedPtr<FJsonValue>& OutResult, FString& OutError)
+    {
+        TSharedPtr<FJsonValue> Document = NullIfInvalid(Target);
+        TArray<FString> Tokens;
+        TArray<FString> FromTokens;
+        for (int32 i = 0; i < Ops.Num(); ++i)
+        {
+            if (!IsObject(Ops[i]))
+            {
+                OutError = FString::Printf(TEXT("Operation %d is not an object"), i);
+                return false;
+            }
+            const FJsonObject& Operation = *Ops[i]->AsObject();
+            FString Op;
+            FString Path;
+            if (!GetStringField(Operation, TEXT("op"), Op) || !GetStringField(Operation, TEXT("path"), Path))
+            {
+                OutError = FString::Printf(TEXT("Operation %d needs \"op\" and \"path\" strings"), i);
+                return false;
+            }
+            if (!ParsePointer(Path, Tokens))
+            {
+                OutError = FString::Printf(TEXT("Operation %d: invalid JSON pointer \"%s\""), i, *Path);
+                return false;
+            }
+
+            const TSharedPtr<FJsonValue>* Value = Operation.Values.Find(TEXT("value"));
+            const bool bNeedsValue = Op == TEXT("add") || Op == TEXT("replace") || Op == TEXT("test");
+            if (bNeedsValue && !Value)
+            {
+                OutError = FString::Printf(TEXT("Operation %d (%s) has no \"value\""), i, *Op);
+                return false;
+            }
+
+            FString From;
+            const bool bNeedsFrom = Op == TEXT("move") || Op == TEXT("copy");
+            if (bNeedsFrom && (!GetStringField(Operation, TEXT("from"), From) || !ParsePointer(From, FromTokens)))
+            {
+                OutError = FString::Printf(TEXT("Operation %d (%s) needs a valid \"from\" pointer"), i, *Op);
+                return false;
+            }
+
+            bool bApplied = false;
+            if (Op == TEXT("add"))
+            {
+                bApplied = EditDocument(Document, Tokens, EEdit::Add, NullIfInvalid(*Value));
+            }
+            else if (Op == TEXT("remove"))
+            {
+                bApplied = EditDocument(Document, Tokens, EEdit::Remove, nullptr);
+            }
+            else if (Op == TEXT("replace"))
+            {
+                bApplied = EditDocument(Document, Tokens, EEdit::Replace, NullIfInvalid(*Value));
+            }
+            else if (Op == TEXT("test"))
+            {
+                TSharedPtr<FJsonValue> Found = FindAt(Document, Tokens);
+                if (!Found.IsValid() || !FQuickJsonPatch::Equals(Found, *Value))
+                {
+                    OutError = FString::Printf(TEXT("Operation %d: test of \"%s\" failed"), i, *Path);
+                    return false;
+                }
+                bApplied = true;
+            }
+            else if (Op == TEXT("move") || Op == TEXT("copy"))
+            {
+                // A value cannot be moved into one of its own children
+                bool bIntoItself = Op == TEXT("move") && Tokens.Num() > FromTokens.Num();
+                for (int32 t = 0; bIntoItself && t < FromTokens.Num(); ++t)
+                {
+                    bIntoItself = Tokens[t] == FromTokens[t];
+                }
+                TSharedPtr<FJsonValue> Moved;
+                if (!bIntoItself) { Moved = FindAt(Document, FromTokens); }
+                bApplied = Moved.IsValid()
+                    && (Op == TEXT("copy") || EditDocument(Document, FromTokens, EEdit::Remove, nullptr))
+                    && EditDocument(Document, Tokens, EEdit::Add, Moved);
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Operation %d: unknown op \"%s\""), i, *Op);
+                return false;
+            }
+
+            if (!bApplied)
+            {
+                OutError = FString::Printf(TEXT("Operation %d (%s): path \"%s\" cannot be applied to the document"), i, *Op, *Path);
+                return false;
+            }
+        }
+        OutResult = Document;
+        return true;
+    }
+}
+
+const TCHAR* FQuickJsonPatch::GetContentType(EQuickJsonPatchFormat Format)
+{
+    return Format == EQuickJsonPatchFormat::JsonPatch ? TEXT("application/json-patch+json") : TEXT("application/merge-patch+json");
+}
+
+TSharedPtr<FJsonValue> FQuickJsonPatch::Diff(const TSharedPtr<FJsonValue>& Source, const TSharedPtr<FJsonValue>& Target, EQuickJsonPatchFormat Format)
+{
+    FSubtreeHasher Hasher;
+    if (Format == EQuickJsonPatchFormat::JsonPatch)
+    {
+        TArray<TSharedPtr<FJsonValue>> Ops;
+        PatchDiff(Hasher, Source, Target, FString(), Ops);
+        return MakeShared<FJsonValueArray>(Ops);
+    }
+    // {} would turn a scalar or array root into an object, so those are always replaced whole
+    if (IsObject(Source) && Hasher.Same(Source, Target))
+    {
+        return MakeShared<FJsonValueObject>(MakeShared<FJsonObject>());
+    }
+    return MergeDiff(Hasher, Source, Target);
+}
+
+bool FQuickJsonPatch::IsEmpty(const TSharedPtr<FJsonValue>& Patch, EQuickJsonPatchFormat Format)
+{
+    if (Format == EQuickJsonPatchFormat::JsonPatch)
+    {
+        return IsArray(Patch) && Patch->AsArray().Num() == 0;
+    }
+    return IsObject(Patch) && Patch->AsObject()->Values.Num() == 0;
+}
+
+bool FQuickJsonPatch::Apply(const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch, EQuickJsonPatchFormat Format,
+    TSharedPtr<FJsonValue>& OutResult, FString& OutError)
+{
+    OutResult.Reset();
+    OutError.Reset();
+    if (Format == EQuickJsonPatchFormat::MergePatch)
+    {
+        OutResult = MergeApply(Target, Patch);
+        return true;
+    }
+    if (!IsArray(Patch))
+    {
+        OutError = TEXT("A JSON Patch must be an array of operations");
+        return false;
+    }
+    return ApplyOperations(Target, Patch->AsArray(), OutResult, OutError);
+}
+
+bool FQuickJsonPatch::Equals(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+{
+    if (A.Get() == B.Get()) { return true; }
+    if (IsNull(A) || IsNull(B)) { return IsNull(A) && IsNull(B); }
+    if (A->Type != B->Type) { return false; }
+
+    switch (A->Type)
+    {
+    case EJson::Boolean:
+        return A->AsBool() == B->AsBool();
+    case EJson::Number:
+        return A->AsNumber() == B->AsNumber();
+    case EJson::String:
+        return A->AsString().Equals(B->AsString(), ESearchCase::CaseSensitive);
+    case EJson::Array:
+    {
+        const TArray<TSharedPtr<FJsonValue>>& ElementsA = A->AsArray();
+        const TArray<TSharedPtr<FJsonValue>>& ElementsB = B->AsArray();
+        if (ElementsA.Num() != ElementsB.Num()) { return false; }
+        for (int32 i = 0; i < ElementsA.Num(); ++i)
+        {
+            if (!Equals(ElementsA[i], ElementsB[i])) { return false; }
+        }
+        return true;
+    }
+    case EJson::Object:
+    {
+        const TSharedPtr<FJsonObject> ObjectA = A->AsObject();
+        const TSharedPtr<FJsonObject> ObjectB = B->AsObject();
+        if (!ObjectA.IsValid() || !ObjectB.IsValid()) { return ObjectA.IsValid() == ObjectB.IsValid(); }
+        if (ObjectA->Values.Num() != ObjectB->Values.Num()) { return false; }
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : ObjectA->Values)
+        {
+            const TSharedPtr<FJsonValue>* Other = ObjectB->Values.Find(Pair.Key);
+            if (!Other || !Equals(Pair.Value, *Other)) { return false; }
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
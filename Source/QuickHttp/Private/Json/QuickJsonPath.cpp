@@ -0,0 +1,501 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonPath.h"
+#include "Json/QuickJsonSimd.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    /** Compiled selectors by source text. Cleared wholesale when full; compiling is cheap, reuse is the point. */
+    struct FPathCache
+    {
+        static constexpr int32 MaxEntries = 512;
+
+        FRWLock Lock;
+        TMap<FString, FQuickJsonPathPtr> Paths;
+    };
+
+    FPathCache& GetPathCache()
+    {
+        static FPathCache Cache;
+        return Cache;
+    }
+
+    FORCEINLINE void GetSegmentName(const FQuickJsonPath::FSegment& Segment, const TCHAR*& OutName, int32& OutLen)
+    {
+        OutName = *Segment.Name;
+        OutLen = Segment.Name.Len();
+    }
+
+    FORCEINLINE void GetSegmentName(const FQuickJsonPath::FSegment& Segment, const uint8*& OutName, int32& OutLen)
+    {
+        OutName = Segment.NameUtf8.GetData();
+        OutLen = Segment.NameUtf8.Num();
+    }
+
+    FORCEINLINE FString SpanToString(const TCHAR* Begin, const TCHAR* End)
+    {
+        return FString((int32)(End - Begin), Begin);
+    }
+
+    FORCEINLINE FString SpanToString(const uint8* Begin, const uint8* End)
+    {
+        if (Begin == End) { return FString(); }
+        FUTF8ToTCHAR Converted((const ANSICHAR*)Begin, (int32)(End - Begin));
+        return FString(Converted.Length(), Converted.Get());
+    }
+
+    int32 ParseHex4(const TCHAR* P)
+    {
+        int32 Value = 0;
+        for (int32 i = 0; i < 4; ++i)
+        {
+            const TCHAR C = P[i];
+            Value <<= 4;
+            if (C >= '0' && C <= '9') { Value |= C - '0'; }
+            else if (C >= 'a' && C <= 'f') { Value |= C - 'a' + 10; }
+            else if (C >= 'A' && C <= 'F') { Value |= C - 'A' + 10; }
+            else { return -1; }
+        }
+        return Value;
+    }
+
+    /** Resolve JSON escapes in the contents of a string literal (without its quotes). */
+    FString Unescape(const FString& Raw)
+    {
+        if (!Raw.Contains(TEXT("\\"), ESearchCase::CaseSensitive)) { return Raw; }
+
+        FString Out;
+        Out.Reserve(Raw.Len());
+        const TCHAR* P = *Raw;
+        const TCHAR* End = P + Raw.Len();
+        while (P < End)
+        {
+            if (*P != '\\' || End - P < 2)
+            {
+                Out.AppendChar(*P++);
+                continue;
+            }
+
+            const TCHAR E = P[1];
+            P += 2;
+            switch (E)
+            {
+            case 'b': Out.AppendChar('\b'); break;
+            case 'f': Out.AppendChar('\f'); break;
+            case 'n': Out.AppendChar('\n'); break;
+            case 'r': Out.AppendChar('\r'); break;
+            case 't': Out.AppendChar('\t'); break;
+            case 'u':
+            {
+                const int32 Code = End - P >= 4 ? ParseHex4(P) : -1;
+                if (Code < 0) { Out.AppendChar((TCHAR)0xFFFD); break; }
+                P += 4;
+                if (sizeof(TCHAR) == 4 && Code >= 0xD800 && Code <= 0xDBFF && End - P >= 6 && P[0] == '\\' && P[1] == 'u')
+                {
+                    // TCHAR is UTF-32 here; join the surrogate pair into one code point
+                    const int32 Low = ParseHex4(P + 2);
+                    if (Low >= 0xDC00 && Low <= 0xDFFF)
+                    {
+                        Out.AppendChar((TCHAR)(0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00)));
+                        P += 6;
+                        break;
+                    }
+                }
+                Out.AppendChar((TCHAR)Code);
+                break;
+            }
+            default: Out.AppendChar(E); break;
+            }
+        }
+        return Out;
+    }
+
+    template <typename CharT>
+    class TPathScanner
+    {
+    public:
+        TPathScanner(const FQuickJsonPath& InPath, const CharT* InBegin, int32 InLen, TArray<FQuickJsonPathMatch>& InOut)
+            : Path(InPath), Segments(InPath.GetSegments()), Begin(InBegin), End(InBegin + InLen), Out(InOut)
+        {
+        }
+
+        bool Run(FString* OutError)
+        {
+            Error = OutError;
+            const CharT* P = SkipWhitespace(Begin);
+            if (P == End) { return Fail(TEXT("Empty document"), P); }
+            if (!Match(P, 0)) { return false; }
+            if (bStop) { return true; }
+            if (SkipWhitespace(P) != End) { return Fail(TEXT("Unexpected data after the root value"), P); }
+            return true;
+        }
+
+    private:
+        /** P is at the start of a value; on return it is just past it (unless the scan stopped early). */
+        bool Match(const CharT*& P, int32 SegmentIndex)
+        {
+            if (SegmentIndex == Segments.Num())
+            {
+                const CharT* Start = P;
+                if (!SkipValue(P)) { return false; }
+                Emit(Start, P);
+                bStop = !Path.HasWildcard();
+                return true;
+            }
+
+            const FQuickJsonPath::FSegment& Segment = Segments[SegmentIndex];
+            if (*P == '{' && Segment.Kind != FQuickJsonPath::ESegment::Index)
+            {
+                P = SkipWhitespace(P + 1);
+                if (P < End && *P == '}') { ++P; return true; }
+                while (true)
+                {
+                    if (P == End || *P != '"') { return Fail(TEXT("Expected a string key"), P); }
+                    const CharT* KeyBegin = P + 1;
+                    bool bEscaped = false;
+                    if (!SkipString(P, bEscaped)) { return false; }
+                    const bool bMatch = Segment.Kind == FQuickJsonPath::ESegment::Wildcard || KeyEquals(KeyBegin, P - 1, bEscaped, Segment);
+
+                    P = SkipWhitespace(P);
+                    if (P == End || *P != ':') { return Fail(TEXT("Expected ':'"), P); }
+                    P = SkipWhitespace(P + 1);
+                    if (P == End) { return Fail(TEXT("Unexpected end of input"), P); }
+
+                    if (bMatch)
+                    {
+                        if (!Match(P, SegmentIndex + 1)) { return false; }
+                        if (bStop) { return true; }
+                    }
+                    else if (!SkipValue(P))
+                    {
+                        return false;
+                    }
+
+                    P = SkipWhitespace(P);
+                    if (P < End && *P == ',') { P = SkipWhitespace(P + 1); continue; }
+                    if (P < End && *P == '}') { ++P; return true; }
+                    return Fail(TEXT("Expected ',' or '}'"), P);
+                }
+            }
+
+            if (*P == '[' && Segment.Kind != FQuickJsonPath::ESegment::Field)
+            {
+                P = SkipWhitespace(P + 1);
+                if (P < End && *P == ']') { ++P; return true; }
+                for (int32 Index = 0; ; ++Index)
+                {
+                    if (P == End) { return Fail(TEXT("Unexpected end of input"), P); }
+                    if (Segment.Kind == FQuickJsonPath::ESegment::Wildcard || Index == Segment.Index)
+                    {
+                        if (!Match(P, SegmentIndex + 1)) { return false; }
+                        if (bStop) { return true; }
+                    }
+                    else if (!SkipValue(P))
+                    {
+                        return false;
+                    }
+
+                    P = SkipWhitespace(P);
+                    if (P < End && *P == ',') { P = SkipWhitespace(P + 1); continue; }
+                    if (P < End && *P == ']') { ++P; return true; }
+                    return Fail(TEXT("Expected ',' or ']'"), P);
+                }
+            }
+
+            // Not on the path (wrong type for this segment)
+            return SkipValue(P);
+        }
+
+        bool SkipValue(const CharT*& P)
+        {
+            if (*P == '"')
+            {
+                bool bEscaped = false;
+                return SkipString(P, bEscaped);
+            }
+            if (*P == '{' || *P == '[')
+            {
+                return SkipContainer(P);
+            }
+
+            const CharT* Start = P;
+            while (P < End && !IsDelimiter(*P)) { ++P; }
+            if (!IsScalar(Start, P)) { return Fail(TEXT("Unexpected character"), Start); }
+            return true;
+        }
+
+        bool SkipContainer(const CharT*& P)
+        {
+            const CharT* Start = P;
+            int32 Depth = 0;
+            while (true)
+            {
+                P = QuickJsonSimd::FindContainerStop(P, End);
+                if (P == End) { return Fail(TEXT("Unterminated object or array"), Start); }
+                if (*P == '"')
+                {
+                    bool bEscaped = false;
+                    if (!SkipString(P, bEscaped)) { return false; }
+                    continue;
+                }
+                Depth += (*P == '{' || *P == '[') ? 1 : -1;
+                ++P;
+                if (Depth == 0) { return true; }
+            }
+        }
+
+        /** P is at the opening quote; on return it is just past the closing quote. */
+        bool SkipString(const CharT*& P, bool& bOutEscaped)
+        {
+            const CharT* Start = P++;
+            while (true)
+            {
+                P = QuickJsonSimd::FindStringStop(P, End);
+                if (P == End) { return Fail(TEXT("Unterminated string"), Start); }
+                if (*P == '"') { ++P; return true; }
+                if (*P == '\\')
+                {
+                    bOutEscaped = true;
+                    if (End - P < 2) { return Fail(TEXT("Unterminated string"), Start); }
+                    P += 2;
+                    continue;
+                }
+                // Raw control character: tolerated while skipping
+                ++P;
+            }
+        }
+
+        bool KeyEquals(const CharT* KeyBegin, const CharT* KeyEnd, bool bEscaped, const FQuickJsonPath::FSegment& Segment) const
+        {
+            if (bEscaped)
+            {
+                return Unescape(SpanToString(KeyBegin, KeyEnd)).Equals(Segment.Name, ESearchCase::CaseSensitive);
+            }
+
+            const CharT* Name = nullptr;
+            int32 NameLen = 0;
+            GetSegmentName(Segment, Name, NameLen);
+            if (KeyEnd - KeyBegin != NameLen) { return false; }
+            for (int32 i = 0; i < NameLen; ++i)
+            {
+                if (KeyBegin[i] != Name[i]) { return false; }
+            }
+            return true;
+        }
+
+        void Emit(const CharT* ValueBegin, const CharT* ValueEnd)
+        {
+            FQuickJsonPathMatch& M = Out.AddDefaulted_GetRef();
+            switch (*ValueBegin)
+            {
+            case '"':
+                M.Type = EQuickJsonType::String;
+                M.StringValue = Unescape(SpanToString(ValueBegin + 1, ValueEnd - 1));
+                break;
+            case '{':
+                M.Type = EQuickJsonType::Object;
+                M.StringValue = SpanToString(ValueBegin, ValueEnd);
+                break;
+            case '[':
+                M.Type = EQuickJsonType::Array;
+                M.StringValue = SpanToString(ValueBegin, ValueEnd);
+                break;
+            case 't':
+            case 'f':
+                M.Type = EQuickJsonType::Boolean;
+                M.BoolValue = *ValueBegin == 't';
+                M.StringValue = M.BoolValue ? TEXT("true") : TEXT("false");
+                break;
+            case 'n':
+                M.Type = EQuickJsonType::Null;
+                M.StringValue = TEXT("null");
+                break;
+            default:
+                M.Type = EQuickJsonType::Number;
+                M.StringValue = SpanToString(ValueBegin, ValueEnd);
+                M.NumberValue = (float)FCString::Atod(*M.StringValue);
+                break;
+            }
+        }
+
+        static FORCEINLINE bool IsWhitespace(CharT C)
+        {
+            return C == ' ' || C == '\n' || C == '\r' || C == '\t';
+        }
+
+        static FORCEINLINE bool IsDelimiter(CharT C)
+        {
+            return IsWhitespace(C) || C == ',' || C == '}' || C == ']' || C == ':';
+        }
+
+        static bool IsLiteral(const CharT* P, const CharT* E, const ANSICHAR* Literal, int32 Len)
+        {
+            if (E - P != Len) { return false; }
+            for (int32 i = 0; i < Len; ++i)
+            {
+                if (P[i] != (CharT)Literal[i]) { return false; }
+            }
+            return true;
+        }
+
+        static bool IsScalar(const CharT* P, const CharT* E)
+        {
+            if (P == E) { return false; }
+            switch (*P)
+            {
+            case 't': return IsLiteral(P, E, "true", 4);
+            case 'f': return IsLiteral(P, E, "false", 5);
+            case 'n': return IsLiteral(P, E, "null", 4);
+            default:
+                for (; P < E; ++P)
+                {
+                    const CharT C = *P;
+                    if (!((C >= '0' && C <= '9') || C == '-' || C == '+' || C == '.' || C == 'e' || C == 'E')) { return false; }
+                }
+                return true;
+            }
+        }
+
+        FORCEINLINE const CharT* SkipWhitespace(const CharT* P) const
+        {
+            while (P < End && IsWhitespace(*P)) { ++P; }
+            return P;
+        }
+
+        bool Fail(const TCHAR* What, const CharT* At) const
+        {
+            if (Error)
+            {
+                *Error = FString::Printf(TEXT("%s at offset %d"), What, (int32)(At - Begin));
+            }
+            return false;
+        }
+
+        const FQuickJsonPath& Path;
+        const TArray<FQuickJsonPath::FSegment>& Segments;
+        const CharT* Begin;
+        const CharT* End;
+        TArray<FQuickJsonPathMatch>& Out;
+        FString* Error = nullptr;
+        bool bStop = false;
+    };
+}
+
+FQuickJsonPathPtr FQuickJsonPath::Compile(const FString& Selector, FString* OutError)
+{
+    FPathCache& Cache = GetPathCache();
+    {
+        FReadScopeLock ReadLock(Cache.Lock);
+        if (const FQuickJsonPathPtr* Found = Cache.Paths.Find(Selector))
+        {
+            return *Found;
+        }
+    }
+
+    TSharedRef<FQuickJsonPath, ESPMode::ThreadSafe> Path = MakeShared<FQuickJsonPath, ESPMode::ThreadSafe>();
+    FString Error;
+    if (!Parse(Selector, Path->Segments, Error))
+    {
+        if (OutError) { *OutError = Error; }
+        return nullptr;
+    }
+    Path->Selector = Selector;
+    for (const FSegment& Segment : Path->Segments)
+    {
+        Path->bHasWildcard |= Segment.Kind == ESegment::Wildcard;
+    }
+
+    FWriteScopeLock WriteLock(Cache.Lock);
+    if (Cache.Paths.Num() >= FPathCache::MaxEntries)
+    {
+        Cache.Paths.Reset();
+    }
+    Cache.Paths.Add(Selector, Path);
+    return Path;
+}
+
+bool FQuickJsonPath::Parse(const FString& Selector, TArray<FSegment>& OutSegments, FString& OutError)
+{
+    const int32 Len = Selector.Len();
+    int32 i = 0;
+    if (i < Len && Selector[i] == '$') { ++i; }
+    bool bAfterDot = i == 0;
+
+    while (i < Len)
+    {
+        const TCHAR C = Selector[i];
+        FSegment Segment;
+
+        if (C == '.')
+        {
+            if (bAfterDot) { OutError = FString::Printf(TEXT("Empty field name at %d"), i); return false; }
+            bAfterDot = true;
+            ++i;
+            continue;
+        }
+
+        if (C == '[')
+        {
+            const int32 Close = Selector.Find(TEXT("]"), ESearchCase::CaseSensitive, ESearchDir::FromStart, i);
+            if (Close == INDEX_NONE) { OutError = FString::Printf(TEXT("Unclosed '[' at %d"), i); return false; }
+            const FString Inner = Selector.Mid(i + 1, Close - i - 1).TrimStartAndEnd();
+
+            if (Inner == TEXT("*"))
+            {
+                Segment.Kind = ESegment::Wildcard;
+            }
+            else if (Inner.Len() >= 2 && (Inner[0] == '\'' || Inner[0] == '"') && Inner[Inner.Len() - 1] == Inner[0])
+            {
+                Segment.Kind = ESegment::Field;
+                Segment.Name = Inner.Mid(1, Inner.Len() - 2);
+            }
+            else if (Inner.Len() > 0 && Inner.IsNumeric() && !Inner.Contains(TEXT(".")) && !Inner.StartsWith(TEXT("-")))
+            {
+                Segment.Kind = ESegment::Index;
+                Segment.Index = FCString::Atoi(*Inner);
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("Invalid bracket segment '%s'"), *Inner);
+                return false;
+            }
+            i = Close + 1;
+        }
+        else
+        {
+            if (!bAfterDot) { OutError = FString::Printf(TEXT("Expected '.' or '[' at %d"), i); return false; }
+            int32 NameEnd = i;
+            while (NameEnd < Len && Selector[NameEnd] != '.' && Selector[NameEnd] != '[') { ++NameEnd; }
+            const FString Name = Selector.Mid(i, NameEnd - i);
+            Segment.Kind = Name == TEXT("*") ? ESegment::Wildcard : ESegment::Field;
+            Segment.Name = Segment.Kind == ESegment::Field ? Name : FString();
+            i = NameEnd;
+        }
+
+        if (Segment.Kind == ESegment::Field)
+        {
+            FTCHARToUTF8 Utf8(*Segment.Name);
+            Segment.NameUtf8.Append((const uint8*)Utf8.Get(), Utf8.Length());
+        }
+        OutSegments.Add(MoveTemp(Segment));
+        bAfterDot = false;
+    }
+
+    if (bAfterDot && OutSegments.Num() > 0)
+    {
+        OutError = TEXT("Selector ends with '.'");
+        return false;
+    }
+    return true;
+}
+
+bool FQuickJsonPath::Extract(const FString& Json, TArray<FQuickJsonPathMatch>& OutMatches, FString* OutError) const
+{
+    return TPathScanner<TCHAR>(*this, *Json, Json.Len(), OutMatches).Run(OutError);
+}
+
+bool FQuickJsonPath::ExtractUtf8(TArrayView<const uint8> Json, TArray<FQuickJsonPathMatch>& OutMatches, FString* OutError) const
+{
+    return TPathScanner<uint8>(*this, Json.GetData(), Json.Num(), OutMatches).Run(OutError);
+}
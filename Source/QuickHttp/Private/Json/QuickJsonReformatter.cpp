@@ -0,0 +1,348 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonReformatter.h"
+#include "Json/QuickJsonSimd.h"
+
+namespace
+{
+    template <typename CharT, EQuickJsonFormat Format>
+    class TJsonReformatter
+    {
+    public:
+        TJsonReformatter(const CharT* InBegin, int32 InLen, TArray<CharT>* InOut)
+            : Begin(InBegin), End(InBegin + InLen), Out(InOut)
+        {
+        }
+
+        bool Run(FString* OutError)
+        {
+            const CharT* P = Begin;
+            while (true)
+            {
+                while (P < End && (*P == ' ' || *P == '\n' || *P == '\r' || *P == '\t')) { ++P; }
+                if (P == End) { break; }
+                const CharT C = *P;
+
+                switch (Expect)
+                {
+                case EExpect::ValueOrClose:
+                    if (C == ']')
+                    {
+                        // Empty array stays on one line
+                        CloseScope(P);
+                        continue;
+                    }
+                    NewLine(IsObjectStack.Num());
+                    if (!BeginValue(P, OutError)) { return false; }
+                    continue;
+
+                case EExpect::Value:
+                    if (!BeginValue(P, OutError)) { return false; }
+                    continue;
+
+                case EExpect::KeyOrClose:
+                    if (C == '}')
+                    {
+                        CloseScope(P);
+                        continue;
+                    }
+                    NewLine(IsObjectStack.Num());
+                    if (!BeginKey(P, OutError)) { return false; }
+                    continue;
+
+                case EExpect::Key:
+                    if (!BeginKey(P, OutError)) { return false; }
+                    continue;
+
+                case EExpect::Colon:
+                    if (C != ':') { return Fail(TEXT("Expected ':'"), P, OutError); }
+                    Put(':');
+                    if (Format == EQuickJsonFormat::Pretty) { Put(' '); }
+                    ++P;
+                    Expect = EExpect::Value;
+                    continue;
+
+                case EExpect::CommaOrClose:
+                {
+                    const bool bInObject = IsObjectStack.Last();
+                    if (C == ',')
+                    {
+                        Put(',');
+                        ++P;
+                        NewLine(IsObjectStack.Num());
+                        Expect = bInObject ? EExpect::Key : EExpect::Value;
+                        continue;
+                    }
+                    if ((bInObject && C == '}') || (!bInObject && C == ']'))
+                    {
+                        NewLine(IsObjectStack.Num() - 1);
+                        CloseScope(P);
+                        continue;
+                    }
+                    return Fail(bInObject ? TEXT("Expected ',' or '}'") : TEXT("Expected ',' or ']'"), P, OutError);
+                }
+
+                case EExpect::End:
+                    return Fail(TEXT("Unexpected data after the root value"), P, OutError);
+                }
+            }
+
+            if (Expect != EExpect::End)
+            {
+                return Fail(TEXT("Unexpected end of input"), P, OutError);
+            }
+            return true;
+        }
+
+    private:
+        enum class EExpect : uint8 { Value, ValueOrClose, Key, KeyOrClose, Colon, CommaOrClose, End };
+
+        FORCEINLINE void AfterValue()
+        {
+            Expect = IsObjectStack.Num() > 0 ? EExpect::CommaOrClose : EExpect::End;
+        }
+
+        bool BeginValue(const CharT*& P, FString* OutError)
+        {
+            if (*P == '{' || *P == '[')
+            {
+                const bool bObject = *P == '{';
+                Put(*P);
+                ++P;
+                IsObjectStack.Add(bObject);
+                Expect = bObject ? EExpect::KeyOrClose : EExpect::ValueOrClose;
+                return true;
+            }
+            if (!CopyScalar(P, OutError)) { return false; }
+            AfterValue();
+            return true;
+        }
+
+        bool BeginKey(const CharT*& P, FString* OutError)
+        {
+            if (*P != '"') { return Fail(TEXT("Expected a string key"), P, OutError); }
+            if (!CopyString(P, OutError)) { return false; }
+            Expect = EExpect::Colon;
+            return true;
+        }
+
+        void CloseScope(const CharT*& P)
+        {
+            Put(*P);
+            ++P;
+            IsObjectStack.Pop();
+            AfterValue();
+        }
+
+        FORCEINLINE void Put(CharT C)
+        {
+            if (Format != EQuickJsonFormat::Validate) { Out->Add(C); }
+        }
+
+        FORCEINLINE void PutSpan(const CharT* SpanBegin, const CharT* SpanEnd)
+        {
+            if (Format != EQuickJsonFormat::Validate) { Out->Append(SpanBegin, (int32)(SpanEnd - SpanBegin)); }
+        }
+
+        FORCEINLINE void NewLine(int32 Depth)
+        {
+            if (Format != EQuickJsonFormat::Pretty) { return; }
+            const int32 Start = Out->AddUninitialized(1 + Depth);
+            CharT* Dest = Out->GetData() + Start;
+            Dest[0] = '\n';
+            for (int32 i = 1; i <= Depth; ++i) { Dest[i] = '\t'; }
+        }
+
+        bool Fail(const TCHAR* What, const CharT* At, FString* OutError) const
+        {
+            if (OutError)
+            {
+                *OutError = FString::Printf(TEXT("%s at offset %d"), What, (int32)(At - Begin));
+            }
+            return false;
+        }
+
+        static FORCEINLINE bool IsDigit(CharT C) { return C >= '0' && C <= '9'; }
+
+        static FORCEINLINE bool IsHex(CharT C)
+        {
+            return IsDigit(C) || (C >= 'a' && C <= 'f') || (C >= 'A' && C <= 'F');
+        }
+
+        bool CopyString(const CharT*& P, FString* OutError)
+        {
+            const CharT* Start = P++;
+            while (true)
+            {
+                P = QuickJsonSimd::FindStringStop(P, End);
+                if (P == End) { return Fail(TEXT("Unterminated string"), Start, OutError); }
+
+                const CharT C = *P;
+                if (C == '"')
+                {
+                    ++P;
+                    PutSpan(Start, P);
+                    return true;
+                }
+                if (C == '\\')
+                {
+                    if (End - P < 2) { return Fail(TEXT("Unterminated string"), Start, OutError); }
+                    const CharT E = P[1];
+                    if (E == 'u')
+                    {
+                        if (End - P < 6 || !IsHex(P[2]) || !IsHex(P[3]) || !IsHex(P[4]) || !IsHex(P[5]))
+                        {
+                            return Fail(TEXT("Invalid \\u escape"), P, OutError);
+                        }
+                        P += 6;
+                        continue;
+                    }
+                    if (E != '"' && E != '\\' && E != '/' && E != 'b' && E != 'f' && E != 'n' && E != 'r' && E != 't')
+                    {
+                        return Fail(TEXT("Invalid escape sequence"), P, OutError);
+                    }
+                    P += 2;
+                    continue;
+                }
+                if ((uint32)C < 0x20u)
+                {
+                    return Fail(TEXT("Control character in string"), P, OutError);
+                }
+                // Vector false positive (out-of-range code unit); plain content
+                ++P;
+            }
+        }
+
+        bool CopyLiteral(const CharT*& P, const ANSICHAR* Literal, int32 Len, FString* OutError)
+        {
+            if (End - P < Len) { return Fail(TEXT("Invalid literal"), P, OutError); }
+            for (int32 i = 0; i < Len; ++i)
+            {
+                if (P[i] != (CharT)Literal[i]) { return Fail(TEXT("Invalid literal"), P, OutError); }
+            }
+            PutSpan(P, P + Len);
+            P += Len;
+            return true;
+        }
+
+        bool CopyNumber(const CharT*& P, FString* OutError)
+        {
+            const CharT* Start = P;
+            if (*P == '-') { ++P; }
+
+            if (P < End && *P == '0') { ++P; }
+            else if (P < End && IsDigit(*P)) { while (P < End && IsDigit(*P)) { ++P; } }
+            else { return Fail(TEXT("Invalid number"), Start, OutError); }
+
+            if (P < End && *P == '.')
+            {
+                ++P;
+                if (P == End || !IsDigit(*P)) { return Fail(TEXT("Invalid number"), Start, OutError); }
+                while (P < End && IsDigit(*P)) { ++P; }
+            }
+            if (P < End && (*P == 'e' || *P == 'E'))
+            {
+                ++P;
+                if (P < End && (*P == '+' || *P == '-')) { ++P; }
+                if (P == End || !IsDigit(*P)) { return Fail(TEXT("Invalid number"), Start, OutError); }
+                while (P < End && IsDigit(*P)) { ++P; }
+            }
+            PutSpan(Start, P);
+            return true;
+        }
+
+        bool CopyScalar(const CharT*& P, FString* OutError)
+        {
+            switch (*P)
+            {
+            case '"': return CopyString(P, OutError);
+            case 't': return CopyLiteral(P, "true", 4, OutError);
+            case 'f': return CopyLiteral(P, "false", 5, OutError);
+            case 'n': return CopyLiteral(P, "null", 4, OutError);
+            default:
+                if (*P == '-' || IsDigit(*P)) { return CopyNumber(P, OutError); }
+                return Fail(TEXT("Unexpected character"), P, OutError);
+            }
+        }
+
+        const CharT* Begin;
+        const CharT* End;
+        TArray<CharT>* Out;
+        TArray<bool, TInlineAllocator<64>> IsObjectStack;
+        EExpect Expect = EExpect::Value;
+    };
+
+    template <typename CharT>
+    bool RunReformatter(const CharT* Data, int32 Len, EQuickJsonFormat Format, TArray<CharT>& Out, FString* OutError)
+    {
+        switch (Format)
+        {
+        case EQuickJsonFormat::Minify:
+            Out.Reserve(Out.Num() + Len);
+            return TJsonReformatter<CharT, EQuickJsonFormat::Minify>(Data, Len, &Out).Run(OutError);
+        case EQuickJsonFormat::Pretty:
+            Out.Reserve(Out.Num() + Len + Len / 2);
+            return TJsonReformatter<CharT, EQuickJsonFormat::Pretty>(Data, Len, &Out).Run(OutError);
+        default:
+            return TJsonReformatter<CharT, EQuickJsonFormat::Validate>(Data, Len, nullptr).Run(OutError);
+        }
+    }
+}
+
+bool FQuickJsonReformatter::Reformat(const FString& Json, EQuickJsonFormat Format, FString& Out, FString* OutError)
+{
+    if (&Json == &Out)
+    {
+        const FString Copy = Json;
+        return Reformat(Copy, Format, Out, OutError);
+    }
+
+    Out.Empty();
+    TArray<TCHAR>& Chars = Out.GetCharArray();
+    if (!RunReformatter<TCHAR>(*Json, Json.Len(), Format, Chars, OutError))
+    {
+        Out.Empty();
+        return false;
+    }
+    if (Chars.Num() > 0)
+    {
+        Chars.Add(TEXT('\0'));
+    }
+    return true;
+}
+
+bool FQuickJsonReformatter::ReformatUtf8(TArrayView<const uint8> Json, EQuickJsonFormat Format, TArray<uint8>& Out, FString* OutError)
+{
+    Out.Reset();
+    if (!RunReformatter<uint8>(Json.GetData(), Json.Num(), Format, Out, OutError))
+    {
+        Out.Reset();
+        return false;
+    }
+    return true;
+}
+
+bool FQuickJsonReformatter::Validate(const FString& Json, FString* OutError)
+{
+    TArray<TCHAR> Unused;
+    return RunReformatter<TCHAR>(*Json, Json.Len(), EQuickJsonFormat::Validate, Unused, OutError);
+}
+
+bool FQuickJsonReformatter::ValidateUtf8(TArrayView<const uint8> Json, FString* OutError)
+{
+    TArray<uint8> Unused;
+    return RunReformatter<uint8>(Json.GetData(), Json.Num(), EQuickJsonFormat::Validate, Unused, OutError);
+}
+
+const TCHAR* FQuickJsonReformatter::GetSimdPathName()
+{
+#if QUICKJSON_SIMD_AVX2
+    return TEXT("AVX2");
+#elif QUICKJSON_SIMD_SSE2
+    return TEXT("SSE2");
+#elif QUICKJSON_SIMD_NEON
+    return TEXT("NEON");
+#else
+    return TEXT("Scalar");
+#endif
+}
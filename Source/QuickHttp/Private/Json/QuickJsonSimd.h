@@ -0,0 +1,323 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+// Vector scanning helpers shared by the JSON reformatter and path extractor.
+// x86 uses SSE2 (AVX2 when the target is compiled for it), ARM64 uses NEON; anything else is scalar.
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define QUICKJSON_SIMD_NEON 1
+    #include <arm_neon.h>
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+    #define QUICKJSON_SIMD_SSE2 1
+    #include <emmintrin.h>
+    #if defined(__AVX2__)
+        #define QUICKJSON_SIMD_AVX2 1
+        #include <immintrin.h>
+    #endif
+#endif
+
+#ifndef QUICKJSON_SIMD_NEON
+    #define QUICKJSON_SIMD_NEON 0
+#endif
+#ifndef QUICKJSON_SIMD_SSE2
+    #define QUICKJSON_SIMD_SSE2 0
+#endif
+#ifndef QUICKJSON_SIMD_AVX2
+    #define QUICKJSON_SIMD_AVX2 0
+#endif
+
+namespace QuickJsonSimd
+{
+    /**
+     * Stop mask for one block: a set bit for every character that ends a run of plain string
+     * content ('"', '\\' or a control character). BitsPerByte bits per input byte.
+     */
+    template <int32 CharSize> struct TStopMask;
+
+    /** Same layout as TStopMask, for the characters that matter when skipping a value: '"', '{', '}', '[', ']'. */
+    template <int32 CharSize> struct TContainerMask;
+
+#if QUICKJSON_SIMD_AVX2
+    static constexpr int32 BlockBytes = 32;
+    static constexpr int32 BitsPerByte = 1;
+
+    template <> struct TStopMask<1>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m256i V = _mm256_loadu_si256((const __m256i*)P);
+            const __m256i Quote = _mm256_cmpeq_epi8(V, _mm256_set1_epi8('"'));
+            const __m256i Slash = _mm256_cmpeq_epi8(V, _mm256_set1_epi8('\\'));
+            const __m256i Ctrl = _mm256_cmpeq_epi8(_mm256_subs_epu8(V, _mm256_set1_epi8(0x1F)), _mm256_setzero_si256());
+            return (uint32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(Quote, Slash), Ctrl));
+        }
+    };
+    template <> struct TStopMask<2>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m256i V = _mm256_loadu_si256((const __m256i*)P);
+            const __m256i Quote = _mm256_cmpeq_epi16(V, _mm256_set1_epi16('"'));
+            const __m256i Slash = _mm256_cmpeq_epi16(V, _mm256_set1_epi16('\\'));
+            const __m256i Ctrl = _mm256_cmpeq_epi16(_mm256_subs_epu16(V, _mm256_set1_epi16(0x1F)), _mm256_setzero_si256());
+            return (uint32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(Quote, Slash), Ctrl));
+        }
+    };
+    template <> struct TStopMask<4>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m256i V = _mm256_loadu_si256((const __m256i*)P);
+            const __m256i Quote = _mm256_cmpeq_epi32(V, _mm256_set1_epi32('"'));
+            const __m256i Slash = _mm256_cmpeq_epi32(V, _mm256_set1_epi32('\\'));
+            const __m256i Ctrl = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x20), V);
+            return (uint32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(Quote, Slash), Ctrl));
+        }
+    };
+
+    // '[' | 0x20 == '{' and ']' | 0x20 == '}', so two compares find all four brackets
+    template <> struct TContainerMask<1>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m256i V = _mm256_loadu_si256((const __m256i*)P);
+            const __m256i Folded = _mm256_or_si256(V, _mm256_set1_epi8(0x20));
+            const __m256i Quote = _mm256_cmpeq_epi8(V, _mm256_set1_epi8('"'));
+            const __m256i Open = _mm256_cmpeq_epi8(Folded, _mm256_set1_epi8('{'));
+            const __m256i Close = _mm256_cmpeq_epi8(Folded, _mm256_set1_epi8('}'));
+            return (uint32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(Quote, Open), Close));
+        }
+    };
+    template <> struct TContainerMask<2>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m256i V = _mm256_loadu_si256((const __m256i*)P);
+            const __m256i Folded = _mm256_or_si256(V, _mm256_set1_epi16(0x20));
+            const __m256i Quote = _mm256_cmpeq_epi16(V, _mm256_set1_epi16('"'));
+            const __m256i Open = _mm256_cmpeq_epi16(Folded, _mm256_set1_epi16('{'));
+            const __m256i Close = _mm256_cmpeq_epi16(Folded, _mm256_set1_epi16('}'));
+            return (uint32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(Quote, Open), Close));
+        }
+    };
+    template <> struct TContainerMask<4>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m256i V = _mm256_loadu_si256((const __m256i*)P);
+            const __m256i Folded = _mm256_or_si256(V, _mm256_set1_epi32(0x20));
+            const __m256i Quote = _mm256_cmpeq_epi32(V, _mm256_set1_epi32('"'));
+            const __m256i Open = _mm256_cmpeq_epi32(Folded, _mm256_set1_epi32('{'));
+            const __m256i Close = _mm256_cmpeq_epi32(Folded, _mm256_set1_epi32('}'));
+            return (uint32)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(Quote, Open), Close));
+        }
+    };
+#elif QUICKJSON_SIMD_SSE2
+    static constexpr int32 BlockBytes = 16;
+    static constexpr int32 BitsPerByte = 1;
+
+    template <> struct TStopMask<1>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m128i V = _mm_loadu_si128((const __m128i*)P);
+            const __m128i Quote = _mm_cmpeq_epi8(V, _mm_set1_epi8('"'));
+            const __m128i Slash = _mm_cmpeq_epi8(V, _mm_set1_epi8('\\'));
+            const __m128i Ctrl = _mm_cmpeq_epi8(_mm_subs_epu8(V, _mm_set1_epi8(0x1F)), _mm_setzero_si128());
+            return (uint32)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Quote, Slash), Ctrl));
+        }
+    };
+    template <> struct TStopMask<2>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m128i V = _mm_loadu_si128((const __m128i*)P);
+            const __m128i Quote = _mm_cmpeq_epi16(V, _mm_set1_epi16('"'));
+            const __m128i Slash = _mm_cmpeq_epi16(V, _mm_set1_epi16('\\'));
+            const __m128i Ctrl = _mm_cmpeq_epi16(_mm_subs_epu16(V, _mm_set1_epi16(0x1F)), _mm_setzero_si128());
+            return (uint32)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Quote, Slash), Ctrl));
+        }
+    };
+    template <> struct TStopMask<4>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m128i V = _mm_loadu_si128((const __m128i*)P);
+            const __m128i Quote = _mm_cmpeq_epi32(V, _mm_set1_epi32('"'));
+            const __m128i Slash = _mm_cmpeq_epi32(V, _mm_set1_epi32('\\'));
+            const __m128i Ctrl = _mm_cmplt_epi32(V, _mm_set1_epi32(0x20));
+            return (uint32)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Quote, Slash), Ctrl));
+        }
+    };
+
+    // '[' | 0x20 == '{' and ']' | 0x20 == '}', so two compares find all four brackets
+    template <> struct TContainerMask<1>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m128i V = _mm_loadu_si128((const __m128i*)P);
+            const __m128i Folded = _mm_or_si128(V, _mm_set1_epi8(0x20));
+            const __m128i Quote = _mm_cmpeq_epi8(V, _mm_set1_epi8('"'));
+            const __m128i Open = _mm_cmpeq_epi8(Folded, _mm_set1_epi8('{'));
+            const __m128i Close = _mm_cmpeq_epi8(Folded, _mm_set1_epi8('}'));
+            return (uint32)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Quote, Open), Close));
+        }
+    };
+    template <> struct TContainerMask<2>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m128i V = _mm_loadu_si128((const __m128i*)P);
+            const __m128i Folded = _mm_or_si128(V, _mm_set1_epi16(0x20));
+            const __m128i Quote = _mm_cmpeq_epi16(V, _mm_set1_epi16('"'));
+            const __m128i Open = _mm_cmpeq_epi16(Folded, _mm_set1_epi16('{'));
+            const __m128i Close = _mm_cmpeq_epi16(Folded, _mm_set1_epi16('}'));
+            return (uint32)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Quote, Open), Close));
+        }
+    };
+    template <> struct TContainerMask<4>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const __m128i V = _mm_loadu_si128((const __m128i*)P);
+            const __m128i Folded = _mm_or_si128(V, _mm_set1_epi32(0x20));
+            const __m128i Quote = _mm_cmpeq_epi32(V, _mm_set1_epi32('"'));
+            const __m128i Open = _mm_cmpeq_epi32(Folded, _mm_set1_epi32('{'));
+            const __m128i Close = _mm_cmpeq_epi32(Folded, _mm_set1_epi32('}'));
+            return (uint32)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(Quote, Open), Close));
+        }
+    };
+#elif QUICKJSON_SIMD_NEON
+    static constexpr int32 BlockBytes = 16;
+    static constexpr int32 BitsPerByte = 4;
+
+    /** NEON has no movemask; narrow each byte lane to a nibble instead. */
+    static FORCEINLINE uint64 NibbleMask(uint8x16_t Matches)
+    {
+        return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Matches), 4)), 0);
+    }
+
+    template <> struct TStopMask<1>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const uint8x16_t V = vld1q_u8(P);
+            const uint8x16_t M = vorrq_u8(vorrq_u8(vceqq_u8(V, vdupq_n_u8('"')), vceqq_u8(V, vdupq_n_u8('\\'))), vcleq_u8(V, vdupq_n_u8(0x1F)));
+            return NibbleMask(M);
+        }
+    };
+    template <> struct TStopMask<2>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const uint16x8_t V = vld1q_u16((const uint16_t*)P);
+            const uint16x8_t M = vorrq_u16(vorrq_u16(vceqq_u16(V, vdupq_n_u16('"')), vceqq_u16(V, vdupq_n_u16('\\'))), vcleq_u16(V, vdupq_n_u16(0x1F)));
+            return NibbleMask(vreinterpretq_u8_u16(M));
+        }
+    };
+    template <> struct TStopMask<4>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const uint32x4_t V = vld1q_u32((const uint32_t*)P);
+            const uint32x4_t M = vorrq_u32(vorrq_u32(vceqq_u32(V, vdupq_n_u32('"')), vceqq_u32(V, vdupq_n_u32('\\'))), vcleq_u32(V, vdupq_n_u32(0x1F)));
+            return NibbleMask(vreinterpretq_u8_u32(M));
+        }
+    };
+
+    // '[' | 0x20 == '{' and ']' | 0x20 == '}', so two compares find all four brackets
+    template <> struct TContainerMask<1>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const uint8x16_t V = vld1q_u8(P);
+            const uint8x16_t Folded = vorrq_u8(V, vdupq_n_u8(0x20));
+            const uint8x16_t M = vorrq_u8(vorrq_u8(vceqq_u8(V, vdupq_n_u8('"')), vceqq_u8(Folded, vdupq_n_u8('{'))), vceqq_u8(Folded, vdupq_n_u8('}')));
+            return NibbleMask(M);
+        }
+    };
+    template <> struct TContainerMask<2>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const uint16x8_t V = vld1q_u16((const uint16_t*)P);
+            const uint16x8_t Folded = vorrq_u16(V, vdupq_n_u16(0x20));
+            const uint16x8_t M = vorrq_u16(vorrq_u16(vceqq_u16(V, vdupq_n_u16('"')), vceqq_u16(Folded, vdupq_n_u16('{'))), vceqq_u16(Folded, vdupq_n_u16('}')));
+            return NibbleMask(vreinterpretq_u8_u16(M));
+        }
+    };
+    template <> struct TContainerMask<4>
+    {
+        static FORCEINLINE uint64 Get(const uint8* P)
+        {
+            const uint32x4_t V = vld1q_u32((const uint32_t*)P);
+            const uint32x4_t Folded = vorrq_u32(V, vdupq_n_u32(0x20));
+            const uint32x4_t M = vorrq_u32(vorrq_u32(vceqq_u32(V, vdupq_n_u32('"')), vceqq_u32(Folded, vdupq_n_u32('{'))), vceqq_u32(Folded, vdupq_n_u32('}')));
+            return NibbleMask(vreinterpretq_u8_u32(M));
+        }
+    };
+#endif
+
+    static FORCEINLINE int32 LowestSetBit(uint64 Mask)
+    {
+        const uint32 Low = (uint32)Mask;
+        return Low != 0 ? (int32)FMath::CountTrailingZeros(Low) : 32 + (int32)FMath::CountTrailingZeros((uint32)(Mask >> 32));
+    }
+
+    template <typename CharT>
+    static FORCEINLINE bool IsStringStop(CharT C)
+    {
+        return C == '"' || C == '\\' || (uint32)C < 0x20u;
+    }
+
+    /**
+     * First character in [P, End) that may end plain string content.
+     * Vector paths may also stop early on characters outside the valid code point range; callers re-check.
+     */
+    template <typename CharT>
+    static FORCEINLINE const CharT* FindStringStop(const CharT* P, const CharT* End)
+    {
+#if QUICKJSON_SIMD_AVX2 || QUICKJSON_SIMD_SSE2 || QUICKJSON_SIMD_NEON
+        constexpr int32 CharsPerBlock = BlockBytes / (int32)sizeof(CharT);
+        while (End - P >= CharsPerBlock)
+        {
+            const uint64 Mask = TStopMask<(int32)sizeof(CharT)>::Get((const uint8*)P);
+            if (Mask != 0)
+            {
+                return P + (LowestSetBit(Mask) / BitsPerByte) / (int32)sizeof(CharT);
+            }
+            P += CharsPerBlock;
+        }
+#endif
+        while (P < End && !IsStringStop(*P)) { ++P; }
+        return P;
+    }
+
+    template <typename CharT>
+    static FORCEINLINE bool IsContainerStop(CharT C)
+    {
+        return C == '"' || C == '{' || C == '}' || C == '[' || C == ']';
+    }
+
+    /** First '"', '{', '}', '[' or ']' in [P, End), or End. */
+    template <typename CharT>
+    static FORCEINLINE const CharT* FindContainerStop(const CharT* P, const CharT* End)
+    {
+#if QUICKJSON_SIMD_AVX2 || QUICKJSON_SIMD_SSE2 || QUICKJSON_SIMD_NEON
+        constexpr int32 CharsPerBlock = BlockBytes / (int32)sizeof(CharT);
+        while (End - P >= CharsPerBlock)
+        {
+            const uint64 Mask = TContainerMask<(int32)sizeof(CharT)>::Get((const uint8*)P);
+            if (Mask != 0)
+            {
+                return P + (LowestSetBit(Mask) / BitsPerByte) / (int32)sizeof(CharT);
+            }
+            P += CharsPerBlock;
+        }
+#endif
+        while (P < End && !IsContainerStop(*P)) { ++P; }
+        return P;
+    }
+}
@@ -0,0 +1,118 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonStreamWriter.h"
+#include "Json/QuickJsonStruct.h"
+#include "UObject/UnrealType.h"
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::NewJsonStreamWriter(int32 InitialCapacityBytes)
+{
+    UQuickJsonStreamWriter* W = NewObject<UQuickJsonStreamWriter>();
+    W->Writer = FQuickJsonWriter(InitialCapacityBytes);
+    return W;
+}
+
+void UQuickJsonStreamWriter::NameIfAny(const FString& Name)
+{
+    // Let the writer report a missing or misplaced name as a nesting error
+    if (!Name.IsEmpty()) { Writer.Key(Name); }
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::BeginObject(const FString& Name)
+{
+    NameIfAny(Name);
+    Writer.BeginObject();
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::EndObject()
+{
+    Writer.EndObject();
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::BeginArray(const FString& Name)
+{
+    NameIfAny(Name);
+    Writer.BeginArray();
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::EndArray()
+{
+    Writer.EndArray();
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::WriteString(const FString& Name, const FString& Value)
+{
+    NameIfAny(Name);
+    Writer.String(Value);
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::WriteInt(const FString& Name, int32 Value)
+{
+    NameIfAny(Name);
+    Writer.Int(Value);
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::WriteNumber(const FString& Name, float Value)
+{
+    NameIfAny(Name);
+    Writer.Number((double)Value);
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::WriteBool(const FString& Name, bool bValue)
+{
+    NameIfAny(Name);
+    Writer.Bool(bValue);
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::WriteNull(const FString& Name)
+{
+    NameIfAny(Name);
+    Writer.Null();
+    return this;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::WriteStructValue(const FString& Name, const UStruct* Type, const void* Value)
+{
+    NameIfAny(Name);
+    FQuickJsonStruct::Write(Type, Value, Writer);
+    return this;
+}
+
+DEFINE_FUNCTION(UQuickJsonStreamWriter::execWriteStruct)
+{
+    P_GET_PROPERTY(FStrProperty, Name);
+    Stack.MostRecentProperty = nullptr;
+    Stack.StepCompiledIn<FStructProperty>(nullptr);
+    const FStructProperty* StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+    const void* StructPtr = Stack.MostRecentPropertyAddress;
+    P_FINISH;
+
+    const UScriptStruct* Type = nullptr;
+    if (StructProperty) { Type = StructProperty->Struct; }
+    P_NATIVE_BEGIN;
+    *(UQuickJsonStreamWriter**)RESULT_PARAM = P_THIS->WriteStructValue(Name, Type, StructPtr);
+    P_NATIVE_END;
+}
+
+UQuickJsonStreamWriter* UQuickJsonStreamWriter::Reset()
+{
+    Writer.Reset();
+    return this;
+}
+
+bool UQuickJsonStreamWriter::IsComplete(FString& OutError) const
+{
+    OutError = Writer.GetError();
+    if (OutError.IsEmpty() && !Writer.IsComplete())
+    {
+        OutError = TEXT("Unclosed object/array or nothing written");
+    }
+    return Writer.IsComplete();
+}
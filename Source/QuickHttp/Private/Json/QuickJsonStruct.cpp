@@ -0,0 +1,1183 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonStruct.h"
+#include "Json/QuickJsonSimd.h"
+#include "QuickHttpCompat.h"
+#include "JsonObjectConverter.h"
+#include "JsonObjectWrapper.h"
+#include "Misc/OutputDeviceNull.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    enum class EValueKind : uint8
+    {
+        Bool,
+        Int,
+        Float,
+        Double,
+        Enum,
+        String,
+        Name,
+        Text,
+        Struct,
+        TextStruct,
+        Array,
+        Set,
+        Map,
+        SoftObject,
+        Object,
+        Unsupported
+    };
+
+    FORCEINLINE int32 GetArrayDim(const FProperty* Property)
+    {
+#if QUICKHTTP_HAS_ARRAY_DIM_GETTER
+        return Property->GetArrayDim();
+#else
+        return Property->ArrayDim;
+#endif
+    }
+
+    bool IsMapKeyKind(EValueKind Kind)
+    {
+        switch (Kind)
+        {
+        case EValueKind::Bool:
+        case EValueKind::Int:
+        case EValueKind::Float:
+        case EValueKind::Double:
+        case EValueKind::Enum:
+        case EValueKind::String:
+        case EValueKind::Name:
+        case EValueKind::Text:
+        case EValueKind::TextStruct:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    EValueKind Classify(const FProperty* Property)
+    {
+        if (CastField<FBoolProperty>(Property)) { return EValueKind::Bool; }
+        if (CastField<FEnumProperty>(Property)) { return EValueKind::Enum; }
+        if (const FNumericProperty* Numeric = CastField<FNumericProperty>(Property))
+        {
+            if (Numeric->GetIntPropertyEnum()) { return EValueKind::Enum; }
+            if (!Numeric->IsFloatingPoint()) { return EValueKind::Int; }
+            return CastField<FFloatProperty>(Property) ? EValueKind::Float : EValueKind::Double;
+        }
+        if (CastField<FStrProperty>(Property)) { return EValueKind::String; }
+        if (CastField<FNameProperty>(Property)) { return EValueKind::Name; }
+        if (CastField<FTextProperty>(Property)) { return EValueKind::Text; }
+        if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+        {
+            // The wrapper holds a DOM, which is what this codec avoids; FJsonObjectConverter handles it
+            if (StructProperty->Struct == FJsonObjectWrapper::StaticStruct()) { return EValueKind::Unsupported; }
+            // Same rule as FJsonObjectConverter: structs with a text form (FGuid, FDateTime...) are strings
+            UScriptStruct::ICppStructOps* Ops = StructProperty->Struct->GetCppStructOps();
+            return Ops && Ops->HasExportTextItem() && Ops->HasImportTextItem() ? EValueKind::TextStruct : EValueKind::Struct;
+        }
+        if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            return Classify(ArrayProperty->Inner) == EValueKind::Unsupported ? EValueKind::Unsupported : EValueKind::Array;
+        }
+        if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+        {
+            return Classify(SetProperty->ElementProp) == EValueKind::Unsupported ? EValueKind::Unsupported : EValueKind::Set;
+        }
+        if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+        {
+            return IsMapKeyKind(Classify(MapProperty->KeyProp)) && Classify(MapProperty->ValueProp) != EValueKind::Unsupported
+                ? EValueKind::Map : EValueKind::Unsupported;
+        }
+        if (CastField<FSoftObjectProperty>(Property)) { return EValueKind::SoftObject; }
+        if (CastField<FObjectPropertyBase>(Property)) { return EValueKind::Object; }
+        return EValueKind::Unsupported;
+    }
+
+    void GetEnumParts(const FProperty* Property, const UEnum*& OutEnum, const FNumericProperty*& OutNumeric)
+    {
+        if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+        {
+            OutEnum = EnumProperty->GetEnum();
+            OutNumeric = EnumProperty->GetUnderlyingProperty();
+            return;
+        }
+        OutNumeric = CastFieldChecked<FNumericProperty>(Property);
+        OutEnum = OutNumeric->GetIntPropertyEnum();
+    }
+
+    FORCEINLINE const UScriptStruct* GetStruct(const FProperty* Property)
+    {
+        return static_cast<const FStructProperty*>(Property)->Struct;
+    }
+
+    struct FFieldInfo
+    {
+        const FProperty* Property = nullptr;
+        EValueKind Kind = EValueKind::Unsupported;
+        // JSON name as FJsonObjectConverter writes it, raw and as an encoded key
+        FString Name;
+        TArray<uint8> NameUtf8;
+        TArray<uint8> Key;
+    };
+
+    struct FStructLayout
+    {
+        TWeakObjectPtr<const UStruct> Type;
+        TArray<FFieldInfo> Fields;
+    };
+
+    typedef TSharedPtr<const FStructLayout, ESPMode::ThreadSafe> FStructLayoutPtr;
+
+    /** Field lists by struct. Cleared wholesale when full, like the JSON path cache. */
+    struct FLayoutCache
+    {
+        static constexpr int32 MaxEntries = 1024;
+
+        FRWLock Lock;
+        TMap<const UStruct*, FStructLayoutPtr> Layouts;
+    };
+
+    FLayoutCache& GetLayoutCache()
+    {
+        static FLayoutCache Cache;
+        return Cache;
+    }
+
+    bool IsLayoutStable(const UStruct* Type)
+    {
+#if WITH_EDITOR
+        // Blueprint structs are recompiled in place while the editor runs, so only native layouts can be kept
+        if (const UScriptStruct* Script = Cast<UScriptStruct>(Type))
+        {
+            return (Script->StructFlags & STRUCT_Native) != 0;
+        }
+        const UClass* Class = Cast<UClass>(Type);
+        return Class && Class->HasAnyClassFlags(CLASS_Native);
+#else
+        return true;
+#endif
+    }
+
+    FStructLayoutPtr BuildLayout(const UStruct* Type)
+    {
+        TSharedRef<FStructLayout, ESPMode::ThreadSafe> Layout = MakeShared<FStructLayout, ESPMode::ThreadSafe>();
+        Layout->Type = Type;
+        for (TFieldIterator<FProperty> It(Type); It; ++It)
+        {
+            const FProperty* Property = *It;
+            // The fields FJsonObjectConverter writes by default
+            if (Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient)) { continue; }
+            const EValueKind Kind = Classify(Property);
+            if (Kind == EValueKind::Unsupported) { continue; }
+
+            FFieldInfo& Field = Layout->Fields.AddDefaulted_GetRef();
+            Field.Property = Property;
+            Field.Kind = Kind;
+            Field.Name = FJsonObjectConverter::StandardizeCase(Property->GetAuthoredName());
+            FTCHARToUTF8 Utf8(*Field.Name);
+            Field.NameUtf8.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+            Field.Key = FQuickJsonWriter::EncodeKey(Field.Name);
+        }
+        return Layout;
+    }
+
+    FStructLayoutPtr GetLayout(const UStruct* Type)
+    {
+        const bool bCacheable = IsLayoutStable(Type);
+        FLayoutCache& Cache = GetLayoutCache();
+        if (bCacheable)
+        {
+            FReadScopeLock ReadLock(Cache.Lock);
+            const FStructLayoutPtr* Found = Cache.Layouts.Find(Type);
+            // A collected struct's address can be reused by a new one
+            if (Found && (*Found)->Type.Get() == Type)
+            {
+                return *Found;
+            }
+        }
+
+        FStructLayoutPtr Layout = BuildLayout(Type);
+        if (bCacheable)
+        {
+            FWriteScopeLock WriteLock(Cache.Lock);
+            if (Cache.Layouts.Num() >= FLayoutCache::MaxEntries)
+            {
+                Cache.Layouts.Reset();
+            }
+            Cache.Layouts.Add(Type, Layout);
+        }
+        return Layout;
+    }
+
+    FORCEINLINE FString SpanToString(const uint8* Begin, const uint8* End)
+    {
+        if (Begin == End) { return FString(); }
+        FUTF8ToTCHAR Converted((const ANSICHAR*)Begin, (int32)(End - Begin));
+        return FString(Converted.Length(), Converted.Get());
+    }
+
+    FString ExportStructText(const UScriptStruct* Struct, const void* Value)
+    {
+        FString Text;
+        Struct->GetCppStructOps()->ExportTextItem(Text, Value, nullptr, nullptr, PPF_None, nullptr);
+        return Text;
+    }
+
+    bool ImportStructText(const UScriptStruct* Struct, void* Value, const FString& Text)
+    {
+        const TCHAR* Buffer = *Text;
+        FOutputDeviceNull Errors;
+        return Struct->GetCppStructOps()->ImportTextItem(Buffer, Value, PPF_None, nullptr, &Errors);
+    }
+
+    class FStructWriter
+    {
+    public:
+        explicit FStructWriter(FQuickJsonWriter& InWriter)
+            : Writer(InWriter)
+        {
+        }
+
+        void WriteStruct(const FStructLayout& Layout, const void* Data)
+        {
+            Writer.BeginObject();
+            for (const FFieldInfo& Field : Layout.Fields)
+            {
+                Writer.EncodedKey(Field.Key);
+                const int32 Dim = GetArrayDim(Field.Property);
+                if (Dim == 1)
+                {
+                    WriteValue(Field.Property, Field.Kind, Field.Property->ContainerPtrToValuePtr<void>(Data));
+                    continue;
+                }
+                // Static arrays are JSON arrays, as FJsonObjectConverter writes them
+                Writer.BeginArray();
+                for (int32 Index = 0; Index < Dim; ++Index)
+                {
+                    WriteValue(Field.Property, Field.Kind, Field.Property->ContainerPtrToValuePtr<void>(Data, Index));
+                }
+                Writer.EndArray();
+            }
+            Writer.EndObject();
+        }
+
+    private:
+        void WriteValue(const FProperty* Property, EValueKind Kind, const void* Value)
+        {
+            switch (Kind)
+            {
+            case EValueKind::Bool:
+                Writer.Bool(static_cast<const FBoolProperty*>(Property)->GetPropertyValue(Value));
+                break;
+
+            case EValueKind::Int:
+                Writer.Int(static_cast<const FNumericProperty*>(Property)->GetSignedIntPropertyValue(Value));
+                break;
+
+            case EValueKind::Float:
+                Writer.Float(static_cast<const FFloatProperty*>(Property)->GetPropertyValue(Value));
+                break;
+
+            case EValueKind::Double:
+                Writer.Number(static_cast<const FNumericProperty*>(Property)->GetFloatingPointPropertyValue(Value));
+                break;
+
+            case EValueKind::Enum:
+            {
+                const UEnum* Enum = nullptr;
+                const FNumericProperty* Numeric = nullptr;
+                GetEnumParts(Property, Enum, Numeric);
+                const int64 Raw = Numeric->GetSignedIntPropertyValue(Value);
+                const FString Name = Enum->GetNameStringByValue(Raw);
+                if (Name.IsEmpty()) { Writer.Int(Raw); }
+                else { Writer.String(Name); }
+                break;
+            }
+
+            case EValueKind::String:
+                Writer.String(static_cast<const FStrProperty*>(Property)->GetPropertyValue(Value));
+                break;
+
+            case EValueKind::Name:
+                Writer.String(static_cast<const FNameProperty*>(Property)->GetPropertyValue(Value).ToString());
+                break;
+
+            case EValueKind::Text:
+                Writer.String(static_cast<const FTextProperty*>(Property)->GetPropertyValue(Value).ToString());
+                break;
+
+            case EValueKind::Struct:
+                WriteStruct(*GetLayout(GetStruct(Property)), Value);
+                break;
+
+            case EValueKind::TextStruct:
+                Writer.String(ExportStructText(GetStruct(Property), Value));
+                break;
+
+            case EValueKind::Array:
+            {
+                const FArrayProperty* ArrayProperty = static_cast<const FArrayProperty*>(Property);
+                const EValueKind InnerKind = Classify(ArrayProperty->Inner);
+                FScriptArrayHelper Helper(ArrayProperty, Value);
+                Writer.BeginArray();
+                if (InnerKind == EValueKind::Struct)
+                {
+                    // One layout lookup for the whole array
+                    const FStructLayoutPtr Layout = GetLayout(GetStruct(ArrayProperty->Inner));
+                    for (int32 Index = 0; Index < Helper.Num(); ++Index)
+                    {
+                        WriteStruct(*Layout, Helper.GetRawPtr(Index));
+                    }
+                }
+                else
+                {
+                    for (int32 Index = 0; Index < Helper.Num(); ++Index)
+                    {
+                        WriteValue(ArrayProperty->Inner, InnerKind, Helper.GetRawPtr(Index));
+                    }
+                }
+                Writer.EndArray();
+                break;
+            }
+
+            case EValueKind::Set:
+            {
+                const FSetProperty* SetProperty = static_cast<const FSetProperty*>(Property);
+                const EValueKind ElementKind = Classify(SetProperty->ElementProp);
+                FScriptSetHelper Helper(SetProperty, Value);
+                Writer.BeginArray();
+                for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+                {
+                    if (Helper.IsValidIndex(Index))
+                    {
+                        WriteValue(SetProperty->ElementProp, ElementKind, Helper.GetElementPtr(Index));
+                    }
+                }
+                Writer.EndArray();
+                break;
+            }
+
+            case EValueKind::Map:
+            {
+                const FMapProperty* MapProperty = static_cast<const FMapProperty*>(Property);
+                const EValueKind KeyKind = Classify(MapProperty->KeyProp);
+                const EValueKind ValueKind = Classify(MapProperty->ValueProp);
+                FScriptMapHelper Helper(MapProperty, Value);
+                Writer.BeginObject();
+                for (int32 Index = 0; Index < Helper.GetMaxIndex(); ++Index)
+                {
+                    if (Helper.IsValidIndex(Index))
+                    {
+                        Writer.Key(KeyToString(MapProperty->KeyProp, KeyKind, Helper.GetKeyPtr(Index)));
+                        WriteValue(MapProperty->ValueProp, ValueKind, Helper.GetValuePtr(Index));
+                    }
+                }
+                Writer.EndObject();
+                break;
+            }
+
+            case EValueKind::SoftObject:
+            {
+                const FString Path = static_cast<const FSoftObjectProperty*>(Property)->GetPropertyValue(Value).ToString();
+                if (Path.IsEmpty()) { Writer.Null(); }
+                else { Writer.String(Path); }
+                break;
+            }
+
+            case EValueKind::Object:
+            {
+                const UObject* Object = static_cast<const FObjectPropertyBase*>(Property)->GetObjectPropertyValue(Value);
+                if (Object) { Writer.String(Object->GetPathName()); }
+                else { Writer.Null(); }
+                break;
+            }
+
+            default:
+                Writer.Null();
+                break;
+            }
+        }
+
+        static FString KeyToString(const FProperty* Property, EValueKind Kind, const void* Value)
+        {
+            switch (Kind)
+            {
+            case EValueKind::Bool:
+                return static_cast<const FBoolProperty*>(Property)->GetPropertyValue(Value) ? TEXT("true") : TEXT("false");
+            case EValueKind::Int:
+                return LexToString(static_cast<const FNumericProperty*>(Property)->GetSignedIntPropertyValue(Value));
+            case EValueKind::Float:
+            case EValueKind::Double:
+                return FString::SanitizeFloat(static_cast<const FNumericProperty*>(Property)->GetFloatingPointPropertyValue(Value));
+            case EValueKind::Enum:
+            {
+                const UEnum* Enum = nullptr;
+                const FNumericProperty* Numeric = nullptr;
+                GetEnumParts(Property, Enum, Numeric);
+                const int64 Raw = Numeric->GetSignedIntPropertyValue(Value);
+                const FString Name = Enum->GetNameStringByValue(Raw);
+                return Name.IsEmpty() ? LexToString(Raw) : Name;
+            }
+            case EValueKind::String:
+                return static_cast<const FStrProperty*>(Property)->GetPropertyValue(Value);
+            case EValueKind::Name:
+                return static_cast<const FNameProperty*>(Property)->GetPropertyValue(Value).ToString();
+            case EValueKind::Text:
+                return static_cast<const FTextProperty*>(Property)->GetPropertyValue(Value).ToString();
+            case EValueKind::TextStruct:
+                return ExportStructText(GetStruct(Property), Value);
+            default:
+                return FString();
+            }
+        }
+
+        FQuickJsonWriter& Writer;
+    };
+
+    class FStructReader
+    {
+    public:
+        FStructReader(const uint8* InBegin, int32 InLen)
+            : Begin(InBegin), End(InBegin + InLen), P(InBegin)
+        {
+        }
+
+        bool Run(const FStructLayout& Layout, void* Data, FString& OutError)
+        {
+            // Tolerate a UTF-8 byte order mark
+            if (End - P >= 3 && P[0] == 0xEF && P[1] == 0xBB && P[2] == 0xBF) { P += 3; }
+            P = SkipWhitespace(P);
+            if (P == End)
+            {
+                Fail(TEXT("Empty document"));
+            }
+            else if (ReadStruct(Layout, Data))
+            {
+                P = SkipWhitespace(P);
+                if (P != End) { Fail(TEXT("Unexpected data after the root value")); }
+            }
+            OutError = Error;
+            return Error.IsEmpty();
+        }
+
+    private:
+        // Nesting comes from the struct types, but a self-referencing one (an array of itself) could recurse deep
+        static constexpr int32 MaxDepth = 256;
+
+        bool ReadStruct(const FStructLayout& Layout, void* Data)
+        {
+            int32 Hint = 0;
+            return ReadMembers([this, &Layout, Data, &Hint](const uint8* KeyBegin, const uint8* KeyEnd, bool bEscaped)
+            {
+                const int32 FieldIndex = FindField(Layout, KeyBegin, KeyEnd, bEscaped, Hint);
+                if (FieldIndex == INDEX_NONE) { return SkipValue(); }
+                Hint = FieldIndex + 1;
+                return ReadField(Layout.Fields[FieldIndex], Data);
+            });
+        }
+
+        bool ReadField(const FFieldInfo& Field, void* Data)
+        {
+            const int32 Dim = GetArrayDim(Field.Property);
+            if (Dim == 1)
+            {
+                return ReadValue(Field.Property, Field.Kind, Field.Property->ContainerPtrToValuePtr<void>(Data));
+            }
+            if (*P == 'n') { return ReadLiteral("null", 4); }
+            // Elements beyond the static array's size are ignored
+            return ReadElements([this, &Field, Data, Dim](int32 Index)
+            {
+                return Index < Dim ? ReadValue(Field.Property, Field.Kind, Field.Property->ContainerPtrToValuePtr<void>(Data, Index)) : SkipValue();
+            });
+        }
+
+        /** P is at the start of a value; on return it is just past it. null leaves the value as it was. */
+        bool ReadValue(const FProperty* Property, EValueKind Kind, void* Value)
+        {
+            if (*P == 'n') { return ReadLiteral("null", 4); }
+
+            switch (Kind)
+            {
+            case EValueKind::Bool:
+            {
+                bool bValue = false;
+                if (!ReadBool(bValue)) { return false; }
+                static_cast<const FBoolProperty*>(Property)->SetPropertyValue(Value, bValue);
+                return true;
+            }
+
+            case EValueKind::Int:
+            {
+                int64 Number = 0;
+                if (!ReadInt(Number)) { return false; }
+                static_cast<const FNumericProperty*>(Property)->SetIntPropertyValue(Value, Number);
+                return true;
+            }
+
+            case EValueKind::Float:
+            case EValueKind::Double:
+            {
+                double Number = 0.0;
+                if (!ReadNumber(Number)) { return false; }
+                static_cast<const FNumericProperty*>(Property)->SetFloatingPointPropertyValue(Value, Number);
+                return true;
+            }
+
+            case EValueKind::Enum:
+            {
+                const UEnum* Enum = nullptr;
+                const FNumericProperty* Numeric = nullptr;
+                GetEnumParts(Property, Enum, Numeric);
+                int64 Number = 0;
+                if (*P == '"')
+                {
+                    const uint8* Start = P;
+                    FString Name;
+                    if (!ReadString(Name)) { return false; }
+                    Number = Enum->GetValueByNameString(Name);
+                    if (Number == INDEX_NONE)
+                    {
+                        P = Start;
+                        return Fail(*FString::Printf(TEXT("'%s' is not a value of %s"), *Name, *Enum->GetName()));
+                    }
+                }
+                else if (!ReadInt(Number))
+                {
+                    return false;
+                }
+                Numeric->SetIntPropertyValue(Value, Number);
+                return true;
+            }
+
+            case EValueKind::String:
+            {
+                FString Text;
+                if (!ReadText(Text)) { return false; }
+                static_cast<const FStrProperty*>(Property)->SetPropertyValue(Value, MoveTemp(Text));
+                return true;
+            }
+
+            case EValueKind::Name:
+            {
+                FString Text;
+                if (!ReadText(Text)) { return false; }
+                static_cast<const FNameProperty*>(Property)->SetPropertyValue(Value, FName(*Text));
+                return true;
+            }
+
+            case EValueKind::Text:
+            {
+                FString Text;
+                if (!ReadText(Text)) { return false; }
+                static_cast<const FTextProperty*>(Property)->SetPropertyValue(Value, FText::FromString(MoveTemp(Text)));
+                return true;
+            }
+
+            case EValueKind::Struct:
+                return ReadStruct(*GetLayout(GetStruct(Property)), Value);
+
+            case EValueKind::TextStruct:
+            {
+                if (*P == '{') { return ReadStruct(*GetLayout(GetStruct(Property)), Value); }
+                const uint8* Start = P;
+                FString Text;
+                if (!ReadString(Text)) { return false; }
+                if (!ImportStructText(GetStruct(Property), Value, Text))
+                {
+                    P = Start;
+                    return Fail(*FString::Printf(TEXT("Invalid %s value"), *GetStruct(Property)->GetName()));
+                }
+                return true;
+            }
+
+            case EValueKind::Array:
+            {
+                const FArrayProperty* ArrayProperty = static_cast<const FArrayProperty*>(Property);
+                const FProperty* Inner = ArrayProperty->Inner;
+                const EValueKind InnerKind = Classify(Inner);
+                const FStructLayoutPtr InnerLayout = InnerKind == EValueKind::Struct ? GetLayout(GetStruct(Inner)) : FStructLayoutPtr();
+                FScriptArrayHelper Helper(ArrayProperty, Value);
+                Helper.EmptyValues();
+                return ReadElements([this, &Helper, Inner, InnerKind, &InnerLayout](int32)
+                {
+                    void* Element = Helper.GetRawPtr(Helper.AddValue());
+                    return InnerLayout.IsValid() && *P == '{' ? ReadStruct(*InnerLayout, Element) : ReadValue(Inner, InnerKind, Element);
+                });
+            }
+
+            case EValueKind::Set:
+            {
+                const FSetProperty* SetProperty = static_cast<const FSetProperty*>(Property);
+                const EValueKind ElementKind = Classify(SetProperty->ElementProp);
+                FScriptSetHelper Helper(SetProperty, Value);
+                Helper.EmptyElements();
+                const bool bRead = ReadElements([this, &Helper, SetProperty, ElementKind](int32)
+                {
+                    const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+                    return ReadValue(SetProperty->ElementProp, ElementKind, Helper.GetElementPtr(Index));
+                });
+                Helper.Rehash();
+                return bRead;
+            }
+
+            case EValueKind::Map:
+            {
+                const FMapProperty* MapProperty = static_cast<const FMapProperty*>(Property);
+                const EValueKind KeyKind = Classify(MapProperty->KeyProp);
+                const EValueKind ValueKind = Classify(MapProperty->ValueProp);
+                FScriptMapHelper Helper(MapProperty, Value);
+                Helper.EmptyValues();
+                const bool bRead = ReadMembers([this, &Helper, MapProperty, KeyKind, ValueKind](const uint8* KeyBegin, const uint8* KeyEnd, bool bEscaped)
+                {
+                    const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+                    const FString Key = DecodeString(KeyBegin, KeyEnd, bEscaped);
+                    if (!KeyFromString(MapProperty->KeyProp, KeyKind, Helper.GetKeyPtr(Index), Key))
+                    {
+                        return Fail(*FString::Printf(TEXT("Invalid map key '%s'"), *Key));
+                    }
+                    return ReadValue(MapProperty->ValueProp, ValueKind, Helper.GetValuePtr(Index));
+                });
+                Helper.Rehash();
+                return bRead;
+            }
+
+            case EValueKind::SoftObject:
+            {
+                FString Path;
+                if (!ReadString(Path)) { return false; }
+                static_cast<const FSoftObjectProperty*>(Property)->SetPropertyValue(Value, FSoftObjectPtr(FSoftObjectPath(Path)));
+                return true;
+            }
+
+            default:
+                // Object references are not resolved: finding (or loading) objects is not safe off the game thread
+                return SkipValue();
+            }
+        }
+
+        static bool KeyFromString(const FProperty* Property, EValueKind Kind, void* Value, const FString& Key)
+        {
+            switch (Kind)
+            {
+            case EValueKind::Bool:
+                if (Key != TEXT("true") && Key != TEXT("false")) { return false; }
+                static_cast<const FBoolProperty*>(Property)->SetPropertyValue(Value, Key == TEXT("true"));
+                return true;
+            case EValueKind::Int:
+                if (!Key.IsNumeric()) { return false; }
+                static_cast<const FNumericProperty*>(Property)->SetIntPropertyValue(Value, FCString::Atoi64(*Key));
+                return true;
+            case EValueKind::Float:
+            case EValueKind::Double:
+                if (!Key.IsNumeric()) { return false; }
+                static_cast<const FNumericProperty*>(Property)->SetFloatingPointPropertyValue(Value, FCString::Atod(*Key));
+                return true;
+            case EValueKind::Enum:
+            {
+                const UEnum* Enum = nullptr;
+                const FNumericProperty* Numeric = nullptr;
+                GetEnumParts(Property, Enum, Numeric);
+                const int64 Number = Key.IsNumeric() ? FCString::Atoi64(*Key) : Enum->GetValueByNameString(Key);
+                if (Number == INDEX_NONE) { return false; }
+                Numeric->SetIntPropertyValue(Value, Number);
+                return true;
+            }
+            case EValueKind::String:
+                static_cast<const FStrProperty*>(Property)->SetPropertyValue(Value, Key);
+                return true;
+            case EValueKind::Name:
+                static_cast<const FNameProperty*>(Property)->SetPropertyValue(Value, FName(*Key));
+                return true;
+            case EValueKind::Text:
+                static_cast<const FTextProperty*>(Property)->SetPropertyValue(Value, FText::FromString(Key));
+                return true;
+            case EValueKind::TextStruct:
+                return ImportStructText(GetStruct(Property), Value, Key);
+            default:
+                return false;
+            }
+        }
+
+        int32 FindField(const FStructLayout& Layout, const uint8* KeyBegin, const uint8* KeyEnd, bool bEscaped, int32 Hint) const
+        {
+            const int32 Num = Layout.Fields.Num();
+            if (bEscaped)
+            {
+                const FString Key = DecodeString(KeyBegin, KeyEnd, true);
+                for (int32 Index = 0; Index < Num; ++Index)
+                {
+                    if (Layout.Fields[Index].Name.Equals(Key, ESearchCase::IgnoreCase)) { return Index; }
+                }
+                return INDEX_NONE;
+            }
+
+            // Keys usually arrive in declaration order, so start looking after the last match
+            const int32 KeyLen = (int32)(KeyEnd - KeyBegin);
+            for (int32 Step = 0; Step < Num; ++Step)
+            {
+                const int32 Index = (Hint + Step) % Num;
+                const TArray<uint8>& Name = Layout.Fields[Index].NameUtf8;
+                if (Name.Num() != KeyLen) { continue; }
+                int32 i = 0;
+                while (i < KeyLen && ToLowerAscii(Name[i]) == ToLowerAscii(KeyBegin[i])) { ++i; }
+                if (i == KeyLen) { return Index; }
+            }
+            return INDEX_NONE;
+        }
+
+        /** P is at '{'. ReadMember(KeyBegin, KeyEnd, bEscaped) is called with P at each value and must consume it. */
+        template <typename MemberFuncType>
+        bool ReadMembers(MemberFuncType&& ReadMember)
+        {
+            if (*P != '{') { return Fail(TEXT("Expected an object")); }
+            if (++Depth > MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+            P = SkipWhitespace(P + 1);
+            if (P < End && *P == '}') { ++P; --Depth; return true; }
+            while (true)
+            {
+                if (P == End || *P != '"') { return Fail(TEXT("Expected a string key")); }
+                const uint8* KeyBegin = P + 1;
+                bool bEscaped = false;
+                if (!SkipString(bEscaped)) { return false; }
+                const uint8* KeyEnd = P - 1;
+
+                P = SkipWhitespace(P);
+                if (P == End || *P != ':') { return Fail(TEXT("Expected ':'")); }
+                P = SkipWhitespace(P + 1);
+                if (P == End) { return Fail(TEXT("Unexpected end of input")); }
+                if (!ReadMember(KeyBegin, KeyEnd, bEscaped)) { return false; }
+
+                P = SkipWhitespace(P);
+                if (P < End && *P == ',') { P = SkipWhitespace(P + 1); continue; }
+                if (P < End && *P == '}') { ++P; --Depth; return true; }
+                return Fail(TEXT("Expected ',' or '}'"));
+            }
+        }
+
+        /** P is at '['. ReadElement(Index) is called with P at each element and must consume it. */
+        template <typename ElementFuncType>
+        bool ReadElements(ElementFuncType&& ReadElement)
+        {
+            if (*P != '[') { return Fail(TEXT("Expected an array")); }
+            if (++Depth > MaxDepth) { return Fail(TEXT("Nesting too deep")); }
+            P = SkipWhitespace(P + 1);
+            if (P < End && *P == ']') { ++P; --Depth; return true; }
+            for (int32 Index = 0; ; ++Index)
+            {
+                if (P == End) { return Fail(TEXT("Unexpected end of input")); }
+                if (!ReadElement(Index)) { return false; }
+
+                P = SkipWhitespace(P);
+                if (P < End && *P == ',') { P = SkipWhitespace(P + 1); continue; }
+                if (P < End && *P == ']') { ++P; --Depth; return true; }
+                return Fail(TEXT("Expected ',' or ']'"));
+            }
+        }
+
+        bool ReadString(FString& Out)
+        {
+            if (*P != '"') { return Fail(TEXT("Expected a string")); }
+            const uint8* Start = P + 1;
+            bool bEscaped = false;
+            if (!SkipString(bEscaped)) { return false; }
+            Out = DecodeString(Start, P - 1, bEscaped);
+            return true;
+        }
+
+        /** A string, or a number/boolean as its text (FJsonObjectConverter accepts both for string fields). */
+        bool ReadText(FString& Out)
+        {
+            if (*P == '"') { return ReadString(Out); }
+            if (*P == '{' || *P == '[') { return Fail(TEXT("Expected a string")); }
+            const uint8* Start = P;
+            if (!SkipScalar()) { return false; }
+            Out = SpanToString(Start, P);
+            return true;
+        }
+
+        bool ReadBool(bool& bOut)
+        {
+            if (*P == 't') { bOut = true; return ReadLiteral("true", 4); }
+            if (*P == 'f') { bOut = false; return ReadLiteral("false", 5); }
+            return Fail(TEXT("Expected a boolean"));
+        }
+
+        /** Span of a number, bare or quoted (quoted numbers are accepted like FJsonObjectConverter does). */
+        bool ReadNumberSpan(const uint8*& OutBegin, const uint8*& OutEnd)
+        {
+            const uint8* Start = P;
+            if (*P == '"')
+            {
+                bool bEscaped = false;
+                if (!SkipString(bEscaped)) { return false; }
+                OutBegin = Start + 1;
+                OutEnd = P - 1;
+            }
+            else
+            {
+                if (!SkipScalar()) { return false; }
+                OutBegin = Start;
+                OutEnd = P;
+            }
+
+            bool bValid = OutBegin < OutEnd;
+            for (const uint8* C = OutBegin; C < OutEnd && bValid; ++C)
+            {
+                bValid = (*C >= '0' && *C <= '9') || *C == '-' || *C == '+' || *C == '.' || *C == 'e' || *C == 'E';
+            }
+            if (!bValid)
+            {
+                P = Start;
+                return Fail(TEXT("Expected a number"));
+            }
+            return true;
+        }
+
+        bool ReadNumber(double& Out)
+        {
+            const uint8* NumBegin = nullptr;
+            const uint8* NumEnd = nullptr;
+            if (!ReadNumberSpan(NumBegin, NumEnd)) { return false; }
+            Out = ParseDouble(NumBegin, NumEnd);
+            return true;
+        }
+
+        bool ReadInt(int64& Out)
+        {
+            const uint8* NumBegin = nullptr;
+            const uint8* NumEnd = nullptr;
+            if (!ReadNumberSpan(NumBegin, NumEnd)) { return false; }
+
+            // Plain integers are parsed exactly; anything else (1e3, 2.5, out of range) goes through double and is truncated
+            const bool bNegative = *NumBegin == '-';
+            const uint8* C = bNegative ? NumBegin + 1 : NumBegin;
+            uint64 Magnitude = 0;
+            bool bExact = C < NumEnd && NumEnd - C <= 18;
+            for (; C < NumEnd && bExact; ++C)
+            {
+                bExact = *C >= '0' && *C <= '9';
+                Magnitude = Magnitude * 10 + (*C - '0');
+            }
+            if (bExact)
+            {
+                Out = bNegative ? -(int64)Magnitude : (int64)Magnitude;
+                return true;
+            }
+            Out = (int64)FMath::Clamp(ParseDouble(NumBegin, NumEnd), -9.2e18, 9.2e18);
+            return true;
+        }
+
+        static double ParseDouble(const uint8* NumBegin, const uint8* NumEnd)
+        {
+            ANSICHAR Text[64];
+            const int32 Len = (int32)(NumEnd - NumBegin);
+            if (Len >= (int32)UE_ARRAY_COUNT(Text))
+            {
+                return FCString::Atod(*SpanToString(NumBegin, NumEnd));
+            }
+            FMemory::Memcpy(Text, NumBegin, Len);
+            Text[Len] = 0;
+            return FCStringAnsi::Atod(Text);
+        }
+
+        bool ReadLiteral(const ANSICHAR* Literal, int32 Len)
+        {
+            const uint8* Start = P;
+            if (!SkipScalar()) { return false; }
+            if (P - Start != Len || FMemory::Memcmp(Start, Literal, Len) != 0)
+            {
+                P = Start;
+                return Fail(TEXT("Unexpected value"));
+            }
+            return true;
+        }
+
+        bool SkipValue()
+        {
+            if (*P == '"')
+            {
+                bool bEscaped = false;
+                return SkipString(bEscaped);
+            }
+            if (*P == '{' || *P == '[')
+            {
+                return SkipContainer();
+            }
+            return SkipScalar();
+        }
+
+        bool SkipScalar()
+        {
+            const uint8* Start = P;
+            while (P < End && !IsDelimiter(*P)) { ++P; }
+            if (!IsScalar(Start, P))
+            {
+                P = Start;
+                return Fail(TEXT("Unexpected character"));
+            }
+            return true;
+        }
+
+        bool SkipContainer()
+        {
+            const uint8* Start = P;
+            int32 Nesting = 0;
+            while (true)
+            {
+                P = QuickJsonSimd::FindContainerStop(P, End);
+                if (P == End)
+                {
+                    P = Start;
+                    return Fail(TEXT("Unterminated object or array"));
+                }
+                if (*P == '"')
+                {
+                    bool bEscaped = false;
+                    if (!SkipString(bEscaped)) { return false; }
+                    continue;
+                }
+                Nesting += (*P == '{' || *P == '[') ? 1 : -1;
+                ++P;
+                if (Nesting == 0) { return true; }
+            }
+        }
+
+        /** P is at the opening quote; on return it is just past the closing quote. */
+        bool SkipString(bool& bOutEscaped)
+        {
+            const uint8* Start = P++;
+            while (true)
+            {
+                P = QuickJsonSimd::FindStringStop(P, End);
+                if (P == End)
+                {
+                    P = Start;
+                    return Fail(TEXT("Unterminated string"));
+                }
+                if (*P == '"') { ++P; return true; }
+                if (*P == '\\')
+                {
+                    bOutEscaped = true;
+                    if (End - P < 2)
+                    {
+                        P = Start;
+                        return Fail(TEXT("Unterminated string"));
+                    }
+                    P += 2;
+                    continue;
+                }
+                // Raw control character: tolerated, as the path extractor does
+                ++P;
+            }
+        }
+
+        static int32 ParseHex4(const uint8* C)
+        {
+            int32 Value = 0;
+            for (int32 i = 0; i < 4; ++i)
+            {
+                const uint8 Digit = C[i];
+                Value <<= 4;
+                if (Digit >= '0' && Digit <= '9') { Value |= Digit - '0'; }
+                else if (Digit >= 'a' && Digit <= 'f') { Value |= Digit - 'a' + 10; }
+                else if (Digit >= 'A' && Digit <= 'F') { Value |= Digit - 'A' + 10; }
+                else { return -1; }
+            }
+            return Value;
+        }
+
+        static void AppendUtf8(TArray<uint8, TInlineAllocator<256>>& Out, uint32 Code)
+        {
+            if (Code < 0x80)
+            {
+                Out.Add((uint8)Code);
+            }
+            else if (Code < 0x800)
+            {
+                Out.Add((uint8)(0xC0 | (Code >> 6)));
+                Out.Add((uint8)(0x80 | (Code & 0x3F)));
+            }
+            else if (Code < 0x10000)
+            {
+                Out.Add((uint8)(0xE0 | (Code >> 12)));
+                Out.Add((uint8)(0x80 | ((Code >> 6) & 0x3F)));
+                Out.Add((uint8)(0x80 | (Code & 0x3F)));
+            }
+            else
+            {
+                Out.Add((uint8)(0xF0 | (Code >> 18)));
+                Out.Add((uint8)(0x80 | ((Code >> 12) & 0x3F)));
+                Out.Add((uint8)(0x80 | ((Code >> 6) & 0x3F)));
+                Out.Add((uint8)(0x80 | (Code & 0x3F)));
+            }
+        }
+
+        /** Contents of a string literal (without its quotes), escapes resolved. */
+        static FString DecodeString(const uint8* StrBegin, const uint8* StrEnd, bool bEscaped)
+        {
+            if (!bEscaped) { return SpanToString(StrBegin, StrEnd); }
+
+            // Unescape into UTF-8 first so the text is converted to TCHAR in one go
+            TArray<uint8, TInlineAllocator<256>> Utf8;
+            Utf8.Reserve((int32)(StrEnd - StrBegin));
+            const uint8* C = StrBegin;
+            while (C < StrEnd)
+            {
+                if (*C != '\\' || StrEnd - C < 2)
+                {
+                    Utf8.Add(*C++);
+                    continue;
+                }
+
+                const uint8 Escape = C[1];
+                C += 2;
+                switch (Escape)
+                {
+                case 'b': Utf8.Add('\b'); break;
+                case 'f': Utf8.Add('\f'); break;
+                case 'n': Utf8.Add('\n'); break;
+                case 'r': Utf8.Add('\r'); break;
+                case 't': Utf8.Add('\t'); break;
+                case 'u':
+                {
+                    int32 Code = StrEnd - C >= 4 ? ParseHex4(C) : -1;
+                    if (Code < 0) { AppendUtf8(Utf8, 0xFFFD); break; }
+                    C += 4;
+                    if (Code >= 0xD800 && Code <= 0xDBFF)
+                    {
+                        // Join a surrogate pair; a lone half becomes U+FFFD
+                        const int32 Low = StrEnd - C >= 6 && C[0] == '\\' && C[1] == 'u' ? ParseHex4(C + 2) : -1;
+                        if (Low >= 0xDC00 && Low <= 0xDFFF)
+                        {
+                            Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+                            C += 6;
+                        }
+                        else
+                        {
+                            Code = 0xFFFD;
+                        }
+                    }
+                    else if (Code >= 0xDC00 && Code <= 0xDFFF)
+                    {
+                        Code = 0xFFFD;
+                    }
+                    AppendUtf8(Utf8, (uint32)Code);
+                    break;
+                }
+                default: Utf8.Add(Escape); break;
+                }
+            }
+            return SpanToString(Utf8.GetData(), Utf8.GetData() + Utf8.Num());
+        }
+
+        static FORCEINLINE uint8 ToLowerAscii(uint8 C)
+        {
+            return (C >= 'A' && C <= 'Z') ? (uint8)(C + ('a' - 'A')) : C;
+        }
+
+        static FORCEINLINE bool IsWhitespace(uint8 C)
+        {
+            return C == ' ' || C == '\n' || C == '\r' || C == '\t';
+        }
+
+        static FORCEINLINE bool IsDelimiter(uint8 C)
+        {
+            return IsWhitespace(C) || C == ',' || C == '}' || C == ']' || C == ':';
+        }
+
+        static bool IsScalar(const uint8* S, const uint8* E)
+        {
+            if (S == E) { return false; }
+            switch (*S)
+            {
+            case 't': return E - S == 4 && FMemory::Memcmp(S, "true", 4) == 0;
+            case 'f': return E - S == 5 && FMemory::Memcmp(S, "false", 5) == 0;
+            case 'n': return E - S == 4 && FMemory::Memcmp(S, "null", 4) == 0;
+            default:
+                for (; S < E; ++S)
+                {
+                    const uint8 C = *S;
+                    if (!((C >= '0' && C <= '9') || C == '-' || C == '+' || C == '.' || C == 'e' || C == 'E')) { return false; }
+                }
+                return true;
+            }
+        }
+
+        FORCEINLINE const uint8* SkipWhitespace(const uint8* C) const
+        {
+            while (C < End && IsWhitespace(*C)) { ++C; }
+            return C;
+        }
+
+        bool Fail(const TCHAR* What)
+        {
+            if (Error.IsEmpty())
+            {
+                Error = FString::Printf(TEXT("%s at offset %d"), What, (int32)(P - Begin));
+            }
+            return false;
+        }
+
+        const uint8* Begin;
+        const uint8* End;
+        const uint8* P;
+        int32 Depth = 0;
+        FString Error;
+    };
+}
+
+void FQuickJsonStruct::Write(const UStruct* Type, const void* Data, FQuickJsonWriter& Writer)
+{
+    if (!Type || !Data)
+    {
+        Writer.Null();
+        return;
+    }
+    FStructWriter StructWriter(Writer);
+    StructWriter.WriteStruct(*GetLayout(Type), Data);
+}
+
+bool FQuickJsonStruct::ToBytes(const UStruct* Type, const void* Data, TArray<uint8>& OutBytes, FString& OutError)
+{
+    OutBytes.Reset();
+    if (!Type || !Data)
+    {
+        OutError = TEXT("No struct to encode");
+        return false;
+    }
+
+    FQuickJsonWriter Writer(256);
+    Write(Type, Data, Writer);
+    if (!Writer.IsComplete())
+    {
+        OutError = Writer.GetError();
+        return false;
+    }
+    OutBytes = Writer.MoveBytes();
+    return true;
+}
+
+bool FQuickJsonStruct::FromBytes(TArrayView<const uint8> Json, const UStruct* Type, void* Data, FString& OutError)
+{
+    if (!Type || !Data)
+    {
+        OutError = TEXT("No struct to decode into");
+        return false;
+    }
+    FStructReader Reader(Json.GetData(), Json.Num());
+    return Reader.Run(*GetLayout(Type), Data, OutError);
+}
+
+void FQuickJsonStruct::ClearCache()
+{
+    FLayoutCache& Cache = GetLayoutCache();
+    FWriteScopeLock WriteLock(Cache.Lock);
+    Cache.Layouts.Reset();
+}
@@ -0,0 +1,33 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonStructValue.h"
+#include "UObject/UnrealType.h"
+
+UQuickJsonStructValue* UQuickJsonStructValue::Wrap(UScriptStruct* InType, const TSharedPtr<FStructOnScope, ESPMode::ThreadSafe>& InValue)
+{
+    UQuickJsonStructValue* Result = NewObject<UQuickJsonStructValue>();
+    Result->Type = InType;
+    Result->Value = InValue;
+    return Result;
+}
+
+bool UQuickJsonStructValue::CopyTo(const UScriptStruct* DestType, void* Dest) const
+{
+    if (!Value.IsValid() || !Type || !DestType || !Dest) { return false; }
+    if (!Type->IsChildOf(DestType)) { return false; }
+    DestType->CopyScriptStruct(Dest, Value->GetStructMemory());
+    return true;
+}
+
+DEFINE_FUNCTION(UQuickJsonStructValue::execGetStruct)
+{
+    Stack.MostRecentProperty = nullptr;
+    Stack.StepCompiledIn<FStructProperty>(nullptr);
+    const FStructProperty* StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+    void* StructPtr = Stack.MostRecentPropertyAddress;
+    P_FINISH;
+
+    P_NATIVE_BEGIN;
+    *(bool*)RESULT_PARAM = StructProperty && P_THIS->CopyTo(StructProperty->Struct, StructPtr);
+    P_NATIVE_END;
+}
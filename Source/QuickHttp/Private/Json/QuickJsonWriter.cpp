@@ -0,0 +1,281 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Json/QuickJsonWriter.h"
+#include "QuickHttpRequestKey.h"
+
+FQuickJsonWriter::FQuickJsonWriter(int32 InitialCapacityBytes)
+{
+    Buffer.Reserve(FMath::Max(0, InitialCapacityBytes));
+}
+
+void FQuickJsonWriter::Reset()
+{
+    Buffer.Reset();
+    Scopes.Reset();
+    Error.Reset();
+    bNeedComma = false;
+    bHasKey = false;
+    bHasRoot = false;
+}
+
+TArray<uint8> FQuickJsonWriter::MoveBytes()
+{
+    TArray<uint8> Out = MoveTemp(Buffer);
+    Reset();
+    return Out;
+}
+
+FString FQuickJsonWriter::ToString() const
+{
+    return QuickHttp::Utf8BytesToString(Buffer);
+}
+
+void FQuickJsonWriter::Fail(const TCHAR* Message)
+{
+    if (Error.IsEmpty()) { Error = Message; }
+}
+
+bool FQuickJsonWriter::BeginValue()
+{
+    if (!Error.IsEmpty()) { return false; }
+
+    if (Scopes.Num() == 0)
+    {
+        if (bHasRoot) { Fail(TEXT("Only one root value may be written")); return false; }
+        bHasRoot = true;
+        return true;
+    }
+
+    if (Scopes.Last() == EScope::Object)
+    {
+        if (!bHasKey) { Fail(TEXT("Value inside an object needs a Key first")); return false; }
+        bHasKey = false;
+        return true;
+    }
+
+    if (bNeedComma) { Buffer.Add(','); }
+    bNeedComma = true;
+    return true;
+}
+
+void FQuickJsonWriter::BeginObject()
+{
+    if (!BeginValue()) { return; }
+    Buffer.Add('{');
+    Scopes.Add(EScope::Object);
+    bNeedComma = false;
+}
+
+void FQuickJsonWriter::EndObject()
+{
+    if (!Error.IsEmpty()) { return; }
+    if (Scopes.Num() == 0 || Scopes.Last() != EScope::Object) { Fail(TEXT("EndObject without a matching BeginObject")); return; }
+    if (bHasKey) { Fail(TEXT("Key without a value before EndObject")); return; }
+    Buffer.Add('}');
+    Scopes.Pop();
+    bNeedComma = true;
+}
+
+void FQuickJsonWriter::BeginArray()
+{
+    if (!BeginValue()) { return; }
+    Buffer.Add('[');
+    Scopes.Add(EScope::Array);
+    bNeedComma = false;
+}
+
+void FQuickJsonWriter::EndArray()
+{
+    if (!Error.IsEmpty()) { return; }
+    if (Scopes.Num() == 0 || Scopes.Last() != EScope::Array) { Fail(TEXT("EndArray without a matching BeginArray")); return; }
+    Buffer.Add(']');
+    Scopes.Pop();
+    bNeedComma = true;
+}
+
+void FQuickJsonWriter::Key(const FString& Name)
+{
+    if (!Error.IsEmpty()) { return; }
+    if (Scopes.Num() == 0 || Scopes.Last() != EScope::Object) { Fail(TEXT("Key is only valid inside an object")); return; }
+    if (bHasKey) { Fail(TEXT("Two keys in a row")); return; }
+    if (bNeedComma) { Buffer.Add(','); }
+    AppendEscaped(Name);
+    Buffer.Add(':');
+    bHasKey = true;
+    bNeedComma = true;
+}
+
+void FQuickJsonWriter::EncodedKey(const TArray<uint8>& EncodedName)
+{
+    if (!Error.IsEmpty()) { return; }
+    if (Scopes.Num() == 0 || Scopes.Last() != EScope::Object) { Fail(TEXT("Key is only valid inside an object")); return; }
+    if (bHasKey) { Fail(TEXT("Two keys in a row")); return; }
+    if (bNeedComma) { Buffer.Add(','); }
+    Buffer.Append(EncodedName);
+    Buffer.Add(':');
+    bHasKey = true;
+    bNeedComma = true;
+}
+
+TArray<uint8> FQuickJsonWriter::EncodeKey(const FString& Name)
+{
+    FQuickJsonWriter Writer(Name.Len() + 2);
+    Writer.AppendEscaped(Name);
+    return Writer.MoveBytes();
+}
+
+void FQuickJsonWriter::String(const FString& Value)
+{
+    if (!BeginValue()) { return; }
+    AppendEscaped(Value);
+}
+
+void FQuickJsonWriter::Int(int64 Value)
+{
+    if (!BeginValue()) { return; }
+
+    ANSICHAR Digits[24];
+    int32 Pos = UE_ARRAY_COUNT(Digits);
+    uint64 Magnitude = Value < 0 ? (uint64)0 - (uint64)Value : (uint64)Value;
+    do
+    {
+        Digits[--Pos] = (ANSICHAR)('0' + (Magnitude % 10));
+        Magnitude /= 10;
+    }
+    while (Magnitude != 0);
+    if (Value < 0) { Digits[--Pos] = '-'; }
+    AppendAscii(Digits + Pos, UE_ARRAY_COUNT(Digits) - Pos);
+}
+
+void FQuickJsonWriter::Number(double Value)
+{
+    if (!BeginValue()) { return; }
+
+    // JSON has no NaN/Infinity
+    if (!FMath::IsFinite(Value))
+    {
+        AppendAscii("null", 4);
+        return;
+    }
+
+    // Shortest of %.15g / %.17g that round-trips
+    ANSICHAR Text[40];
+    int32 Len = FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%.15g", Value);
+    if (FCStringAnsi::Atod(Text) != Value)
+    {
+        Len = FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%.17g", Value);
+    }
+    AppendAscii(Text, FMath::Clamp(Len, 0, (int32)UE_ARRAY_COUNT(Text) - 1));
+}
+
+void FQuickJsonWriter::Float(float Value)
+{
+    if (!BeginValue()) { return; }
+
+    if (!FMath::IsFinite(Value))
+    {
+        AppendAscii("null", 4);
+        return;
+    }
+
+    // Widening to double first would print float noise (0.1f -> 0.100000001490116)
+    ANSICHAR Text[32];
+    int32 Len = 0;
+    for (int32 Digits = 6; Digits <= 9; ++Digits)
+    {
+        Len = FCStringAnsi::Snprintf(Text, UE_ARRAY_COUNT(Text), "%.*g", Digits, (double)Value);
+        if ((float)FCStringAnsi::Atod(Text) == Value) { break; }
+    }
+    AppendAscii(Text, FMath::Clamp(Len, 0, (int32)UE_ARRAY_COUNT(Text) - 1));
+}
+
+void FQuickJsonWriter::Bool(bool bValue)
+{
+    if (!BeginValue()) { return; }
+    if (bValue) { AppendAscii("true", 4); }
+    else { AppendAscii("false", 5); }
+}
+
+void FQuickJsonWriter::Null()
+{
+    if (!BeginValue()) { return; }
+    AppendAscii("null", 4);
+}
+
+void FQuickJsonWriter::AppendAscii(const ANSICHAR* Text, int32 Len)
+{
+    Buffer.Append((const uint8*)Text, Len);
+}
+
+void FQuickJsonWriter::AppendEscaped(const FString& Value)
+{
+    static const ANSICHAR Hex[] = "0123456789abcdef";
+
+    const int32 Len = Value.Len();
+    const TCHAR* Chars = *Value;
+    Buffer.Reserve(Buffer.Num() + Len + 2);
+    Buffer.Add('"');
+
+    for (int32 i = 0; i < Len; ++i)
+    {
+        uint32 Code = (uint32)Chars[i];
+
+        if (Code < 0x80)
+        {
+            switch (Code)
+            {
+            case '"':  AppendAscii("\\\"", 2); break;
+            case '\\': AppendAscii("\\\\", 2); break;
+            case '\n': AppendAscii("\\n", 2); break;
+            case '\r': AppendAscii("\\r", 2); break;
+            case '\t': AppendAscii("\\t", 2); break;
+            case '\b': AppendAscii("\\b", 2); break;
+            case '\f': AppendAscii("\\f", 2); break;
+            default:
+                if (Code < 0x20)
+                {
+                    const ANSICHAR Escape[6] = { '\\', 'u', '0', '0', Hex[Code >> 4], Hex[Code & 0xF] };
+                    AppendAscii(Escape, 6);
+                }
+                else
+                {
+                    Buffer.Add((uint8)Code);
+                }
+                break;
+            }
+            continue;
+        }
+
+        // Combine UTF-16 surrogate pairs (TCHAR is UTF-16 on Windows); lone surrogates become U+FFFD
+        if (Code >= 0xD800 && Code <= 0xDBFF && i + 1 < Len && (uint32)Chars[i + 1] >= 0xDC00 && (uint32)Chars[i + 1] <= 0xDFFF)
+        {
+            Code = 0x10000 + ((Code - 0xD800) << 10) + ((uint32)Chars[i + 1] - 0xDC00);
+            ++i;
+        }
+        else if ((Code >= 0xD800 && Code <= 0xDFFF) || Code > 0x10FFFF)
+        {
+            Code = 0xFFFD;
+        }
+
+        if (Code < 0x800)
+        {
+            Buffer.Add((uint8)(0xC0 | (Code >> 6)));
+            Buffer.Add((uint8)(0x80 | (Code & 0x3F)));
+        }
+        else if (Code < 0x10000)
+        {
+            Buffer.Add((uint8)(0xE0 | (Code >> 12)));
+            Buffer.Add((uint8)(0x80 | ((Code >> 6) & 0x3F)));
+            Buffer.Add((uint8)(0x80 | (Code & 0x3F)));
+        }
+        else
+        {
+            Buffer.Add((uint8)(0xF0 | (Code >> 18)));
+            Buffer.Add((uint8)(0x80 | ((Code >> 12) & 0x3F)));
+            Buffer.Add((uint8)(0x80 | ((Code >> 6) & 0x3F)));
+            Buffer.Add((uint8)(0x80 | (Code & 0x3F)));
+        }
+    }
+
+    Buffer.Add('"');
+}
@@ -0,0 +1,207 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Metrics/QuickHttpMetrics.h"
+
+#if QUICKHTTP_WITH_METRICS
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DECLARE_STATS_GROUP(TEXT("QuickHttp"), STATGROUP_QuickHttp, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Requests In Flight"), STAT_QuickHttp_InFlight, STATGROUP_QuickHttp);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Requests Queued"), STAT_QuickHttp_Queued, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Requests Completed"), STAT_QuickHttp_Completed, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Requests Failed"), STAT_QuickHttp_Failed, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Retries"), STAT_QuickHttp_Retries, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hedges"), STAT_QuickHttp_Hedges, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Hedge Wins"), STAT_QuickHttp_HedgeWins, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Circuit Opens"), STAT_QuickHttp_CircuitOpens, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Circuit Closes"), STAT_QuickHttp_CircuitCloses, STATGROUP_QuickHttp);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Telemetry Events Queued"), STAT_QuickHttp_TelemetryQueued, STATGROUP_QuickHttp);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Telemetry Events Spilled"), STAT_QuickHttp_TelemetrySpilled, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Telemetry Events Sent"), STAT_QuickHttp_TelemetrySent, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Telemetry Batches Sent"), STAT_QuickHttp_TelemetryBatches, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Telemetry Batches Failed"), STAT_QuickHttp_TelemetryBatchesFailed, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bytes Received"), STAT_QuickHttp_BytesReceived, STATGROUP_QuickHttp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bytes Sent"), STAT_QuickHttp_BytesSent, STATGROUP_QuickHttp);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Latency P50 (ms)"), STAT_QuickHttp_LatencyP50, STATGROUP_QuickHttp);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Latency P99 (ms)"), STAT_QuickHttp_LatencyP99, STATGROUP_QuickHttp);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("First Byte P50 (ms)"), STAT_QuickHttp_FirstByteP50, STATGROUP_QuickHttp);
+
+CSV_DEFINE_CATEGORY(QuickHttp, true);
+
+void FQuickHttpLatencyHistogram::Reset()
+{
+    FMemory::Memzero(Counts);
+    Count = 0;
+    MaxSeconds = 0.0;
+}
+
+int32 FQuickHttpLatencyHistogram::BucketFor(uint64 Micros)
+{
+    // Linear below SubBuckets, then SubBuckets equal slices of each power of two
+    if (Micros < (uint64)SubBuckets) { return (int32)Micros; }
+    const int32 Msb = (int32)FMath::FloorLog2_64(Micros);
+    const int32 Octave = Msb - SubBucketBits + 1;
+    if (Octave >= NumOctaves) { return NumBuckets - 1; }
+    const int32 Sub = (int32)(Micros >> (Msb - SubBucketBits)) & (SubBuckets - 1);
+    return Octave * SubBuckets + Sub;
+}
+
+double FQuickHttpLatencyHistogram::BucketMidSeconds(int32 Index)
+{
+    if (Index < SubBuckets) { return (Index + 0.5) * 1e-6; }
+    const int32 Octave = Index / SubBuckets;
+    const int32 Sub = Index % SubBuckets;
+    const uint64 Width = uint64(1) << (Octave - 1);
+    const uint64 Lower = uint64(SubBuckets + Sub) << (Octave - 1);
+    return ((double)Lower + (double)Width * 0.5) * 1e-6;
+}
+
+void FQuickHttpLatencyHistogram::Record(double Seconds)
+{
+    Seconds = FMath::Max(0.0, Seconds);
+    Counts[BucketFor((uint64)(Seconds * 1e6))]++;
+    Count++;
+    MaxSeconds = FMath::Max(MaxSeconds, Seconds);
+}
+
+double FQuickHttpLatencyHistogram::GetPercentile(double P) const
+{
+    if (Count == 0) { return 0.0; }
+    const uint64 Target = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(FMath::Clamp(P, 0.0, 100.0) / 100.0 * (double)Count));
+    uint64 Seen = 0;
+    for (int32 i = 0; i < NumBuckets; ++i)
+    {
+        Seen += Counts[i];
+        if (Seen >= Target)
+        {
+            return FMath::Min(BucketMidSeconds(i), MaxSeconds);
+        }
+    }
+    return MaxSeconds;
+}
+
+void FQuickHttpMetrics::Record(const FString& Host, const FQuickHttpRequestStats& Stats, bool bSucceeded)
+{
+    const int32 Retries = FMath::Max(0, Stats.Attempts - 1);
+    FHostEntry& HostEntry = Hosts.Num() < MaxHosts || Hosts.Contains(Host) ? Hosts.FindOrAdd(Host) : Hosts.FindOrAdd(TEXT("*"));
+
+    for (FHostEntry* Entry : { &HostEntry, &All })
+    {
+        Entry->Requests++;
+        Entry->Failures += bSucceeded ? 0 : 1;
+        Entry->Retries += Retries;
+        Entry->BytesReceived += Stats.ResponseBytesReceived;
+        Entry->BytesSent += Stats.RequestBytesSent;
+        Entry->Hedges += Stats.Hedges;
+        Entry->HedgeWins += Stats.bHedgeWon ? 1 : 0;
+        Entry->Total.Record(Stats.TotalSeconds);
+        if (Stats.TimeToFirstByteSeconds > 0.f)
+        {
+            Entry->FirstByte.Record(Stats.TimeToFirstByteSeconds);
+        }
+        if (Stats.Attempts > 0)
+        {
+            Entry->QueueWait.Record(Stats.QueueWaitSeconds);
+        }
+    }
+
+    INC_DWORD_STAT(STAT_QuickHttp_Completed);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_Failed, bSucceeded ? 0 : 1);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_Retries, Retries);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_Hedges, Stats.Hedges);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_HedgeWins, Stats.bHedgeWon ? 1 : 0);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_BytesReceived, (uint32)Stats.ResponseBytesReceived);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_BytesSent, (uint32)Stats.RequestBytesSent);
+
+    CSV_CUSTOM_STAT(QuickHttp, Completed, 1, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, Failed, bSucceeded ? 0 : 1, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, Retries, Retries, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, Hedges, Stats.Hedges, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, HedgeWins, Stats.bHedgeWon ? 1 : 0, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, BytesReceived, (int32)Stats.ResponseBytesReceived, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, MaxLatencyMs, Stats.TotalSeconds * 1000.f, ECsvCustomStatOp::Max);
+}
+
+void FQuickHttpMetrics::RecordCircuitTransition(EQuickHttpCircuitState To)
+{
+    const bool bOpened = To == EQuickHttpCircuitState::Open;
+    const bool bClosed = To == EQuickHttpCircuitState::Closed;
+    INC_DWORD_STAT_BY(STAT_QuickHttp_CircuitOpens, bOpened ? 1 : 0);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_CircuitCloses, bClosed ? 1 : 0);
+    CSV_CUSTOM_STAT(QuickHttp, CircuitOpens, bOpened ? 1 : 0, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, CircuitCloses, bClosed ? 1 : 0, ECsvCustomStatOp::Accumulate);
+}
+
+void FQuickHttpMetrics::RecordTelemetryBatch(int32 NumEvents, bool bSucceeded)
+{
+    INC_DWORD_STAT_BY(STAT_QuickHttp_TelemetrySent, bSucceeded ? NumEvents : 0);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_TelemetryBatches, bSucceeded ? 1 : 0);
+    INC_DWORD_STAT_BY(STAT_QuickHttp_TelemetryBatchesFailed, bSucceeded ? 0 : 1);
+    CSV_CUSTOM_STAT(QuickHttp, TelemetryEventsSent, bSucceeded ? NumEvents : 0, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(QuickHttp, TelemetryBatchesFailed, bSucceeded ? 0 : 1, ECsvCustomStatOp::Accumulate);
+}
+
+void FQuickHttpMetrics::TickTelemetry(int32 QueuedEvents, int32 SpilledEvents)
+{
+    SET_DWORD_STAT(STAT_QuickHttp_TelemetryQueued, QueuedEvents);
+    SET_DWORD_STAT(STAT_QuickHttp_TelemetrySpilled, SpilledEvents);
+    CSV_CUSTOM_STAT(QuickHttp, TelemetryQueued, QueuedEvents, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(QuickHttp, TelemetrySpilled, SpilledEvents, ECsvCustomStatOp::Set);
+}
+
+void FQuickHttpMetrics::Tick(int32 InFlight, int32 Queued)
+{
+    SET_DWORD_STAT(STAT_QuickHttp_InFlight, InFlight);
+    SET_DWORD_STAT(STAT_QuickHttp_Queued, Queued);
+#if STATS
+    SET_FLOAT_STAT(STAT_QuickHttp_LatencyP50, (float)(All.Total.GetPercentile(50.0) * 1000.0));
+    SET_FLOAT_STAT(STAT_QuickHttp_LatencyP99, (float)(All.Total.GetPercentile(99.0) * 1000.0));
+    SET_FLOAT_STAT(STAT_QuickHttp_FirstByteP50, (float)(All.FirstByte.GetPercentile(50.0) * 1000.0));
+#endif
+
+    CSV_CUSTOM_STAT(QuickHttp, InFlight, InFlight, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(QuickHttp, Queued, Queued, ECsvCustomStatOp::Set);
+}
+
+void FQuickHttpMetrics::Fill(const FString& Host, const FHostEntry& Entry, FQuickHttpHostMetrics& Out)
+{
+    Out.Host = Host;
+    Out.Requests = Entry.Requests;
+    Out.Failures = Entry.Failures;
+    Out.Retries = Entry.Retries;
+    Out.BytesReceived = Entry.BytesReceived;
+    Out.BytesSent = Entry.BytesSent;
+    Out.Hedges = Entry.Hedges;
+    Out.HedgeWins = Entry.HedgeWins;
+    Out.LatencyP50Ms = (float)(Entry.Total.GetPercentile(50.0) * 1000.0);
+    Out.LatencyP90Ms = (float)(Entry.Total.GetPercentile(90.0) * 1000.0);
+    Out.LatencyP99Ms = (float)(Entry.Total.GetPercentile(99.0) * 1000.0);
+    Out.LatencyMaxMs = (float)(Entry.Total.GetMax() * 1000.0);
+    Out.FirstByteP50Ms = (float)(Entry.FirstByte.GetPercentile(50.0) * 1000.0);
+    Out.FirstByteP99Ms = (float)(Entry.FirstByte.GetPercentile(99.0) * 1000.0);
+    Out.QueueWaitP99Ms = (float)(Entry.QueueWait.GetPercentile(99.0) * 1000.0);
+}
+
+FQuickHttpHostMetrics FQuickHttpMetrics::GetSnapshot(TArray<FQuickHttpHostMetrics>& OutPerHost) const
+{
+    OutPerHost.Reset(Hosts.Num());
+    for (const TPair<FString, FHostEntry>& Pair : Hosts)
+    {
+        Fill(Pair.Key, Pair.Value, OutPerHost.AddDefaulted_GetRef());
+    }
+    OutPerHost.Sort([](const FQuickHttpHostMetrics& A, const FQuickHttpHostMetrics& B) { return A.Requests > B.Requests; });
+
+    FQuickHttpHostMetrics Total;
+    Fill(FString(), All, Total);
+    return Total;
+}
+
+void FQuickHttpMetrics::Reset()
+{
+    Hosts.Reset();
+    All = FHostEntry();
+}
+
+#endif // QUICKHTTP_WITH_METRICS
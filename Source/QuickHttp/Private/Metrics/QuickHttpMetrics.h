@@ -0,0 +1,103 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+/**
+ * Aggregate request metrics (per-host histograms, STAT counters, CSV stats).
+ * Define QUICKHTTP_WITH_METRICS=0 (e.g. in your Target.cs GlobalDefinitions) to compile them out;
+ * per-request FQuickHttpRequestStats are filled either way.
+ */
+#ifndef QUICKHTTP_WITH_METRICS
+#define QUICKHTTP_WITH_METRICS 1
+#endif
+
+#if QUICKHTTP_WITH_METRICS
+
+/**
+ * Fixed-size log-linear latency histogram in the spirit of HdrHistogram.
+ * Values are bucketed in microseconds with 8 sub-buckets per power of two, so every
+ * percentile is accurate to about 12% from 1 us up to several hours, in about 1 KB and O(1) per sample.
+ */
+class FQuickHttpLatencyHistogram
+{
+public:
+    FQuickHttpLatencyHistogram() { Reset(); }
+
+    void Record(double Seconds);
+
+    /** Value at percentile P (0-100), in seconds. */
+    double GetPercentile(double P) const;
+
+    double GetMax() const { return MaxSeconds; }
+    uint64 Num() const { return Count; }
+
+    void Reset();
+
+private:
+    static constexpr int32 SubBucketBits = 3;
+    static constexpr int32 SubBuckets = 1 << SubBucketBits;
+    static constexpr int32 NumOctaves = 33;
+    static constexpr int32 NumBuckets = NumOctaves * SubBuckets;
+
+    static int32 BucketFor(uint64 Micros);
+    static double BucketMidSeconds(int32 Index);
+
+    uint32 Counts[NumBuckets];
+    uint64 Count = 0;
+    double MaxSeconds = 0.0;
+};
+
+/**
+ * Per-host aggregates of finished requests, also published to the QuickHttp STAT group
+ * ("stat QuickHttp") and the QuickHttp CSV profiler category. Game thread only.
+ */
+class FQuickHttpMetrics
+{
+public:
+    /** Fold one finished request into its host's aggregates. */
+    void Record(const FString& Host, const FQuickHttpRequestStats& Stats, bool bSucceeded);
+
+    /** Count a circuit breaker state change. */
+    void RecordCircuitTransition(EQuickHttpCircuitState To);
+
+    /** Count one telemetry batch that was accepted or failed after its retries. */
+    void RecordTelemetryBatch(int32 NumEvents, bool bSucceeded);
+
+    /** Publish the telemetry queue depth, in memory and in spill logs. */
+    void TickTelemetry(int32 QueuedEvents, int32 SpilledEvents);
+
+    /** Publish the per-frame gauges. */
+    void Tick(int32 InFlight, int32 Queued);
+
+    /** Totals across all hosts; OutPerHost receives one entry per host, busiest first. */
+    FQuickHttpHostMetrics GetSnapshot(TArray<FQuickHttpHostMetrics>& OutPerHost) const;
+
+    void Reset();
+
+private:
+    struct FHostEntry
+    {
+        FQuickHttpLatencyHistogram Total;
+        FQuickHttpLatencyHistogram FirstByte;
+        FQuickHttpLatencyHistogram QueueWait;
+        int64 Requests = 0;
+        int64 Failures = 0;
+        int64 Retries = 0;
+        int64 BytesReceived = 0;
+        int64 BytesSent = 0;
+        int64 Hedges = 0;
+        int64 HedgeWins = 0;
+    };
+
+    static void Fill(const FString& Host, const FHostEntry& Entry, FQuickHttpHostMetrics& Out);
+
+    // Hosts beyond this share one "*" entry so the map cannot grow without bound
+    static constexpr int32 MaxHosts = 64;
+
+    TMap<FString, FHostEntry> Hosts;
+    FHostEntry All;
+};
+
+#endif // QUICKHTTP_WITH_METRICS
@@ -0,0 +1,343 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Network/QuickHttpPrewarmer.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpRequestKey.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "SocketSubsystem.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+
+namespace QuickHttpPrewarm
+{
+    /** Results of one Prewarm call, collected as its origins finish. */
+    struct FBatch
+    {
+        TArray<FQuickHttpPrewarmResult> Results;
+        FQuickHttpPrewarmer::FOnPrewarmed OnDone;
+        int32 Remaining = 0;
+    };
+
+    static void CompleteOne(const TSharedRef<FBatch>& Batch)
+    {
+        if (--Batch->Remaining == 0 && Batch->OnDone)
+        {
+            Batch->OnDone(Batch->Results);
+        }
+    }
+}
+
+void FQuickHttpPrewarmer::Configure(double InDnsTtlSeconds, int32 InTimeoutSeconds)
+{
+    DnsTtlSeconds = FMath::Max(1.0, InDnsTtlSeconds);
+    TimeoutSeconds = FMath::Max(1, InTimeoutSeconds);
+}
+
+void FQuickHttpPrewarmer::Prewarm(const TArray<FString>& Urls, bool bForce, FOnPrewarmed OnDone)
+{
+    using namespace QuickHttpPrewarm;
+
+    TSharedRef<FBatch> Batch = MakeShared<FBatch>();
+    Batch->Results.SetNum(Urls.Num());
+    Batch->OnDone = MoveTemp(OnDone);
+    // One extra count held until every origin started, so origins that finish synchronously cannot complete the batch early
+    Batch->Remaining = Urls.Num() + 1;
+
+    for (int32 Index = 0; Index < Urls.Num(); ++Index)
+    {
+        const FString Origin = GetOrigin(Urls[Index]);
+        if (Origin.IsEmpty())
+        {
+            FQuickHttpPrewarmResult& Result = Batch->Results[Index];
+            Result.Origin = Urls[Index];
+            Result.Error = TEXT("Not a URL or host name");
+            CompleteOne(Batch);
+            continue;
+        }
+        WarmOrigin(Origin, bForce, [Batch, Index](const FQuickHttpPrewarmResult& Result)
+        {
+            Batch->Results[Index] = Result;
+            CompleteOne(Batch);
+        });
+    }
+    CompleteOne(Batch);
+}
+
+bool FQuickHttpPrewarmer::GetCachedAddresses(const FString& HostName, TArray<FString>& OutAddresses) const
+{
+    FScopeLock Lock(&DnsLock);
+    const FDnsEntry* Entry = DnsCache.Find(HostName);
+    if (!Entry || Entry->ExpiresAtSeconds <= FPlatformTime::Seconds()) { return false; }
+    OutAddresses = Entry->Addresses;
+    return true;
+}
+
+FString FQuickHttpPrewarmer::GetOrigin(const FString& Url)
+{
+    const FString Trimmed = Url.TrimStartAndEnd();
+    const FString Host = QuickHttp::GetUrlHost(Trimmed);
+    if (Host.IsEmpty()) { return FString(); }
+
+    const int32 SchemeEnd = Trimmed.Find(TEXT("://"));
+    const FString Scheme = SchemeEnd == INDEX_NONE ? FString(TEXT("https")) : Trimmed.Left(SchemeEnd).ToLower();
+    return Scheme + TEXT("://") + Host;
+}
+
+FString FQuickHttpPrewarmer::GetHostName(const FString& Origin)
+{
+    const int32 SchemeEnd = Origin.Find(TEXT("://"));
+    const FString Authority = SchemeEnd == INDEX_NONE ? Origin : Origin.RightChop(SchemeEnd + 3);
+
+    // "[::1]:8080" -> "::1", "example.com:8080" -> "example.com"
+    if (Authority.StartsWith(TEXT("[")))
+    {
+        int32 Close = INDEX_NONE;
+        return Authority.FindChar(TEXT(']'), Close) ? Authority.Mid(1, Close - 1) : Authority.RightChop(1);
+    }
+    int32 Colon = INDEX_NONE;
+    return Authority.FindChar(TEXT(':'), Colon) ? Authority.Left(Colon) : Authority;
+}
+
+void FQuickHttpPrewarmer::Reset()
+{
+    ++Generation;
+    for (TPair<FString, FWarming>& Pair : Warming)
+    {
+        if (Pair.Value.Request.IsValid())
+        {
+            Pair.Value.Request->OnProcessRequestComplete().Unbind();
+            Pair.Value.Request->CancelRequest();
+        }
+    }
+    Warming.Reset();
+    WarmUntilSeconds.Reset();
+
+    FScopeLock Lock(&DnsLock);
+    DnsCache.Reset();
+}
+
+void FQuickHttpPrewarmer::WarmOrigin(const FString& Origin, bool bForce, FOnOriginDone OnDone)
+{
+    if (FWarming* Existing = Warming.Find(Origin))
+    {
+        if (OnDone) { Existing->Waiters.Add(MoveTemp(OnDone)); }
+        return;
+    }
+
+    const FString HostName = GetHostName(Origin);
+    const double* WarmUntil = WarmUntilSeconds.Find(Origin);
+    if (!bForce && WarmUntil && *WarmUntil > FPlatformTime::Seconds())
+    {
+        FQuickHttpPrewarmResult Result;
+        Result.Origin = Origin;
+        Result.bSucceeded = true;
+        Result.bAlreadyWarm = true;
+        GetCachedAddresses(HostName, Result.Addresses);
+        if (OnDone) { OnDone(Result); }
+        return;
+    }
+
+    FWarming& Entry = Warming.Add(Origin);
+    Entry.Result.Origin = Origin;
+    if (OnDone) { Entry.Waiters.Add(MoveTemp(OnDone)); }
+
+    if (GetCachedAddresses(HostName, Entry.Result.Addresses))
+    {
+        SendProbe(Origin, true);
+        return;
+    }
+
+    // getaddrinfo blocks, so resolve on a worker and come back to the game thread with the result
+    const uint32 StartGeneration = Generation;
+    Async(EAsyncExecution::ThreadPool, [Origin, HostName, StartGeneration]()
+    {
+        const double StartSeconds = FPlatformTime::Seconds();
+        TArray<FString> Addresses;
+        FString Error;
+        const bool bResolved = Resolve(HostName, Addresses, Error);
+        const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+
+        AsyncTask(ENamedThreads::GameThread, [Origin, StartGeneration, bResolved, Addresses = MoveTemp(Addresses), Error, Seconds]() mutable
+        {
+            if (!FQuickHttpModule::IsAvailable()) { return; }
+            FQuickHttpModule::Get().GetPrewarmer().HandleResolved(Origin, StartGeneration, bResolved, MoveTemp(Addresses), Error, Seconds);
+        });
+    });
+}
+
+bool FQuickHttpPrewarmer::Resolve(const FString& HostName, TArray<FString>& OutAddresses, FString& OutError)
+{
+    ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (!Sockets)
+    {
+        OutError = TEXT("No socket subsystem");
+        return false;
+    }
+
+    const FAddressInfoResult Info = Sockets->GetAddressInfo(*HostName, nullptr, EAddressInfoFlags::Default, NAME_None);
+    if (Info.ReturnCode != SE_NO_ERROR || Info.Results.Num() == 0)
+    {
+        OutError = FString::Printf(TEXT("Could not resolve %s (%s)"), *HostName, Sockets->GetSocketError(Info.ReturnCode));
+        return false;
+    }
+    for (const FAddressInfoResultData& Data : Info.Results)
+    {
+        OutAddresses.AddUnique(Data.Address->ToString(false));
+    }
+    return true;
+}
+
+void FQuickHttpPrewarmer::HandleResolved(const FString& Origin, uint32 InGeneration, bool bResolved, TArray<FString>&& Addresses, const FString& Error, double Seconds)
+{
+    FWarming* Entry = InGeneration == Generation ? Warming.Find(Origin) : nullptr;
+    if (!Entry) { return; }
+
+    Entry->Result.DnsMs = (float)(Seconds * 1000.0);
+    if (!bResolved)
+    {
+        FinishOrigin(Origin, Error);
+        return;
+    }
+
+    {
+        FScopeLock Lock(&DnsLock);
+        const double Now = FPlatformTime::Seconds();
+        for (auto It = DnsCache.CreateIterator(); It; ++It)
+        {
+            if (It->Value.ExpiresAtSeconds <= Now) { It.RemoveCurrent(); }
+        }
+        FDnsEntry& Dns = DnsCache.FindOrAdd(GetHostName(Origin));
+        Dns.Addresses = Addresses;
+        Dns.ExpiresAtSeconds = Now + DnsTtlSeconds;
+    }
+    Entry->Result.Addresses = MoveTemp(Addresses);
+    SendProbe(Origin, true);
+}
+
+void FQuickHttpPrewarmer::SendProbe(const FString& Origin, bool bCold)
+{
+    FWarming* Entry = Warming.Find(Origin);
+    if (!Entry) { return; }
+
+    // HEAD keeps the probe cheap; any answer at all proves the connection is up
+    TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> Req = FHttpModule::Get().CreateRequest();
+    Req->SetURL(Origin + TEXT("/"));
+    Req->SetVerb(TEXT("HEAD"));
+
+    const uint32 StartGeneration = Generation;
+    Req->OnProcessRequestComplete().BindLambda([Origin, StartGeneration, bCold](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+    {
+        if (!FQuickHttpModule::IsAvailable()) { return; }
+        FQuickHttpModule::Get().GetPrewarmer().HandleProbe(Origin, StartGeneration, bCold, Response, bConnectedSuccessfully);
+    });
+
+    Entry->Request = Req;
+    Entry->bTimedOut = false;
+    Entry->TimeoutHandle = FQuickHttpModule::Get().GetTimerWheel().Schedule(TimeoutSeconds, [Origin, StartGeneration]()
+    {
+        FQuickHttpPrewarmer& Prewarmer = FQuickHttpModule::Get().GetPrewarmer();
+        FWarming* Timed = StartGeneration == Prewarmer.Generation ? Prewarmer.Warming.Find(Origin) : nullptr;
+        if (!Timed) { return; }
+        Timed->TimeoutHandle.Invalidate();
+        Timed->bTimedOut = true;
+        if (Timed->Request.IsValid())
+        {
+            Timed->Request->CancelRequest();
+        }
+    });
+    Entry->SentAtSeconds = FPlatformTime::Seconds();
+
+    // May complete synchronously; Entry must not be used after this
+    Req->ProcessRequest();
+}
+
+void FQuickHttpPrewarmer::HandleProbe(const FString& Origin, uint32 InGeneration, bool bCold, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+{
+    FWarming* Entry = InGeneration == Generation ? Warming.Find(Origin) : nullptr;
+    if (!Entry) { return; }
+
+    const double Now = FPlatformTime::Seconds();
+    const float ElapsedMs = (float)((Now - Entry->SentAtSeconds) * 1000.0);
+    if (Entry->TimeoutHandle.IsValid())
+    {
+        FQuickHttpModule::Get().GetTimerWheel().Cancel(Entry->TimeoutHandle);
+    }
+    Entry->Request.Reset();
+
+    if (!bConnectedSuccessfully || !Response.IsValid())
+    {
+        FinishOrigin(Origin, Entry->bTimedOut
+            ? FString::Printf(TEXT("Timed out after %d s"), TimeoutSeconds)
+            : FString(TEXT("Could not connect")));
+        return;
+    }
+
+    Entry->Result.StatusCode = Response->GetResponseCode();
+    if (bCold)
+    {
+        Entry->Result.ColdMs = ElapsedMs;
+        SendProbe(Origin, false);
+        return;
+    }
+
+    Entry->Result.WarmMs = ElapsedMs;
+    Entry->Result.bSucceeded = true;
+    WarmUntilSeconds.Add(Origin, Now + DnsTtlSeconds);
+    FinishOrigin(Origin, FString());
+}
+
+void FQuickHttpPrewarmer::FinishOrigin(const FString& Origin, const FString& Error)
+{
+    FWarming* Found = Warming.Find(Origin);
+    if (!Found) { return; }
+    FWarming Done = MoveTemp(*Found);
+    Warming.Remove(Origin);
+
+    Done.Result.Error = Error;
+    if (Error.IsEmpty())
+    {
+        UE_LOG(LogQuickHttp, Log, TEXT("QuickHttp prewarmed %s: dns %.1f ms, cold %.1f ms, warm %.1f ms, %d address(es)"),
+            *Origin, Done.Result.DnsMs, Done.Result.ColdMs, Done.Result.WarmMs, Done.Result.Addresses.Num());
+    }
+    else
+    {
+        UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp could not prewarm %s: %s"), *Origin, *Error);
+    }
+
+    for (const FOnOriginDone& Waiter : Done.Waiters)
+    {
+        Waiter(Done.Result);
+    }
+}
+
+#if !UE_BUILD_SHIPPING
+
+namespace QuickHttpPrewarm
+{
+    static void RunPrewarm(const TArray<FString>& Args)
+    {
+        if (Args.Num() == 0)
+        {
+            UE_LOG(LogQuickHttp, Display, TEXT("Usage: QuickHttp.Prewarm <url> [url...]"));
+            return;
+        }
+        FQuickHttpModule::Get().GetPrewarmer().Prewarm(Args, true, [](const TArray<FQuickHttpPrewarmResult>& Results)
+        {
+            for (const FQuickHttpPrewarmResult& Result : Results)
+            {
+                UE_LOG(LogQuickHttp, Display, TEXT("%-40s %-4s dns %7.1f ms  cold %7.1f ms  warm %7.1f ms  saved %7.1f ms  %s"),
+                    *Result.Origin, Result.bSucceeded ? TEXT("ok") : TEXT("FAIL"), Result.DnsMs, Result.ColdMs, Result.WarmMs,
+                    Result.bSucceeded ? Result.DnsMs + Result.ColdMs - Result.WarmMs : 0.f, *Result.Error);
+            }
+        });
+    }
+
+    static FAutoConsoleCommand PrewarmCommand(
+        TEXT("QuickHttp.Prewarm"),
+        TEXT("Resolve and open keep-alive connections to the given origins now, and log cold vs warm first-request latency. Args: <url> [url...]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunPrewarm));
+}
+
+#endif
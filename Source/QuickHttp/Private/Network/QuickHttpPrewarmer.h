@@ -0,0 +1,79 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+#include "Scheduling/QuickHttpTimerWheel.h"
+#include "Interfaces/IHttpRequest.h"
+
+/**
+ * Warms connections to known origins before the first real request needs them.
+ *
+ * Each origin's host name is resolved on a worker thread (results are cached for the DNS TTL), then
+ * a HEAD request opens a keep-alive connection through the engine HTTP module. Its connection pool
+ * keeps that connection and its TLS session, so the next request to the origin skips DNS, TCP and TLS.
+ * A second HEAD on the warmed connection measures what the first real request will now cost.
+ * Warming the same origin twice at once shares one attempt. Game thread only, except GetCachedAddresses.
+ */
+class FQuickHttpPrewarmer
+{
+public:
+    typedef TFunction<void(const TArray<FQuickHttpPrewarmResult>&)> FOnPrewarmed;
+
+    void Configure(double InDnsTtlSeconds, int32 InTimeoutSeconds);
+
+    /**
+     * Warm the origin of every URL (bare host names are taken as https). OnDone, if bound, receives one
+     * result per URL, in order, once all of them finished. Origins warmed less than the DNS TTL ago
+     * are skipped unless bForce.
+     */
+    void Prewarm(const TArray<FString>& Urls, bool bForce, FOnPrewarmed OnDone);
+
+    /** Addresses HostName resolved to, if they were resolved less than the DNS TTL ago. Thread-safe. */
+    bool GetCachedAddresses(const FString& HostName, TArray<FString>& OutAddresses) const;
+
+    /** "scheme://host[:port]" of Url, lower case; empty if Url has no host. */
+    static FString GetOrigin(const FString& Url);
+
+    /** Abort everything in progress without calling back and forget what was warmed. */
+    void Reset();
+
+private:
+    typedef TFunction<void(const FQuickHttpPrewarmResult&)> FOnOriginDone;
+
+    struct FWarming
+    {
+        FQuickHttpPrewarmResult Result;
+        TArray<FOnOriginDone> Waiters;
+        TSharedPtr<IHttpRequest, ESPMode::NotThreadSafe> Request;
+        FQuickHttpTimerHandle TimeoutHandle;
+        double SentAtSeconds = 0.0;
+        bool bTimedOut = false;
+    };
+
+    struct FDnsEntry
+    {
+        TArray<FString> Addresses;
+        double ExpiresAtSeconds = 0.0;
+    };
+
+    void WarmOrigin(const FString& Origin, bool bForce, FOnOriginDone OnDone);
+    void HandleResolved(const FString& Origin, uint32 InGeneration, bool bResolved, TArray<FString>&& Addresses, const FString& Error, double Seconds);
+    void SendProbe(const FString& Origin, bool bCold);
+    void HandleProbe(const FString& Origin, uint32 InGeneration, bool bCold, FHttpResponsePtr Response, bool bConnectedSuccessfully);
+    void FinishOrigin(const FString& Origin, const FString& Error);
+    static bool Resolve(const FString& HostName, TArray<FString>& OutAddresses, FString& OutError);
+
+    static FString GetHostName(const FString& Origin);
+
+    mutable FCriticalSection DnsLock;
+    TMap<FString, FDnsEntry> DnsCache;
+
+    TMap<FString, FWarming> Warming;
+    TMap<FString, double> WarmUntilSeconds;
+    double DnsTtlSeconds = 300.0;
+    int32 TimeoutSeconds = 10;
+
+    // Bumped by Reset so callbacks of aborted work are ignored
+    uint32 Generation = 0;
+};
@@ -0,0 +1,162 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Network/QuickHttpStreamParser.h"
+
+FQuickHttpStreamParser::FQuickHttpStreamParser(EQuickHttpStreamFormat InFormat, int32 InMaxBufferBytes)
+    : Format(InFormat), MaxBufferBytes(FMath::Max(1, InMaxBufferBytes))
+{
+}
+
+bool FQuickHttpStreamParser::Feed(const uint8* Data, int64 Num, TArray<FQuickHttpStreamRecord>& Out)
+{
+    int64 Pos = 0;
+    if (Num > 0 && bAfterCR)
+    {
+        // The LF of a CRLF split across two chunks
+        bAfterCR = false;
+        if (Data[0] == '\n') { Pos = 1; }
+    }
+
+    while (Pos < Num)
+    {
+        int64 End = Pos;
+        while (End < Num && Data[End] != '\n' && Data[End] != '\r') { ++End; }
+
+        const int64 Len = End - Pos;
+        if ((int64)Partial.Num() + Len + EventData.Num() > MaxBufferBytes) { return false; }
+
+        if (End == Num)
+        {
+            Partial.Append(Data + Pos, (int32)Len);
+            break;
+        }
+
+        bool bOk;
+        if (Partial.Num() > 0)
+        {
+            Partial.Append(Data + Pos, (int32)Len);
+            bOk = HandleLine(Partial.GetData(), Partial.Num(), Out);
+            Partial.Reset();
+        }
+        else
+        {
+            // Common case: the whole line is inside this chunk, parse it in place
+            bOk = HandleLine(Data + Pos, (int32)Len, Out);
+        }
+        if (!bOk) { return false; }
+
+        if (Data[End] == '\r')
+        {
+            if (End + 1 == Num) { bAfterCR = true; }
+            else if (Data[End + 1] == '\n') { ++End; }
+        }
+        Pos = End + 1;
+    }
+    return true;
+}
+
+void FQuickHttpStreamParser::Finish(TArray<FQuickHttpStreamRecord>& Out)
+{
+    if (Format == EQuickHttpStreamFormat::NDJSON && Partial.Num() > 0)
+    {
+        HandleLine(Partial.GetData(), Partial.Num(), Out);
+    }
+    ResetConnection();
+}
+
+void FQuickHttpStreamParser::ResetConnection()
+{
+    Partial.Reset();
+    EventData.Reset();
+    bHasData = false;
+    EventType.Reset();
+    bAfterCR = false;
+    bAtStart = true;
+}
+
+bool FQuickHttpStreamParser::HandleLine(const uint8* Line, int32 Len, TArray<FQuickHttpStreamRecord>& Out)
+{
+    if (bAtStart)
+    {
+        bAtStart = false;
+        if (Len >= 3 && Line[0] == 0xEF && Line[1] == 0xBB && Line[2] == 0xBF)
+        {
+            Line += 3;
+            Len -= 3;
+        }
+    }
+
+    if (Format == EQuickHttpStreamFormat::NDJSON)
+    {
+        // Blank and whitespace-only lines separate nothing in NDJSON; skip them
+        int32 First = 0;
+        while (First < Len && (Line[First] == ' ' || Line[First] == '\t')) { ++First; }
+        if (First == Len) { return true; }
+        FQuickHttpStreamRecord& Record = Out.AddDefaulted_GetRef();
+        Record.Data = Utf8ToString(Line, Len);
+        return true;
+    }
+
+    if (Len == 0)
+    {
+        DispatchEvent(Out);
+        return true;
+    }
+    if (Line[0] == ':') { return true; }
+
+    // "field: value" (one space after the colon is dropped) or a bare "field"
+    int32 Colon = 0;
+    while (Colon < Len && Line[Colon] != ':') { ++Colon; }
+    const FString Field = Utf8ToString(Line, Colon);
+    int32 ValueStart = FMath::Min(Colon + 1, Len);
+    if (ValueStart < Len && Line[ValueStart] == ' ') { ++ValueStart; }
+    const uint8* Value = Line + ValueStart;
+    const int32 ValueLen = Len - ValueStart;
+
+    if (Field == TEXT("data"))
+    {
+        if (EventData.Num() + ValueLen + 1 > MaxBufferBytes) { return false; }
+        if (bHasData) { EventData.Add('\n'); }
+        EventData.Append(Value, ValueLen);
+        bHasData = true;
+    }
+    else if (Field == TEXT("event"))
+    {
+        EventType = Utf8ToString(Value, ValueLen);
+    }
+    else if (Field == TEXT("id"))
+    {
+        bool bHasNull = false;
+        for (int32 Index = 0; Index < ValueLen && !bHasNull; ++Index) { bHasNull = Value[Index] == 0; }
+        if (!bHasNull) { LastEventId = Utf8ToString(Value, ValueLen); }
+    }
+    else if (Field == TEXT("retry"))
+    {
+        bool bDigits = ValueLen > 0 && ValueLen <= 9;
+        for (int32 Index = 0; Index < ValueLen && bDigits; ++Index) { bDigits = Value[Index] >= '0' && Value[Index] <= '9'; }
+        if (bDigits) { RetryMs = FCString::Atoi(*Utf8ToString(Value, ValueLen)); }
+    }
+    return true;
+}
+
+void FQuickHttpStreamParser::DispatchEvent(TArray<FQuickHttpStreamRecord>& Out)
+{
+    // An event without data lines is not dispatched, but still ends the event
+    if (bHasData)
+    {
+        FQuickHttpStreamRecord& Record = Out.AddDefaulted_GetRef();
+        Record.Data = Utf8ToString(EventData.GetData(), EventData.Num());
+        Record.Event = EventType.IsEmpty() ? FString(TEXT("message")) : EventType;
+        Record.Id = LastEventId;
+    }
+    EventData.Reset();
+    bHasData = false;
+    EventType.Reset();
+}
+
+FString FQuickHttpStreamParser::Utf8ToString(const uint8* Data, int32 Len)
+{
+    if (Len <= 0) { return FString(); }
+    FUTF8ToTCHAR Converted((const ANSICHAR*)Data, Len);
+    return FString(Converted.Length(), Converted.Get());
+}
@@ -0,0 +1,52 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+/**
+ * Incremental record parser for NDJSON and Server-Sent Events bodies.
+ *
+ * Bytes can be fed in chunks of any size, split anywhere (even inside a UTF-8 sequence). Lines end
+ * with LF, CR or CRLF. Only the unfinished line and the SSE event being assembled are buffered, and
+ * both together are limited to MaxBufferBytes. Not thread-safe.
+ */
+class FQuickHttpStreamParser
+{
+public:
+    FQuickHttpStreamParser(EQuickHttpStreamFormat InFormat, int32 InMaxBufferBytes);
+
+    /** Consume bytes and append every record they complete to Out. false once one record outgrows the buffer limit. */
+    bool Feed(const uint8* Data, int64 Num, TArray<FQuickHttpStreamRecord>& Out);
+
+    /** End of the stream: a last NDJSON line without newline still counts; an unterminated SSE event is dropped. */
+    void Finish(TArray<FQuickHttpStreamRecord>& Out);
+
+    /** Forget partial input before reading a new connection. The SSE last event ID and retry delay carry over. */
+    void ResetConnection();
+
+    /** Last SSE event ID seen, to send back as Last-Event-ID when reconnecting. */
+    const FString& GetLastEventId() const { return LastEventId; }
+
+    /** Reconnection delay requested by the server with "retry:", or -1. */
+    int32 GetRetryMs() const { return RetryMs; }
+
+private:
+    bool HandleLine(const uint8* Line, int32 Len, TArray<FQuickHttpStreamRecord>& Out);
+    void DispatchEvent(TArray<FQuickHttpStreamRecord>& Out);
+    static FString Utf8ToString(const uint8* Data, int32 Len);
+
+    EQuickHttpStreamFormat Format;
+    int32 MaxBufferBytes;
+
+    TArray<uint8> Partial;
+    bool bAfterCR = false;
+    bool bAtStart = true;
+
+    // Server-Sent Event being assembled
+    TArray<uint8> EventData;
+    bool bHasData = false;
+    FString EventType;
+    FString LastEventId;
+    int32 RetryMs = -1;
+};
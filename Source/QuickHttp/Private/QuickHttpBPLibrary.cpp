@@ -1,19 +1,270 @@
 // Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
 
 #include "QuickHttpBPLibrary.h"
+#include "QuickHttpModule.h"
+#include "QuickHttpRequestKey.h"
+#include "Json/QuickJsonReformatter.h"
+#include "Json/QuickJsonPath.h"
+#include "Json/QuickJsonBuilder.h"
+#include "Json/QuickJsonStreamWriter.h"
+#include "Json/QuickJsonPatch.h"
+#include "Json/QuickBinaryJson.h"
 #include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
 bool UQuickHttpBPLibrary::PrettyPrintJson(const FString& InJson, FString& OutPrettyJson)
 {
-    TSharedPtr<FJsonObject> Obj;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(InJson);
-    if (FJsonSerializer::Deserialize(Reader, Obj) && Obj.IsValid())
+    if (FQuickJsonReformatter::Reformat(InJson, EQuickJsonFormat::Pretty, OutPrettyJson))
     {
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutPrettyJson);
-        return FJsonSerializer::Serialize(Obj.ToSharedRef(), Writer);
+        return true;
     }
     OutPrettyJson = InJson;
     return false;
 }
+
+bool UQuickHttpBPLibrary::MinifyJson(const FString& InJson, FString& OutMinifiedJson)
+{
+    if (FQuickJsonReformatter::Reformat(InJson, EQuickJsonFormat::Minify, OutMinifiedJson))
+    {
+        return true;
+    }
+    OutMinifiedJson = InJson;
+    return false;
+}
+
+bool UQuickHttpBPLibrary::ValidateJson(const FString& InJson, FString& OutError)
+{
+    OutError.Reset();
+    return FQuickJsonReformatter::Validate(InJson, &OutError);
+}
+
+bool UQuickHttpBPLibrary::ExtractJsonValues(const FString& InJson, const FString& Path, TArray<FQuickJsonPathMatch>& OutMatches)
+{
+    OutMatches.Reset();
+    FQuickJsonPathPtr Compiled = FQuickJsonPath::Compile(Path);
+    return Compiled.IsValid() && Compiled->Extract(InJson, OutMatches);
+}
+
+static bool ExtractFirst(const FString& InJson, const FString& Path, FQuickJsonPathMatch& OutMatch)
+{
+    FQuickJsonPathPtr Compiled = FQuickJsonPath::Compile(Path);
+    if (!Compiled.IsValid()) { return false; }
+
+    // A selector without wildcards stops at its first match
+    TArray<FQuickJsonPathMatch> Matches;
+    if (!Compiled->Extract(InJson, Matches) || Matches.Num() == 0) { return false; }
+    OutMatch = MoveTemp(Matches[0]);
+    return true;
+}
+
+bool UQuickHttpBPLibrary::ExtractJsonString(const FString& InJson, const FString& Path, FString& OutValue)
+{
+    FQuickJsonPathMatch Match;
+    if (!ExtractFirst(InJson, Path, Match)) { return false; }
+    OutValue = MoveTemp(Match.StringValue);
+    return true;
+}
+
+bool UQuickHttpBPLibrary::ExtractJsonNumber(const FString& InJson, const FString& Path, float& OutValue)
+{
+    FQuickJsonPathMatch Match;
+    if (!ExtractFirst(InJson, Path, Match) || Match.Type != EQuickJsonType::Number) { return false; }
+    OutValue = Match.NumberValue;
+    return true;
+}
+
+bool UQuickHttpBPLibrary::ExtractJsonInt(const FString& InJson, const FString& Path, int32& OutValue)
+{
+    FQuickJsonPathMatch Match;
+    if (!ExtractFirst(InJson, Path, Match) || Match.Type != EQuickJsonType::Number) { return false; }
+    // Converting an out-of-range (or NaN) double to int32 is undefined, so such numbers do not match
+    const double Number = FCString::Atod(*Match.StringValue);
+    if (!(Number > (double)MIN_int32 - 1.0 && Number < (double)MAX_int32 + 1.0)) { return false; }
+    OutValue = (int32)Number;
+    return true;
+}
+
+bool UQuickHttpBPLibrary::ExtractJsonBool(const FString& InJson, const FString& Path, bool& bOutValue)
+{
+    FQuickJsonPathMatch Match;
+    if (!ExtractFirst(InJson, Path, Match) || Match.Type != EQuickJsonType::Boolean) { return false; }
+    bOutValue = Match.BoolValue;
+    return true;
+}
+
+static bool ParseJsonValue(const FString& Json, TSharedPtr<FJsonValue>& OutValue)
+{
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+    return FJsonSerializer::Deserialize(Reader, OutValue) && OutValue.IsValid();
+}
+
+static FString ToCompactJson(const TSharedPtr<FJsonValue>& Value)
+{
+    TArray<uint8> Bytes;
+    FQuickBinaryJson::Encode(Value, EQuickHttpBodyFormat::Json, Bytes);
+    return QuickHttp::Utf8BytesToString(Bytes);
+}
+
+static bool DiffJsonValues(const TSharedPtr<FJsonValue>& Source, const TSharedPtr<FJsonValue>& Target, EQuickJsonPatchFormat Format,
+                           FString& OutPatch, FQuickHttpHeader& OutContentType, bool& bOutChanged)
+{
+    const TSharedPtr<FJsonValue> Patch = FQuickJsonPatch::Diff(Source, Target, Format);
+    OutPatch = ToCompactJson(Patch);
+    OutContentType.Name = TEXT("Content-Type");
+    OutContentType.Value = FQuickJsonPatch::GetContentType(Format);
+    bOutChanged = !FQuickJsonPatch::IsEmpty(Patch, Format);
+    return true;
+}
+
+bool UQuickHttpBPLibrary::DiffJson(const FString& SourceJson, const FString& TargetJson, EQuickJsonPatchFormat Format,
+                                   FString& OutPatch, FQuickHttpHeader& OutContentType, bool& bOutChanged)
+{
+    OutPatch.Reset();
+    bOutChanged = false;
+    TSharedPtr<FJsonValue> Source;
+    TSharedPtr<FJsonValue> Target;
+    if (!ParseJsonValue(SourceJson, Source) || !ParseJsonValue(TargetJson, Target)) { return false; }
+    return DiffJsonValues(Source, Target, Format, OutPatch, OutContentType, bOutChanged);
+}
+
+bool UQuickHttpBPLibrary::DiffJsonBuilders(UQuickJsonBuilder* Source, UQuickJsonBuilder* Target, EQuickJsonPatchFormat Format,
+                                           FString& OutPatch, FQuickHttpHeader& OutContentType, bool& bOutChanged)
+{
+    OutPatch.Reset();
+    bOutChanged = false;
+    if (!Target || !Target->GetObject().IsValid()) { return false; }
+
+    // No previous state yet: the patch carries the whole object
+    TSharedPtr<FJsonObject> SourceObject = Source ? Source->GetObject() : nullptr;
+    if (!SourceObject.IsValid()) { SourceObject = MakeShared<FJsonObject>(); }
+    return DiffJsonValues(MakeShared<FJsonValueObject>(SourceObject), MakeShared<FJsonValueObject>(Target->GetObject()),
+                          Format, OutPatch, OutContentType, bOutChanged);
+}
+
+bool UQuickHttpBPLibrary::ApplyJsonPatch(const FString& InJson, const FString& Patch, EQuickJsonPatchFormat Format, FString& OutJson, FString& OutError)
+{
+    OutJson.Reset();
+    OutError.Reset();
+    TSharedPtr<FJsonValue> Target;
+    TSharedPtr<FJsonValue> PatchValue;
+    if (!ParseJsonValue(InJson, Target))
+    {
+        OutError = TEXT("The document is not valid JSON");
+        return false;
+    }
+    if (!ParseJsonValue(Patch, PatchValue))
+    {
+        OutError = TEXT("The patch is not valid JSON");
+        return false;
+    }
+
+    TSharedPtr<FJsonValue> Result;
+    if (!FQuickJsonPatch::Apply(Target, PatchValue, Format, Result, OutError)) { return false; }
+    OutJson = ToCompactJson(Result);
+    return true;
+}
+
+FQuickHttpCacheStats UQuickHttpBPLibrary::GetHttpCacheStats()
+{
+    return FQuickHttpModule::IsAvailable() ? FQuickHttpModule::Get().GetResponseCache().GetStats() : FQuickHttpCacheStats();
+}
+
+void UQuickHttpBPLibrary::ClearHttpCache()
+{
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetResponseCache().Clear();
+    }
+}
+
+FQuickHttpHostMetrics UQuickHttpBPLibrary::GetHttpMetrics(TArray<FQuickHttpHostMetrics>& PerHost)
+{
+    PerHost.Reset();
+#if QUICKHTTP_WITH_METRICS
+    if (FQuickHttpModule::IsAvailable())
+    {
+        return FQuickHttpModule::Get().GetMetrics().GetSnapshot(PerHost);
+    }
+#endif
+    return FQuickHttpHostMetrics();
+}
+
+void UQuickHttpBPLibrary::ResetHttpMetrics()
+{
+#if QUICKHTTP_WITH_METRICS
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetMetrics().Reset();
+    }
+#endif
+}
+
+TArray<FQuickHttpCircuitStatus> UQuickHttpBPLibrary::GetHttpCircuitStatus()
+{
+    TArray<FQuickHttpCircuitStatus> PerHost;
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetCircuitBreaker().GetStatus(PerHost);
+    }
+    return PerHost;
+}
+
+EQuickHttpCircuitState UQuickHttpBPLibrary::GetHttpCircuitState(const FString& HostOrUrl)
+{
+    return FQuickHttpModule::IsAvailable()
+        ? FQuickHttpModule::Get().GetCircuitBreaker().GetState(QuickHttp::GetUrlHost(HostOrUrl))
+        : EQuickHttpCircuitState::Closed;
+}
+
+void UQuickHttpBPLibrary::ResetHttpCircuitBreakers()
+{
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetCircuitBreaker().Reset();
+    }
+}
+
+bool UQuickHttpBPLibrary::ConfigureHttpTelemetryChannel(FName Channel, const FQuickHttpTelemetryConfig& Config)
+{
+    return FQuickHttpModule::IsAvailable() && FQuickHttpModule::Get().GetTelemetry().Configure(Channel, Config);
+}
+
+bool UQuickHttpBPLibrary::RecordTelemetryEvent(FName Channel, const FString& EventJson)
+{
+    return FQuickHttpModule::IsAvailable() && FQuickHttpModule::Get().GetTelemetry().RecordString(Channel, EventJson);
+}
+
+bool UQuickHttpBPLibrary::RecordTelemetryEventFromWriter(FName Channel, UQuickJsonStreamWriter* Event)
+{
+    FString Error;
+    if (!Event || !Event->IsComplete(Error) || !FQuickHttpModule::IsAvailable()) { return false; }
+    return FQuickHttpModule::Get().GetTelemetry().Record(Channel, Event->GetWriter().GetBytes());
+}
+
+bool UQuickHttpBPLibrary::RecordTelemetryEventFromBuilder(FName Channel, UQuickJsonBuilder* Event)
+{
+    if (!Event || !FQuickHttpModule::IsAvailable()) { return false; }
+    TArray<uint8> Bytes;
+    Event->WriteBytes(EQuickHttpBodyFormat::Json, Bytes);
+    return FQuickHttpModule::Get().GetTelemetry().Record(Channel, Bytes);
+}
+
+void UQuickHttpBPLibrary::FlushHttpTelemetry(FName Channel)
+{
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetTelemetry().Flush(Channel);
+    }
+}
+
+TArray<FQuickHttpTelemetryStats> UQuickHttpBPLibrary::GetHttpTelemetryStats()
+{
+    TArray<FQuickHttpTelemetryStats> Stats;
+    if (FQuickHttpModule::IsAvailable())
+    {
+        FQuickHttpModule::Get().GetTelemetry().GetAllStats(Stats);
+    }
+    return Stats;
+}
@@ -0,0 +1,15 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+
+// IHttpRequest::OnRequestProgress64 replaced the int32 progress delegate in UE 5.4
+#define QUICKHTTP_HAS_PROGRESS64 (ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4))
+
+// IHttpRequest::SetResponseBodyReceiveStream hands the body over while it downloads (UE 5.3); earlier engines only deliver it on completion
+#define QUICKHTTP_HAS_RESPONSE_STREAM (ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3))
+
+// FProperty::ArrayDim is read through GetArrayDim() from UE 5.5
+#define QUICKHTTP_HAS_ARRAY_DIM_GETTER (ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5))
@@ -1,11 +1,130 @@
 // Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
 
+#include "QuickHttpModule.h"
+#include "QuickHttpSettings.h"
+#include "Async/HttpJsonRequestAsync.h"
 #include "Modules/ModuleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
 
-class FQuickHttpModule : public IModuleInterface
+DEFINE_LOG_CATEGORY(LogQuickHttp);
+
+FQuickHttpModule& FQuickHttpModule::Get()
+{
+    return FModuleManager::LoadModuleChecked<FQuickHttpModule>(TEXT("QuickHttp"));
+}
+
+bool FQuickHttpModule::IsAvailable()
+{
+    return FModuleManager::Get().IsModuleLoaded(TEXT("QuickHttp"));
+}
+
+void FQuickHttpModule::StartupModule()
+{
+    const UQuickHttpSettings* Settings = GetDefault<UQuickHttpSettings>();
+    RetryQueue.SetMaxPending(Settings->MaxPendingRetries);
+    Scheduler.Configure(Settings->MaxConcurrentRequestsPerHost, Settings->MaxConcurrentRequests);
+    ResponseCache.Configure((int64)Settings->CacheMaxMemoryKB * 1024,
+        Settings->bCachePersistToDisk ? FPaths::ProjectSavedDir() / TEXT("QuickHttp") / TEXT("Cache") : FString(),
+        (int64)Settings->CacheMaxDiskMB * 1024 * 1024);
+    CircuitBreaker.Configure(Settings->bUseCircuitBreaker, Settings->CircuitWindowSize, Settings->CircuitFailureRatePercent,
+        Settings->CircuitOpenSeconds, Settings->bUseRetryBudget, Settings->RetryBudgetPercent, Settings->RetryBudgetMaxTokens);
+    CircuitBreaker.OnStateChanged().AddRaw(this, &FQuickHttpModule::HandleCircuitStateChanged);
+    HedgePolicy.Configure(Settings->HedgeBudgetPercent, Settings->HedgePercentile, Settings->HedgeDefaultDelaySeconds, Settings->HedgeMinDelaySeconds);
+    Prewarmer.Configure(Settings->PrewarmDnsTtlSeconds, Settings->PrewarmTimeoutSeconds);
+    for (const TPair<FName, FQuickHttpTelemetryConfig>& Channel : Settings->TelemetryChannels)
+    {
+        Telemetry.Configure(Channel.Key, Channel.Value);
+    }
+
+    PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FQuickHttpModule::HandlePreLoadMap);
+
+    LastTickSeconds = FPlatformTime::Seconds();
+#if ENGINE_MAJOR_VERSION >= 5
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FQuickHttpModule::Tick), 0.0f);
+#else
+    TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FQuickHttpModule::Tick), 0.0f);
+#endif
+}
+
+void FQuickHttpModule::ShutdownModule()
+{
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#else
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+#endif
+    TickHandle.Reset();
+    FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+
+    // Unsent telemetry goes to the spill logs before the batch in flight is cancelled below
+    Telemetry.Shutdown();
+
+    // Abort whatever is still running without calling back into Blueprint during shutdown
+    for (const FQuickHttpCancelRegistry::FNodeRef& WeakNode : CancelRegistry.TakeAll())
+    {
+        if (UHttpJsonRequestAsync* Node = WeakNode.Get())
+        {
+            Node->Cancel();
+        }
+    }
+    CancelRegistry.Reset();
+    Prewarmer.Reset();
+    TimerWheel.Reset();
+    RetryQueue.Reset();
+    ResponseCache.Flush();
+    SingleFlight.Reset();
+    Scheduler.Reset();
+    HedgePolicy.Reset();
+    CircuitBreaker.OnStateChanged().Clear();
+    CircuitBreaker.Reset();
+}
+
+bool FQuickHttpModule::Tick(float DeltaTime)
+{
+    // Use wall-clock time so time dilation or fixed-step frames never stretch request deadlines
+    const double Now = FPlatformTime::Seconds();
+    const double Elapsed = Now - LastTickSeconds;
+    LastTickSeconds = Now;
+
+    // Warm the configured origins on the first tick, once the HTTP module is up, without delaying startup
+    if (!bStartupPrewarmDone)
+    {
+        bStartupPrewarmDone = true;
+        const UQuickHttpSettings* Settings = GetDefault<UQuickHttpSettings>();
+        if (Settings->bPrewarmOnStartup && Settings->PrewarmUrls.Num() > 0)
+        {
+            Prewarmer.Prewarm(Settings->PrewarmUrls, false, nullptr);
+        }
+    }
+
+    TimerWheel.Advance(Elapsed);
+    RetryQueue.Tick(Now);
+    Telemetry.Tick(Now);
+#if QUICKHTTP_WITH_METRICS
+    Metrics.Tick(Scheduler.NumInFlight(), Scheduler.NumQueued());
+    Metrics.TickTelemetry(Telemetry.NumQueuedEvents(), Telemetry.NumSpilledEvents());
+#endif
+    return true;
+}
+
+void FQuickHttpModule::HandlePreLoadMap(const FString& MapName)
 {
-public:
-    virtual void StartupModule() override {}
-    virtual void ShutdownModule() override {}
-};
+    if (GetDefault<UQuickHttpSettings>()->bCancelRequestsOnMapChange)
+    {
+        UHttpJsonRequestAsync::CancelAllWithReason(TEXT("Cancelled by map change"));
+    }
+}
+
+void FQuickHttpModule::HandleCircuitStateChanged(const FString& Host, EQuickHttpCircuitState From, EQuickHttpCircuitState To)
+{
+    const UEnum* StateEnum = StaticEnum<EQuickHttpCircuitState>();
+    UE_LOG(LogQuickHttp, Log, TEXT("Circuit breaker for %s: %s -> %s"), *Host,
+        *StateEnum->GetNameStringByValue((int64)From), *StateEnum->GetNameStringByValue((int64)To));
+#if QUICKHTTP_WITH_METRICS
+    Metrics.RecordCircuitTransition(To);
+#endif
+}
+
 IMPLEMENT_MODULE(FQuickHttpModule, QuickHttp)
@@ -0,0 +1,98 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Modules/ModuleInterface.h"
+#include "Containers/Ticker.h"
+#include "Scheduling/QuickHttpTimerWheel.h"
+#include "Scheduling/QuickHttpRetryQueue.h"
+#include "Cache/QuickHttpResponseCache.h"
+#include "Scheduling/QuickHttpSingleFlight.h"
+#include "Scheduling/QuickHttpRequestScheduler.h"
+#include "Scheduling/QuickHttpCancelRegistry.h"
+#include "Scheduling/QuickHttpHedgePolicy.h"
+#include "Scheduling/QuickHttpCircuitBreaker.h"
+#include "Metrics/QuickHttpMetrics.h"
+#include "Network/QuickHttpPrewarmer.h"
+#include "Telemetry/QuickHttpTelemetry.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogQuickHttp, Log, All);
+
+/**
+ * QuickHttp runtime module.
+ * Owns the shared schedulers that every request node uses, ticked once per frame on the game thread.
+ */
+class FQuickHttpModule : public IModuleInterface
+{
+public:
+    static FQuickHttpModule& Get();
+    static bool IsAvailable();
+
+    virtual void StartupModule() override;
+    virtual void ShutdownModule() override;
+
+    /** Deadline scheduler for request timeouts (game thread only). */
+    FQuickHttpTimerWheel& GetTimerWheel() { return TimerWheel; }
+
+    /** Deadline-ordered queue of pending retries (game thread only). */
+    FQuickHttpRetryQueue& GetRetryQueue() { return RetryQueue; }
+
+    /** Shared GET response cache (thread-safe). */
+    FQuickHttpResponseCache& GetResponseCache() { return ResponseCache; }
+
+    /** Coalesced in-flight GET registry (game thread only). */
+    FQuickHttpSingleFlight& GetSingleFlight() { return SingleFlight; }
+
+    /** Per-host / global concurrency limiter with priority queues (game thread only). */
+    FQuickHttpRequestScheduler& GetScheduler() { return Scheduler; }
+
+    /** Live request nodes by cancel token and the token group tree (thread-safe). */
+    FQuickHttpCancelRegistry& GetCancelRegistry() { return CancelRegistry; }
+
+    /** Per-host hedge delay and budget for hedged requests (game thread only). */
+    FQuickHttpHedgePolicy& GetHedgePolicy() { return HedgePolicy; }
+
+    /** Per-host circuit breakers and retry budgets (game thread only). */
+    FQuickHttpCircuitBreaker& GetCircuitBreaker() { return CircuitBreaker; }
+
+    /** DNS cache and keep-alive connection warming for known origins (game thread only). */
+    FQuickHttpPrewarmer& GetPrewarmer() { return Prewarmer; }
+
+    /** Batched event uploads by channel (game thread only). */
+    FQuickHttpTelemetry& GetTelemetry() { return Telemetry; }
+
+#if QUICKHTTP_WITH_METRICS
+    /** Per-host latency histograms and counters of finished requests (game thread only). */
+    FQuickHttpMetrics& GetMetrics() { return Metrics; }
+#endif
+
+private:
+    bool Tick(float DeltaTime);
+    void HandlePreLoadMap(const FString& MapName);
+    void HandleCircuitStateChanged(const FString& Host, EQuickHttpCircuitState From, EQuickHttpCircuitState To);
+
+    FQuickHttpTimerWheel TimerWheel;
+    FQuickHttpRetryQueue RetryQueue;
+    FQuickHttpResponseCache ResponseCache;
+    FQuickHttpSingleFlight SingleFlight;
+    FQuickHttpRequestScheduler Scheduler;
+    FQuickHttpCancelRegistry CancelRegistry;
+    FQuickHttpHedgePolicy HedgePolicy;
+    FQuickHttpCircuitBreaker CircuitBreaker;
+    FQuickHttpPrewarmer Prewarmer;
+    FQuickHttpTelemetry Telemetry;
+#if QUICKHTTP_WITH_METRICS
+    FQuickHttpMetrics Metrics;
+#endif
+    double LastTickSeconds = 0.0;
+    FDelegateHandle PreLoadMapHandle;
+    bool bStartupPrewarmDone = false;
+
+#if ENGINE_MAJOR_VERSION >= 5
+    FTSTicker::FDelegateHandle TickHandle;
+#else
+    FDelegateHandle TickHandle;
+#endif
+};
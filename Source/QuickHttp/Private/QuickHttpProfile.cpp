@@ -0,0 +1,87 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "QuickHttpProfile.h"
+#include "Async/Async.h"
+
+UQuickHttpProfile* UQuickHttpProfile::MakeHttpProfile(
+    const FString& InBaseUrl,
+    const TArray<FQuickHttpHeader>& InHeaders,
+    int32 InTimeoutSeconds,
+    int32 InMaxRetries,
+    float InBackoffBaseSeconds,
+    int32 InMaxPayloadKB,
+    const FString& InAuthHeaderName,
+    const FString& InAuthScheme)
+{
+    UQuickHttpProfile* Profile = NewObject<UQuickHttpProfile>();
+    Profile->BaseUrl = InBaseUrl;
+    Profile->BaseUrl.RemoveFromEnd(TEXT("/"));
+    Profile->Headers = InHeaders;
+    Profile->TimeoutSeconds = FMath::Max(1, InTimeoutSeconds);
+    Profile->MaxRetries = FMath::Max(0, InMaxRetries);
+    Profile->BackoffBaseSeconds = FMath::Max(0.01f, InBackoffBaseSeconds);
+    Profile->MaxPayloadKB = FMath::Clamp(InMaxPayloadKB, 1, 8 * 1024);
+    Profile->AuthHeaderName = InAuthHeaderName.IsEmpty() ? FString(TEXT("Authorization")) : InAuthHeaderName;
+    Profile->AuthScheme = InAuthScheme;
+    return Profile;
+}
+
+void UQuickHttpProfile::SetAuthToken(const FString& Token)
+{
+    if (!IsInGameThread())
+    {
+        TWeakObjectPtr<UQuickHttpProfile> WeakThis(this);
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Token]()
+        {
+            if (UQuickHttpProfile* Profile = WeakThis.Get())
+            {
+                Profile->SetAuthToken(Token);
+            }
+        });
+        return;
+    }
+    AuthToken = Token;
+}
+
+FString UQuickHttpProfile::GetAuthHeaderValue() const
+{
+    const FString Token = TokenProvider ? TokenProvider() : AuthToken;
+    if (Token.IsEmpty()) { return FString(); }
+    return AuthScheme.IsEmpty() ? Token : AuthScheme + TEXT(" ") + Token;
+}
+
+FString UQuickHttpProfile::ResolveUrl(const FString& Path) const
+{
+    if (Path.Contains(TEXT("://")) || BaseUrl.IsEmpty()) { return Path; }
+    if (Path.IsEmpty()) { return BaseUrl; }
+    // Query strings and fragments attach directly; everything else gets exactly one slash
+    if (Path[0] == TEXT('?') || Path[0] == TEXT('#')) { return BaseUrl + Path; }
+    return Path[0] == TEXT('/') ? BaseUrl + Path : BaseUrl + TEXT("/") + Path;
+}
+
+TArray<FQuickHttpHeader> UQuickHttpProfile::MergeHeaders(const TArray<FQuickHttpHeader>& Overrides) const
+{
+    TArray<FQuickHttpHeader> Merged;
+    Merged.Reserve(Headers.Num() + Overrides.Num() + 1);
+
+    auto Put = [&Merged](const FString& Name, const FString& Value)
+    {
+        for (FQuickHttpHeader& Existing : Merged)
+        {
+            if (Existing.Name.Equals(Name, ESearchCase::IgnoreCase))
+            {
+                Existing.Value = Value;
+                return;
+            }
+        }
+        FQuickHttpHeader& Added = Merged.AddDefaulted_GetRef();
+        Added.Name = Name;
+        Added.Value = Value;
+    };
+
+    for (const FQuickHttpHeader& H : Headers) { Put(H.Name, H.Value); }
+    const FString Auth = GetAuthHeaderValue();
+    if (!Auth.IsEmpty()) { Put(AuthHeaderName, Auth); }
+    for (const FQuickHttpHeader& H : Overrides) { Put(H.Name, H.Value); }
+    return Merged;
+}
@@ -0,0 +1,124 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+#include "Hash/CityHash.h"
+#include "Misc/Guid.h"
+
+namespace QuickHttp
+{
+    /** Verb string for a QuickHttp method. */
+    inline const TCHAR* MethodToVerb(EQuickHttpMethod Method)
+    {
+        switch (Method)
+        {
+            case EQuickHttpMethod::GET:     return TEXT("GET");
+            case EQuickHttpMethod::POST:    return TEXT("POST");
+            case EQuickHttpMethod::PUT:     return TEXT("PUT");
+            case EQuickHttpMethod::PATCH:   return TEXT("PATCH");
+            case EQuickHttpMethod::DELETE_: return TEXT("DELETE");
+        }
+        return TEXT("GET");
+    }
+
+    /**
+     * Headers that carry credentials; their values never appear in a key as text.
+     * @param AuthHeaderName  Header a request profile sends its token in, if it is not one of the usual ones.
+     */
+    inline bool IsCredentialHeader(const FString& LowerName, const FString& AuthHeaderName = FString())
+    {
+        return LowerName == TEXT("authorization") || LowerName == TEXT("proxy-authorization")
+            || LowerName == TEXT("cookie") || LowerName == TEXT("x-api-key")
+            || (!AuthHeaderName.IsEmpty() && LowerName.Equals(AuthHeaderName, ESearchCase::IgnoreCase));
+    }
+
+    /** True if any of Headers carries credentials (see IsCredentialHeader). */
+    inline bool HasCredentialHeader(const TArray<FQuickHttpHeader>& Headers, const FString& AuthHeaderName = FString())
+    {
+        return Headers.ContainsByPredicate([&AuthHeaderName](const FQuickHttpHeader& H) { return IsCredentialHeader(H.Name.ToLower(), AuthHeaderName); });
+    }
+
+    /** Salted hash standing in for a credential, so keys held in memory cannot be matched against known tokens. */
+    inline FString HashCredential(const FString& Value)
+    {
+        static const FString Salt = FGuid::NewGuid().ToString();
+        FTCHARToUTF8 Utf8(*(Salt + Value));
+        return FString::Printf(TEXT("#%016llx"), CityHash64(Utf8.Get(), Utf8.Length()));
+    }
+
+    inline FString BuildRequestKey(EQuickHttpMethod Method, const FString& Url, const TArray<FQuickHttpHeader>& Headers,
+        const FString& AuthHeaderName, bool bKeepCredentials)
+    {
+        TArray<FString> Normalized;
+        Normalized.Reserve(Headers.Num());
+        for (const FQuickHttpHeader& H : Headers)
+        {
+            const FString Name = H.Name.ToLower();
+            if (!IsCredentialHeader(Name, AuthHeaderName))
+            {
+                Normalized.Add(Name + TEXT(":") + H.Value);
+            }
+            else if (bKeepCredentials)
+            {
+                Normalized.Add(Name + TEXT(":") + HashCredential(H.Value));
+            }
+        }
+        Normalized.Sort();
+
+        FString Key = FString(MethodToVerb(Method)) + TEXT(" ") + Url;
+        for (const FString& H : Normalized)
+        {
+            Key += TEXT("\n");
+            Key += H;
+        }
+        return Key;
+    }
+
+    /**
+     * Identity of a request: verb, URL and headers normalized to lowercase names in sorted order,
+     * so two requests that only differ in header order or name casing share a key.
+     * Credentials are kept as a salted hash: requests made with different tokens never share a flight.
+     */
+    inline FString MakeRequestKey(EQuickHttpMethod Method, const FString& Url, const TArray<FQuickHttpHeader>& Headers,
+        const FString& AuthHeaderName = FString())
+    {
+        return BuildRequestKey(Method, Url, Headers, AuthHeaderName, true);
+    }
+
+    /**
+     * Same as MakeRequestKey without the credential headers, for the response cache: a token rotation
+     * keeps the cached entries, and only responses the server marks public are stored for credentialed requests.
+     */
+    inline FString MakeCacheKey(EQuickHttpMethod Method, const FString& Url, const TArray<FQuickHttpHeader>& Headers,
+        const FString& AuthHeaderName = FString())
+    {
+        return BuildRequestKey(Method, Url, Headers, AuthHeaderName, false);
+    }
+
+    /** Lowercase "host[:port]" of an absolute URL, used to group requests per backend. */
+    inline FString GetUrlHost(const FString& Url)
+    {
+        int32 Start = Url.Find(TEXT("://"));
+        Start = Start == INDEX_NONE ? 0 : Start + 3;
+
+        int32 End = Start;
+        while (End < Url.Len() && Url[End] != TEXT('/') && Url[End] != TEXT('?') && Url[End] != TEXT('#'))
+        {
+            ++End;
+        }
+
+        FString Host = Url.Mid(Start, End - Start);
+        const int32 At = Host.Find(TEXT("@"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+        if (At != INDEX_NONE) { Host = Host.RightChop(At + 1); }
+        return Host.ToLower();
+    }
+
+    /** Decode a UTF-8 byte buffer into an FString. */
+    inline FString Utf8BytesToString(const TArray<uint8>& Bytes)
+    {
+        if (Bytes.Num() == 0) { return FString(); }
+        FUTF8ToTCHAR Converted((const ANSICHAR*)Bytes.GetData(), Bytes.Num());
+        return FString(Converted.Length(), Converted.Get());
+    }
+}
@@ -0,0 +1,154 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpCancelRegistry.h"
+#include "Async/HttpJsonRequestAsync.h"
+#include "Misc/ScopeLock.h"
+
+void FQuickHttpCancelRegistry::Register(int32 Token, UHttpJsonRequestAsync* Node)
+{
+    FShard& Shard = ShardFor(Token);
+    FScopeLock Lock(&Shard.Lock);
+    Shard.Nodes.FindOrAdd(Token).Add(Node);
+}
+
+void FQuickHttpCancelRegistry::Unregister(int32 Token, UHttpJsonRequestAsync* Node)
+{
+    FShard& Shard = ShardFor(Token);
+    FScopeLock Lock(&Shard.Lock);
+    if (TSet<FNodeRef>* Set = Shard.Nodes.Find(Token))
+    {
+        Set->Remove(Node);
+        if (Set->Num() == 0)
+        {
+            Shard.Nodes.Remove(Token);
+        }
+    }
+}
+
+bool FQuickHttpCancelRegistry::LinkGroup(int32 Child, int32 Parent)
+{
+    if (Child == 0 || Parent == 0 || Child == Parent) { return false; }
+
+    FRWScopeLock Lock(GroupLock, SLT_Write);
+    for (const int32* Ancestor = Parents.Find(Parent); Ancestor; Ancestor = Parents.Find(*Ancestor))
+    {
+        if (*Ancestor == Child) { return false; }
+    }
+
+    if (const int32* OldParent = Parents.Find(Child))
+    {
+        Children.RemoveSingle(*OldParent, Child);
+    }
+    Parents.Add(Child, Parent);
+    Children.Add(Parent, Child);
+    return true;
+}
+
+void FQuickHttpCancelRegistry::UnlinkGroup(int32 Child)
+{
+    FRWScopeLock Lock(GroupLock, SLT_Write);
+    int32 Parent = 0;
+    if (Parents.RemoveAndCopyValue(Child, Parent))
+    {
+        Children.RemoveSingle(Parent, Child);
+    }
+}
+
+void FQuickHttpCancelRegistry::SetDeadline(int32 Token, double DeadlineSeconds)
+{
+    FRWScopeLock Lock(GroupLock, SLT_Write);
+    if (DeadlineSeconds > 0.0)
+    {
+        Deadlines.Add(Token, DeadlineSeconds);
+    }
+    else
+    {
+        Deadlines.Remove(Token);
+    }
+}
+
+double FQuickHttpCancelRegistry::GetDeadline(int32 Token) const
+{
+    FRWScopeLock Lock(GroupLock, SLT_ReadOnly);
+    const double* Deadline = Deadlines.Find(Token);
+    return Deadline ? *Deadline : 0.0;
+}
+
+void FQuickHttpCancelRegistry::CollectGroup(int32 Token, TArray<int32>& OutTokens) const
+{
+    // Breadth-first over the group tree; LinkGroup keeps it acyclic
+    OutTokens.Add(Token);
+    for (int32 i = 0; i < OutTokens.Num(); ++i)
+    {
+        const int32 Current = OutTokens[i];
+        Children.MultiFind(Current, OutTokens);
+    }
+}
+
+TArray<FQuickHttpCancelRegistry::FNodeRef> FQuickHttpCancelRegistry::TakeGroup(int32 Token)
+{
+    TArray<int32> Tokens;
+    {
+        FRWScopeLock Lock(GroupLock, SLT_Write);
+        CollectGroup(Token, Tokens);
+        for (int32 GroupToken : Tokens)
+        {
+            Deadlines.Remove(GroupToken);
+        }
+    }
+
+    TArray<FNodeRef> Result;
+    for (int32 GroupToken : Tokens)
+    {
+        FShard& Shard = ShardFor(GroupToken);
+        FScopeLock Lock(&Shard.Lock);
+        TSet<FNodeRef> Set;
+        if (Shard.Nodes.RemoveAndCopyValue(GroupToken, Set))
+        {
+            Result.Append(Set.Array());
+        }
+    }
+    return Result;
+}
+
+TArray<FQuickHttpCancelRegistry::FNodeRef> FQuickHttpCancelRegistry::TakeAll()
+{
+    {
+        FRWScopeLock Lock(GroupLock, SLT_Write);
+        Deadlines.Reset();
+    }
+
+    TArray<FNodeRef> Result;
+    for (FShard& Shard : Shards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+        for (const TPair<int32, TSet<FNodeRef>>& Pair : Shard.Nodes)
+        {
+            Result.Append(Pair.Value.Array());
+        }
+        Shard.Nodes.Reset();
+    }
+    return Result;
+}
+
+int32 FQuickHttpCancelRegistry::NumNodes() const
+{
+    int32 Num = 0;
+    for (const FShard& Shard : Shards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+        for (const TPair<int32, TSet<FNodeRef>>& Pair : Shard.Nodes)
+        {
+            Num += Pair.Value.Num();
+        }
+    }
+    return Num;
+}
+
+void FQuickHttpCancelRegistry::Reset()
+{
+    TakeAll();
+    FRWScopeLock Lock(GroupLock, SLT_Write);
+    Parents.Reset();
+    Children.Reset();
+}
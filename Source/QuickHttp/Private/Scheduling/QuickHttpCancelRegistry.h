@@ -0,0 +1,68 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Misc/ScopeRWLock.h"
+
+class UHttpJsonRequestAsync;
+
+/**
+ * Live request nodes by cancel token, plus parent/child links between token groups and
+ * per-group deadlines.
+ *
+ * Every node is registered (token 0 for ungrouped requests) from creation until it finishes or
+ * is destroyed, so the registry never holds more than the live nodes. Node sets are sharded by
+ * token behind their own locks; the group tree has a separate reader/writer lock. Thread-safe,
+ * but the returned nodes must only be dereferenced on the game thread.
+ */
+class FQuickHttpCancelRegistry
+{
+public:
+    using FNodeRef = TWeakObjectPtr<UHttpJsonRequestAsync>;
+
+    void Register(int32 Token, UHttpJsonRequestAsync* Node);
+    void Unregister(int32 Token, UHttpJsonRequestAsync* Node);
+
+    /** Make Child a sub-group of Parent. Returns false for token 0 or when the link would form a cycle. */
+    bool LinkGroup(int32 Child, int32 Parent);
+
+    /** Detach Child from its parent group. */
+    void UnlinkGroup(int32 Child);
+
+    /** Absolute deadline (FPlatformTime::Seconds) for Token's group; <= 0 clears it. */
+    void SetDeadline(int32 Token, double DeadlineSeconds);
+
+    /** Deadline set on Token's own group, or 0 when it has none. */
+    double GetDeadline(int32 Token) const;
+
+    /** Remove and return the nodes of Token and all its descendant groups, clearing their deadlines. Links are kept. */
+    TArray<FNodeRef> TakeGroup(int32 Token);
+
+    /** Remove and return every registered node, grouped or not. */
+    TArray<FNodeRef> TakeAll();
+
+    /** Number of registered nodes. */
+    int32 NumNodes() const;
+
+    void Reset();
+
+private:
+    static constexpr int32 NumShards = 16;
+
+    struct FShard
+    {
+        mutable FCriticalSection Lock;
+        TMap<int32, TSet<FNodeRef>> Nodes;
+    };
+
+    FShard& ShardFor(int32 Token) { return Shards[GetTypeHash(Token) % NumShards]; }
+    void CollectGroup(int32 Token, TArray<int32>& OutTokens) const;
+
+    FShard Shards[NumShards];
+
+    mutable FRWLock GroupLock;
+    TMap<int32, int32> Parents;
+    TMultiMap<int32, int32> Children;
+    TMap<int32, double> Deadlines;
+};
@@ -0,0 +1,210 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpCircuitBreaker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+
+void FQuickHttpCircuitBreaker::Configure(bool bInUseBreaker, int32 InWindowSize, float InFailureRatePercent, float InOpenSeconds,
+    bool bInUseRetryBudget, float InRetryBudgetPercent, float InRetryBudgetMaxTokens)
+{
+    bUseBreaker = bInUseBreaker;
+    WindowSize = FMath::Clamp(InWindowSize, 1, 1000);
+    FailureRatePercent = FMath::Clamp(InFailureRatePercent, 1.f, 100.f);
+    OpenSeconds = FMath::Max(0.1f, InOpenSeconds);
+    bUseRetryBudget = bInUseRetryBudget;
+    RetryBudgetPercent = FMath::Clamp(InRetryBudgetPercent, 0.f, 100.f);
+    RetryBudgetMaxTokens = FMath::Max(1.f, InRetryBudgetMaxTokens);
+}
+
+FString FQuickHttpCircuitBreaker::KeyFor(const FString& Host) const
+{
+    return Hosts.Num() < MaxHosts || Hosts.Contains(Host) ? Host : FString(TEXT("*"));
+}
+
+FQuickHttpCircuitBreaker::FHostEntry& FQuickHttpCircuitBreaker::FindOrAddHost(const FString& Key)
+{
+    if (FHostEntry* Existing = Hosts.Find(Key))
+    {
+        return *Existing;
+    }
+    // A new host starts with a full budget so its first failures can be retried
+    FHostEntry& Entry = Hosts.Add(Key);
+    Entry.RetryTokens = RetryBudgetMaxTokens;
+    return Entry;
+}
+
+bool FQuickHttpCircuitBreaker::Allow(const FString& Host)
+{
+    if (!bUseBreaker) { return true; }
+    const FString Key = KeyFor(Host);
+    FHostEntry* Entry = Hosts.Find(Key);
+    if (!Entry || Entry->State == EQuickHttpCircuitState::Closed) { return true; }
+
+    const double Now = FPlatformTime::Seconds();
+    if (Entry->State == EQuickHttpCircuitState::Open)
+    {
+        if (Now < Entry->OpenUntil)
+        {
+            Entry->Rejected++;
+            return false;
+        }
+        SetState(Key, *Entry, EQuickHttpCircuitState::HalfOpen);
+    }
+
+    // Half-open: one probe at a time. The lease runs out on its own, so a probe that never reports back
+    // (cancelled, or its node collected) cannot leave the host stuck.
+    if (Now < Entry->ProbeLeaseUntil)
+    {
+        Entry->Rejected++;
+        return false;
+    }
+    Entry->ProbeLeaseUntil = Now + OpenSeconds;
+    return true;
+}
+
+void FQuickHttpCircuitBreaker::RecordOutcome(const FString& Host, bool bSucceeded, float RetryAfterSeconds)
+{
+    const FString Key = KeyFor(Host);
+    FHostEntry& Entry = FindOrAddHost(Key);
+    if (bSucceeded && bUseRetryBudget)
+    {
+        Entry.RetryTokens = FMath::Min(RetryBudgetMaxTokens, Entry.RetryTokens + RetryBudgetPercent / 100.f);
+    }
+    if (!bUseBreaker) { return; }
+
+    switch (Entry.State)
+    {
+    case EQuickHttpCircuitState::HalfOpen:
+        if (bSucceeded)
+        {
+            SetState(Key, Entry, EQuickHttpCircuitState::Closed);
+        }
+        else
+        {
+            Open(Key, Entry, RetryAfterSeconds);
+        }
+        return;
+
+    case EQuickHttpCircuitState::Open:
+        // Answers to attempts that started before the breaker opened; the probe decides
+        return;
+
+    default:
+        break;
+    }
+
+    const bool bFailed = !bSucceeded;
+    if (Entry.Window.Num() < WindowSize)
+    {
+        Entry.Window.Add(bFailed);
+    }
+    else
+    {
+        Entry.Failures -= Entry.Window[Entry.Next] ? 1 : 0;
+        Entry.Window[Entry.Next] = bFailed;
+        Entry.Next = (Entry.Next + 1) % WindowSize;
+    }
+    Entry.Failures += bFailed ? 1 : 0;
+
+    if (bFailed && Entry.Window.Num() >= WindowSize && Entry.Failures * 100.f >= FailureRatePercent * WindowSize)
+    {
+        Open(Key, Entry, RetryAfterSeconds);
+    }
+}
+
+bool FQuickHttpCircuitBreaker::TryConsumeRetry(const FString& Host)
+{
+    if (!bUseRetryBudget) { return true; }
+    FHostEntry& Entry = FindOrAddHost(KeyFor(Host));
+    if (Entry.RetryTokens < 1.f)
+    {
+        Entry.RetriesDenied++;
+        return false;
+    }
+    Entry.RetryTokens -= 1.f;
+    return true;
+}
+
+void FQuickHttpCircuitBreaker::Open(const FString& Key, FHostEntry& Entry, float RetryAfterSeconds)
+{
+    Entry.OpenUntil = FPlatformTime::Seconds() + FMath::Max(OpenSeconds, RetryAfterSeconds);
+    Entry.ProbeLeaseUntil = 0.0;
+    Entry.Opens++;
+    SetState(Key, Entry, EQuickHttpCircuitState::Open);
+}
+
+void FQuickHttpCircuitBreaker::SetState(const FString& Key, FHostEntry& Entry, EQuickHttpCircuitState NewState)
+{
+    const EQuickHttpCircuitState OldState = Entry.State;
+    Entry.State = NewState;
+    if (NewState == EQuickHttpCircuitState::Closed)
+    {
+        // Start counting afresh; the failures that opened the breaker are history
+        Entry.Window.Reset();
+        Entry.Next = 0;
+        Entry.Failures = 0;
+    }
+    if (OldState != NewState)
+    {
+        StateChanged.Broadcast(Key, OldState, NewState);
+    }
+}
+
+EQuickHttpCircuitState FQuickHttpCircuitBreaker::GetState(const FString& Host) const
+{
+    const FHostEntry* Entry = Hosts.Find(KeyFor(Host));
+    return Entry ? Entry->State : EQuickHttpCircuitState::Closed;
+}
+
+void FQuickHttpCircuitBreaker::GetStatus(TArray<FQuickHttpCircuitStatus>& OutPerHost) const
+{
+    const double Now = FPlatformTime::Seconds();
+    OutPerHost.Reset(Hosts.Num());
+    for (const TPair<FString, FHostEntry>& Pair : Hosts)
+    {
+        const FHostEntry& Entry = Pair.Value;
+        FQuickHttpCircuitStatus& Status = OutPerHost.AddDefaulted_GetRef();
+        Status.Host = Pair.Key;
+        Status.State = Entry.State;
+        Status.FailureRatePercent = Entry.Window.Num() > 0 ? 100.f * Entry.Failures / Entry.Window.Num() : 0.f;
+        Status.SecondsUntilProbe = Entry.State == EQuickHttpCircuitState::Open ? (float)FMath::Max(0.0, Entry.OpenUntil - Now) : 0.f;
+        Status.RetryTokens = Entry.RetryTokens;
+        Status.Opens = Entry.Opens;
+        Status.Rejected = Entry.Rejected;
+        Status.RetriesDenied = Entry.RetriesDenied;
+    }
+}
+
+void FQuickHttpCircuitBreaker::Reset()
+{
+    // Listeners see every breaker that was not closed close
+    TArray<TPair<FString, EQuickHttpCircuitState>> Closing;
+    for (const TPair<FString, FHostEntry>& Pair : Hosts)
+    {
+        if (Pair.Value.State != EQuickHttpCircuitState::Closed)
+        {
+            Closing.Emplace(Pair.Key, Pair.Value.State);
+        }
+    }
+    Hosts.Reset();
+    for (const TPair<FString, EQuickHttpCircuitState>& Host : Closing)
+    {
+        StateChanged.Broadcast(Host.Key, Host.Value, EQuickHttpCircuitState::Closed);
+    }
+}
+
+float FQuickHttpCircuitBreaker::ParseRetryAfter(const FString& Value)
+{
+    const FString Trimmed = Value.TrimStartAndEnd();
+    if (Trimmed.IsEmpty()) { return -1.f; }
+    if (Trimmed.IsNumeric())
+    {
+        return FMath::Max(0.f, FCString::Atof(*Trimmed));
+    }
+    FDateTime When;
+    if (FDateTime::ParseHttpDate(Trimmed, When))
+    {
+        return (float)FMath::Max(0.0, (When - FDateTime::UtcNow()).GetTotalSeconds());
+    }
+    return -1.f;
+}
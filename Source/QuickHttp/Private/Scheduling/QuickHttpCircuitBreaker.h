@@ -0,0 +1,84 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FQuickHttpCircuitStateChanged, const FString& /*Host*/, EQuickHttpCircuitState /*From*/, EQuickHttpCircuitState /*To*/);
+
+/**
+ * Shared per-host failure handling, so a struggling backend sees less traffic from us rather than more.
+ *
+ * Circuit breaker: while closed, the last WindowSize outcomes are kept; once the failure rate over a full
+ * window reaches the threshold the breaker opens and attempts fail locally for OpenSeconds (or a longer
+ * Retry-After). Then it goes half-open and lets one probe through: success closes it, failure opens it again.
+ *
+ * Retry budget: a token bucket per host. Successes earn a fraction of a token, retries spend a whole one,
+ * so retries are bounded by a share of the traffic that works instead of multiplying load during an outage.
+ * Game thread only.
+ */
+class FQuickHttpCircuitBreaker
+{
+public:
+    void Configure(bool bInUseBreaker, int32 InWindowSize, float InFailureRatePercent, float InOpenSeconds,
+        bool bInUseRetryBudget, float InRetryBudgetPercent, float InRetryBudgetMaxTokens);
+
+    /** Whether an attempt to Host may go out now. False while open; while half-open only one probe at a time passes. */
+    bool Allow(const FString& Host);
+
+    /**
+     * Outcome of an attempt that got an answer or failed on the network.
+     * @param RetryAfterSeconds  From a 429/503 Retry-After; keeps a breaker this opens open at least that long. <= 0 if none.
+     */
+    void RecordOutcome(const FString& Host, bool bSucceeded, float RetryAfterSeconds);
+
+    /** Spend one retry token. Returns false when the host's budget is used up. */
+    bool TryConsumeRetry(const FString& Host);
+
+    EQuickHttpCircuitState GetState(const FString& Host) const;
+
+    /** One entry per tracked host. */
+    void GetStatus(TArray<FQuickHttpCircuitStatus>& OutPerHost) const;
+
+    /** Fired whenever a host's breaker changes state. */
+    FQuickHttpCircuitStateChanged& OnStateChanged() { return StateChanged; }
+
+    /** Forget every host: breakers closed, budgets full. */
+    void Reset();
+
+    /** Seconds to wait from a Retry-After value (delta-seconds or HTTP-date); -1 when missing or invalid. */
+    static float ParseRetryAfter(const FString& Value);
+
+private:
+    struct FHostEntry
+    {
+        EQuickHttpCircuitState State = EQuickHttpCircuitState::Closed;
+        TArray<bool> Window;
+        int32 Next = 0;
+        int32 Failures = 0;
+        double OpenUntil = 0.0;
+        double ProbeLeaseUntil = 0.0;
+        float RetryTokens = 0.f;
+        int64 Opens = 0;
+        int64 Rejected = 0;
+        int64 RetriesDenied = 0;
+    };
+
+    FString KeyFor(const FString& Host) const;
+    FHostEntry& FindOrAddHost(const FString& Key);
+    void Open(const FString& Key, FHostEntry& Entry, float RetryAfterSeconds);
+    void SetState(const FString& Key, FHostEntry& Entry, EQuickHttpCircuitState NewState);
+
+    // Hosts beyond this share one "*" entry so the map cannot grow without bound
+    static constexpr int32 MaxHosts = 64;
+
+    TMap<FString, FHostEntry> Hosts;
+    FQuickHttpCircuitStateChanged StateChanged;
+    bool bUseBreaker = true;
+    int32 WindowSize = 20;
+    float FailureRatePercent = 50.f;
+    float OpenSeconds = 10.f;
+    bool bUseRetryBudget = true;
+    float RetryBudgetPercent = 20.f;
+    float RetryBudgetMaxTokens = 10.f;
+};
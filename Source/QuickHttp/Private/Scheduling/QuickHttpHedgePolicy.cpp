@@ -0,0 +1,62 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpHedgePolicy.h"
+
+void FQuickHttpHedgePolicy::Configure(float InBudgetPercent, float InPercentile, float InDefaultDelaySeconds, float InMinDelaySeconds)
+{
+    BudgetPercent = FMath::Clamp(InBudgetPercent, 0.f, 100.f);
+    Percentile = FMath::Clamp(InPercentile, 50.f, 99.9f);
+    MinDelaySeconds = FMath::Max(0.f, InMinDelaySeconds);
+    DefaultDelaySeconds = FMath::Max(MinDelaySeconds, InDefaultDelaySeconds);
+}
+
+FQuickHttpHedgePolicy::FHostEntry& FQuickHttpHedgePolicy::FindOrAddHost(const FString& Host)
+{
+    return Hosts.Num() < MaxHosts || Hosts.Contains(Host) ? Hosts.FindOrAdd(Host) : Hosts.FindOrAdd(TEXT("*"));
+}
+
+float FQuickHttpHedgePolicy::GetHedgeDelay(const FString& Host, float FixedDelaySeconds) const
+{
+    if (FixedDelaySeconds > 0.f) { return FixedDelaySeconds; }
+
+    const FHostEntry* Entry = Hosts.Find(Host);
+    if (!Entry) { Entry = Hosts.Find(TEXT("*")); }
+    if (!Entry || Entry->Window.Num() < MinSamples) { return DefaultDelaySeconds; }
+
+    // At most WindowSize floats; sorting a copy is cheaper than keeping an order statistic up to date
+    TArray<float> Sorted = Entry->Window;
+    Sorted.Sort();
+    const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile / 100.f * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+    return FMath::Max(MinDelaySeconds, Sorted[Index]);
+}
+
+void FQuickHttpHedgePolicy::NoteAttempt(const FString& Host)
+{
+    FHostEntry& Entry = FindOrAddHost(Host);
+    Entry.Tokens = FMath::Min(MaxTokens, Entry.Tokens + BudgetPercent / 100.f);
+}
+
+bool FQuickHttpHedgePolicy::TryConsumeBudget(const FString& Host)
+{
+    FHostEntry& Entry = FindOrAddHost(Host);
+    if (Entry.Tokens < 1.f) { return false; }
+    Entry.Tokens -= 1.f;
+    return true;
+}
+
+void FQuickHttpHedgePolicy::RecordLatency(const FString& Host, double Seconds)
+{
+    FHostEntry& Entry = FindOrAddHost(Host);
+    if (Entry.Window.Num() < WindowSize)
+    {
+        Entry.Window.Add((float)Seconds);
+        return;
+    }
+    Entry.Window[Entry.Next] = (float)Seconds;
+    Entry.Next = (Entry.Next + 1) % WindowSize;
+}
+
+void FQuickHttpHedgePolicy::Reset()
+{
+    Hosts.Reset();
+}
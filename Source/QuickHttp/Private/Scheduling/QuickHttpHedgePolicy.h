@@ -0,0 +1,57 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Per-host state for hedged requests: when to send the hedge and how many may be sent.
+ *
+ * The adaptive delay is a percentile of the host's recent hedged-request latencies (a sliding window,
+ * so it follows the server as it speeds up or slows down). The budget is a token bucket: every hedgeable
+ * attempt adds BudgetPercent/100 of a token and every hedge spends one, so hedges stay at or below that
+ * share of the host's traffic however slow it gets. Game thread only.
+ */
+class FQuickHttpHedgePolicy
+{
+public:
+    void Configure(float InBudgetPercent, float InPercentile, float InDefaultDelaySeconds, float InMinDelaySeconds);
+
+    /** Seconds to wait for a response before hedging. FixedDelaySeconds > 0 is used as is. */
+    float GetHedgeDelay(const FString& Host, float FixedDelaySeconds) const;
+
+    /** An attempt that may be hedged started; earns budget. */
+    void NoteAttempt(const FString& Host);
+
+    /** Spend budget on one hedge. Returns false when the host's budget is used up. */
+    bool TryConsumeBudget(const FString& Host);
+
+    /** Latency of an attempt that got a usable response, from sending the first request to its response. */
+    void RecordLatency(const FString& Host, double Seconds);
+
+    void Reset();
+
+private:
+    struct FHostEntry
+    {
+        TArray<float> Window;
+        int32 Next = 0;
+        // A new host may hedge once straight away
+        float Tokens = 1.f;
+    };
+
+    FHostEntry& FindOrAddHost(const FString& Host);
+
+    // Enough samples for a 95th percentile to mean something, few enough to adapt within a minute of traffic
+    static constexpr int32 WindowSize = 128;
+    static constexpr int32 MinSamples = 20;
+    // Largest burst of hedges a host can save up
+    static constexpr float MaxTokens = 10.f;
+    // Hosts beyond this share one "*" entry so the map cannot grow without bound
+    static constexpr int32 MaxHosts = 64;
+
+    TMap<FString, FHostEntry> Hosts;
+    float BudgetPercent = 10.f;
+    float Percentile = 95.f;
+    float DefaultDelaySeconds = 1.f;
+    float MinDelaySeconds = 0.02f;
+};
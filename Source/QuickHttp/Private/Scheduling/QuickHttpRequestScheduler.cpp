@@ -0,0 +1,131 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpRequestScheduler.h"
+
+void FQuickHttpRequestScheduler::Configure(int32 InMaxPerHost, int32 InMaxGlobal)
+{
+    MaxPerHost = FMath::Max(1, InMaxPerHost);
+    MaxGlobal = FMath::Max(1, InMaxGlobal);
+    Pump();
+}
+
+uint64 FQuickHttpRequestScheduler::Acquire(const FString& Host, EQuickHttpPriority Priority, TFunction<void()> Start)
+{
+    const uint64 Ticket = NextTicket++;
+    const int32 Class = FMath::Clamp((int32)Priority, 0, NumPriorities - 1);
+
+    FPending& Pending = Queues[Class].AddDefaulted_GetRef();
+    Pending.Ticket = Ticket;
+    Pending.Host = Host;
+    Pending.Start = MoveTemp(Start);
+
+    // Going through the queue keeps FIFO order against requests already waiting in this class
+    Pump();
+    return IsQueued(Class, Ticket) ? Ticket : 0;
+}
+
+bool FQuickHttpRequestScheduler::TryAcquire(const FString& Host)
+{
+    if (InFlightGlobal >= MaxGlobal || !HasCapacity(Host) || NumQueued() > 0) { return false; }
+    InFlightPerHost.FindOrAdd(Host)++;
+    ++InFlightGlobal;
+    return true;
+}
+
+void FQuickHttpRequestScheduler::Release(const FString& Host)
+{
+    if (int32* Count = InFlightPerHost.Find(Host))
+    {
+        if (--(*Count) <= 0) { InFlightPerHost.Remove(Host); }
+    }
+    InFlightGlobal = FMath::Max(0, InFlightGlobal - 1);
+    Pump();
+}
+
+bool FQuickHttpRequestScheduler::Cancel(uint64 Ticket)
+{
+    for (TArray<FPending>& Queue : Queues)
+    {
+        const int32 Index = Queue.IndexOfByPredicate([Ticket](const FPending& P) { return P.Ticket == Ticket; });
+        if (Index != INDEX_NONE)
+        {
+            Queue.RemoveAt(Index);
+            return true;
+        }
+    }
+    return false;
+}
+
+int32 FQuickHttpRequestScheduler::NumQueued() const
+{
+    int32 Total = 0;
+    for (const TArray<FPending>& Queue : Queues) { Total += Queue.Num(); }
+    return Total;
+}
+
+void FQuickHttpRequestScheduler::Reset()
+{
+    for (TArray<FPending>& Queue : Queues) { Queue.Reset(); }
+    InFlightPerHost.Reset();
+    InFlightGlobal = 0;
+}
+
+bool FQuickHttpRequestScheduler::HasCapacity(const FString& Host) const
+{
+    const int32* Count = InFlightPerHost.Find(Host);
+    return !Count || *Count < MaxPerHost;
+}
+
+bool FQuickHttpRequestScheduler::IsQueued(int32 Class, uint64 Ticket) const
+{
+    // Newest tickets sit at the back of their class
+    const TArray<FPending>& Queue = Queues[Class];
+    for (int32 i = Queue.Num() - 1; i >= 0; --i)
+    {
+        if (Queue[i].Ticket == Ticket) { return true; }
+    }
+    return false;
+}
+
+void FQuickHttpRequestScheduler::Pump()
+{
+    // A started request may release or acquire synchronously; fold that into the running pump
+    if (bPumping)
+    {
+        bPumpAgain = true;
+        return;
+    }
+    bPumping = true;
+
+    do
+    {
+        bPumpAgain = false;
+        while (InFlightGlobal < MaxGlobal)
+        {
+            FPending Next;
+            bool bFound = false;
+            for (int32 Class = 0; Class < NumPriorities && !bFound; ++Class)
+            {
+                TArray<FPending>& Queue = Queues[Class];
+                for (int32 i = 0; i < Queue.Num(); ++i)
+                {
+                    if (HasCapacity(Queue[i].Host))
+                    {
+                        Next = MoveTemp(Queue[i]);
+                        Queue.RemoveAt(i);
+                        bFound = true;
+                        break;
+                    }
+                }
+            }
+            if (!bFound) { break; }
+
+            InFlightPerHost.FindOrAdd(Next.Host)++;
+            ++InFlightGlobal;
+            if (Next.Start) { Next.Start(); }
+        }
+    }
+    while (bPumpAgain);
+
+    bPumping = false;
+}
@@ -0,0 +1,64 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+/**
+ * Admission control in front of the HTTP module.
+ *
+ * A request starts immediately while its host and the global limit have room; otherwise it waits
+ * in one FIFO per priority class. Freed slots go to the highest class first, skipping requests
+ * whose host is still saturated. Game thread only.
+ */
+class FQuickHttpRequestScheduler
+{
+public:
+    void Configure(int32 InMaxPerHost, int32 InMaxGlobal);
+
+    /**
+     * Run Start as soon as Host has a free slot. Start may run before this returns.
+     * @return Ticket for Cancel while the request is still queued; 0 if Start already ran.
+     */
+    uint64 Acquire(const FString& Host, EQuickHttpPriority Priority, TFunction<void()> Start);
+
+    /**
+     * Take a slot for Host only if one is free right now and nobody is waiting for one; never queues.
+     * Used for optional extra traffic (hedges) that must not delay regular requests. Release it as usual.
+     */
+    bool TryAcquire(const FString& Host);
+
+    /** Return the slot held by a started request and start whatever is eligible next. */
+    void Release(const FString& Host);
+
+    /** Remove a request that has not started yet. Returns false if Ticket is unknown or already started. */
+    bool Cancel(uint64 Ticket);
+
+    int32 NumQueued() const;
+    int32 NumInFlight() const { return InFlightGlobal; }
+
+    void Reset();
+
+private:
+    static constexpr int32 NumPriorities = (int32)EQuickHttpPriority::Background + 1;
+
+    struct FPending
+    {
+        uint64 Ticket = 0;
+        FString Host;
+        TFunction<void()> Start;
+    };
+
+    bool HasCapacity(const FString& Host) const;
+    bool IsQueued(int32 Class, uint64 Ticket) const;
+    void Pump();
+
+    TArray<FPending> Queues[NumPriorities];
+    TMap<FString, int32> InFlightPerHost;
+    int32 InFlightGlobal = 0;
+    int32 MaxPerHost = 6;
+    int32 MaxGlobal = 32;
+    uint64 NextTicket = 1;
+    bool bPumping = false;
+    bool bPumpAgain = false;
+};
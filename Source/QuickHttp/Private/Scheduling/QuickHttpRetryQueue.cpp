@@ -0,0 +1,59 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpRetryQueue.h"
+#include "QuickHttpSettings.h"
+#include "HAL/PlatformTime.h"
+
+FQuickHttpRetryQueue::FQuickHttpRetryQueue(int32 InMaxPending)
+    : MaxPending(FMath::Max(1, InMaxPending))
+{
+}
+
+bool FQuickHttpRetryQueue::Enqueue(double DelaySeconds, TFunction<void()> Callback)
+{
+    if (Heap.Num() >= MaxPending) { return false; }
+
+    FEntry Entry;
+    Entry.DueSeconds = FPlatformTime::Seconds() + FMath::Max(0.0, DelaySeconds);
+    Entry.Sequence = NextSequence++;
+    Entry.Callback = MoveTemp(Callback);
+    Heap.HeapPush(MoveTemp(Entry), FEntryPredicate());
+    return true;
+}
+
+void FQuickHttpRetryQueue::Tick(double NowSeconds)
+{
+    // Retries queued by the callbacks below wait for the next tick
+    const uint64 SequenceLimit = NextSequence;
+    while (Heap.Num() > 0 && Heap.HeapTop().DueSeconds <= NowSeconds && Heap.HeapTop().Sequence < SequenceLimit)
+    {
+        FEntry Entry;
+        Heap.HeapPop(Entry, FEntryPredicate());
+        if (Entry.Callback) { Entry.Callback(); }
+    }
+}
+
+void FQuickHttpRetryQueue::Reset()
+{
+    Heap.Reset();
+}
+
+float FQuickHttpRetryQueue::DecorrelatedJitter(float BaseSeconds, float PreviousSeconds, float CapSeconds)
+{
+    const float Base = FMath::Max(0.0f, BaseSeconds);
+    const float Upper = FMath::Max(Base, PreviousSeconds * 3.f);
+    return FMath::Min(FMath::Max(Base, CapSeconds), FMath::FRandRange(Base, Upper));
+}
+
+float FQuickHttpRetryQueue::ComputeBackoffSeconds(float BaseSeconds, int32 Index, float PreviousSeconds)
+{
+    const UQuickHttpSettings* Settings = GetDefault<UQuickHttpSettings>();
+    if (Settings->bUseDecorrelatedJitter)
+    {
+        return DecorrelatedJitter(BaseSeconds, Index > 0 ? PreviousSeconds : 0.f, Settings->MaxBackoffSeconds);
+    }
+
+    const float Exp = FMath::Pow(2.f, FMath::Clamp(Index, 0, 10));
+    const float Jitter = FMath::FRandRange(0.f, 0.25f);
+    return (BaseSeconds * Exp) + Jitter;
+}
@@ -0,0 +1,51 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpSingleFlight.h"
+#include "Async/HttpJsonRequestAsync.h"
+
+bool FQuickHttpSingleFlight::JoinOrLead(const FString& Key, UHttpJsonRequestAsync* Node)
+{
+    if (FFlight* Flight = Flights.Find(Key))
+    {
+        Flight->Followers.Add(Node);
+        return false;
+    }
+
+    FFlight& Flight = Flights.Add(Key);
+    Flight.Leader = Node;
+    return true;
+}
+
+UHttpJsonRequestAsync* FQuickHttpSingleFlight::RemoveFollower(const FString& Key, UHttpJsonRequestAsync* Node)
+{
+    FFlight* Flight = Flights.Find(Key);
+    if (!Flight) { return nullptr; }
+
+    Flight->Followers.Remove(Node);
+    return Flight->Leader;
+}
+
+TArray<UHttpJsonRequestAsync*> FQuickHttpSingleFlight::Complete(const FString& Key)
+{
+    FFlight Flight;
+    if (Flights.RemoveAndCopyValue(Key, Flight))
+    {
+        return MoveTemp(Flight.Followers);
+    }
+    return TArray<UHttpJsonRequestAsync*>();
+}
+
+int32 FQuickHttpSingleFlight::NumFollowers(const FString& Key) const
+{
+    const FFlight* Flight = Flights.Find(Key);
+    return Flight ? Flight->Followers.Num() : 0;
+}
+
+void FQuickHttpSingleFlight::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (TPair<FString, FFlight>& Pair : Flights)
+    {
+        Collector.AddReferencedObject(Pair.Value.Leader);
+        Collector.AddReferencedObjects(Pair.Value.Followers);
+    }
+}
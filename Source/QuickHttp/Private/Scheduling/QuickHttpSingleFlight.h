@@ -0,0 +1,48 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+class UHttpJsonRequestAsync;
+
+/**
+ * Registry of coalesced in-flight GETs keyed by request identity.
+ *
+ * The first node for a key leads and owns the network request; later identical nodes follow and
+ * receive the leader's result. Keeps every participating node alive until the flight completes.
+ * Game thread only.
+ */
+class FQuickHttpSingleFlight : public FGCObject
+{
+public:
+    /** Returns true when Node became the leader for Key, false when it was queued behind the current leader. */
+    bool JoinOrLead(const FString& Key, UHttpJsonRequestAsync* Node);
+
+    /** Remove a follower from Key's flight. Returns the flight leader, or nullptr if the flight is gone. */
+    UHttpJsonRequestAsync* RemoveFollower(const FString& Key, UHttpJsonRequestAsync* Node);
+
+    /** End Key's flight and return the followers that are still waiting for its result. */
+    TArray<UHttpJsonRequestAsync*> Complete(const FString& Key);
+
+    /** Followers currently waiting on Key. */
+    int32 NumFollowers(const FString& Key) const;
+
+    /** Number of shared requests in flight. */
+    int32 Num() const { return Flights.Num(); }
+
+    void Reset() { Flights.Reset(); }
+
+    // FGCObject
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+    virtual FString GetReferencerName() const override { return TEXT("FQuickHttpSingleFlight"); }
+
+private:
+    struct FFlight
+    {
+        UHttpJsonRequestAsync* Leader = nullptr;
+        TArray<UHttpJsonRequestAsync*> Followers;
+    };
+
+    TMap<FString, FFlight> Flights;
+};
@@ -0,0 +1,168 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Scheduling/QuickHttpTimerWheel.h"
+
+FQuickHttpTimerWheel::FQuickHttpTimerWheel(double InTickSeconds)
+    : TickSeconds(FMath::Max(0.001, InTickSeconds))
+{
+    for (int32 i = 0; i < NumBuckets; ++i) { Buckets[i] = INDEX_NONE; }
+}
+
+FQuickHttpTimerHandle FQuickHttpTimerWheel::Schedule(double DelaySeconds, TFunction<void()> Callback)
+{
+    // Never land in the bucket that is currently being expired
+    const uint64 DelayTicks = FMath::Clamp<uint64>((uint64)FMath::CeilToDouble(FMath::Max(0.0, DelaySeconds) / TickSeconds), 1, MaxDelayTicks);
+
+    const int32 Index = AllocEntry();
+    FEntry& E = Entries[Index];
+    E.Callback = MoveTemp(Callback);
+    E.ExpiryTick = CurrentTick + DelayTicks;
+    Link(Index);
+    ++NumActive;
+
+    FQuickHttpTimerHandle Handle;
+    Handle.Index = Index;
+    Handle.Serial = E.Serial;
+    return Handle;
+}
+
+bool FQuickHttpTimerWheel::Cancel(FQuickHttpTimerHandle& Handle)
+{
+    const FQuickHttpTimerHandle Local = Handle;
+    Handle.Invalidate();
+    if (!Entries.IsValidIndex(Local.Index)) { return false; }
+
+    FEntry& E = Entries[Local.Index];
+    if (E.Serial != Local.Serial || E.Bucket == INDEX_NONE) { return false; }
+
+    Unlink(Local.Index);
+    FreeEntry(Local.Index);
+    --NumActive;
+    return true;
+}
+
+void FQuickHttpTimerWheel::Advance(double DeltaSeconds)
+{
+    if (NumActive == 0)
+    {
+        // Ticks are relative to CurrentTick, so an empty wheel can simply stand still
+        Accumulator = 0.0;
+        return;
+    }
+
+    Accumulator += FMath::Max(0.0, DeltaSeconds);
+    while (Accumulator >= TickSeconds && NumActive > 0)
+    {
+        Accumulator -= TickSeconds;
+        ProcessTick();
+    }
+}
+
+void FQuickHttpTimerWheel::Reset()
+{
+    for (int32 i = 0; i < NumBuckets; ++i) { Buckets[i] = INDEX_NONE; }
+    Entries.Reset();
+    FreeList.Reset();
+    NumActive = 0;
+    Accumulator = 0.0;
+}
+
+int32 FQuickHttpTimerWheel::BucketFor(uint64 ExpiryTick) const
+{
+    const uint64 Delta = ExpiryTick - CurrentTick;
+    if (Delta < (uint64)RootSize)
+    {
+        return (int32)(ExpiryTick & (RootSize - 1));
+    }
+
+    for (int32 Level = 0; Level < NumUpperLevels; ++Level)
+    {
+        const int32 Shift = RootBits + Level * LevelBits;
+        if (Delta < (uint64(1) << (Shift + LevelBits)) || Level == NumUpperLevels - 1)
+        {
+            return RootSize + Level * LevelSize + (int32)((ExpiryTick >> Shift) & (LevelSize - 1));
+        }
+    }
+    return INDEX_NONE;
+}
+
+void FQuickHttpTimerWheel::Link(int32 Index)
+{
+    FEntry& E = Entries[Index];
+    E.Bucket = BucketFor(E.ExpiryTick);
+    E.Prev = INDEX_NONE;
+    E.Next = Buckets[E.Bucket];
+    if (E.Next != INDEX_NONE) { Entries[E.Next].Prev = Index; }
+    Buckets[E.Bucket] = Index;
+}
+
+void FQuickHttpTimerWheel::Unlink(int32 Index)
+{
+    FEntry& E = Entries[Index];
+    if (E.Prev != INDEX_NONE) { Entries[E.Prev].Next = E.Next; }
+    else { Buckets[E.Bucket] = E.Next; }
+    if (E.Next != INDEX_NONE) { Entries[E.Next].Prev = E.Prev; }
+    E.Prev = INDEX_NONE;
+    E.Next = INDEX_NONE;
+    E.Bucket = INDEX_NONE;
+}
+
+int32 FQuickHttpTimerWheel::AllocEntry()
+{
+    if (FreeList.Num() > 0)
+    {
+        return FreeList.Pop();
+    }
+    return Entries.AddDefaulted();
+}
+
+void FQuickHttpTimerWheel::FreeEntry(int32 Index)
+{
+    FEntry& E = Entries[Index];
+    E.Callback = nullptr;
+    ++E.Serial;
+    FreeList.Add(Index);
+}
+
+void FQuickHttpTimerWheel::Cascade(int32 Level)
+{
+    const int32 Shift = RootBits + Level * LevelBits;
+    const int32 Bucket = RootSize + Level * LevelSize + (int32)((CurrentTick >> Shift) & (LevelSize - 1));
+
+    int32 Index = Buckets[Bucket];
+    Buckets[Bucket] = INDEX_NONE;
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Entries[Index].Next;
+        Link(Index);
+        Index = Next;
+    }
+}
+
+void FQuickHttpTimerWheel::ProcessTick()
+{
+    const int32 RootIndex = (int32)(CurrentTick & (RootSize - 1));
+    if (RootIndex == 0)
+    {
+        // Pull the next block of each level down once the level below wraps
+        for (int32 Level = 0; Level < NumUpperLevels; ++Level)
+        {
+            Cascade(Level);
+            const int32 Shift = RootBits + Level * LevelBits;
+            if (((CurrentTick >> Shift) & (LevelSize - 1)) != 0) { break; }
+        }
+    }
+
+    // Callbacks may schedule or cancel timers; new ones always land in a later bucket
+    while (Buckets[RootIndex] != INDEX_NONE)
+    {
+        const int32 Index = Buckets[RootIndex];
+        Unlink(Index);
+        TFunction<void()> Callback = MoveTemp(Entries[Index].Callback);
+        FreeEntry(Index);
+        --NumActive;
+        if (Callback) { Callback(); }
+    }
+
+    ++CurrentTick;
+}
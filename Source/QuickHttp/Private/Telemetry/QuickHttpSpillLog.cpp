@@ -0,0 +1,265 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Telemetry/QuickHttpSpillLog.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+static constexpr uint32 QuickHttpSpillMagic = 0x314C5451; // "QTL1"
+
+// Magic, event count, body size, format
+static constexpr int64 QuickHttpSpillHeaderBytes = 4 + 4 + 4 + 1;
+
+FQuickHttpSpillLog::FQuickHttpSpillLog(const FString& InPath, int64 InMaxBytes)
+    : Path(InPath)
+    , CursorPath(InPath + TEXT(".cursor"))
+    , MaxBytes(FMath::Max<int64>(1, InMaxBytes))
+{
+}
+
+void FQuickHttpSpillLog::SetMaxBytes(int64 InMaxBytes)
+{
+    FScopeLock ScopeLock(&Lock);
+    MaxBytes = FMath::Max<int64>(1, InMaxBytes);
+}
+
+void FQuickHttpSpillLog::Open()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!bOpened) { OpenLocked(); }
+}
+
+void FQuickHttpSpillLog::OpenLocked()
+{
+    bOpened = true;
+    bCursorDirty = false;
+    Records.Reset();
+    Head = 0;
+    FileSize = 0;
+
+    IFileManager& FileManager = IFileManager::Get();
+    const int64 ActualSize = FileManager.FileSize(*Path);
+    if (ActualSize <= 0)
+    {
+        FileManager.Delete(*CursorPath, false, false, true);
+        UpdateCountersLocked();
+        return;
+    }
+
+    // Records before the cursor were delivered by an earlier session
+    int64 Offset = 0;
+    FString CursorText;
+    if (FFileHelper::LoadFileToString(CursorText, *CursorPath))
+    {
+        Offset = FCString::Atoi64(*CursorText);
+        if (Offset < 0 || Offset > ActualSize) { Offset = 0; }
+    }
+
+    TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*Path, FILEREAD_Silent));
+    if (Reader.IsValid())
+    {
+        while (Offset + QuickHttpSpillHeaderBytes <= ActualSize)
+        {
+            uint32 Magic = 0;
+            FRecord Record;
+            Reader->Seek(Offset);
+            *Reader << Magic << Record.NumEvents << Record.Size << Record.Format;
+            if (Reader->IsError() || Magic != QuickHttpSpillMagic || Record.Size < 0 || Record.NumEvents < 0
+                || Offset + QuickHttpSpillHeaderBytes + Record.Size > ActualSize)
+            {
+                break;
+            }
+            Record.Offset = Offset;
+            Records.Add(Record);
+            Offset += QuickHttpSpillHeaderBytes + Record.Size;
+        }
+    }
+    FileSize = Records.Num() > 0 ? Offset : 0;
+    Reader.Reset();
+
+    if (Records.Num() == 0)
+    {
+        FileManager.Delete(*Path, false, false, true);
+        FileManager.Delete(*CursorPath, false, false, true);
+    }
+    else if (FileSize != ActualSize)
+    {
+        // Cut off the torn tail so new records are appended right after the last good one
+        CompactLocked();
+    }
+    UpdateCountersLocked();
+}
+
+bool FQuickHttpSpillLog::Append(const TArray<uint8>& Body, int32 NumEvents, uint8 Format)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!bOpened) { OpenLocked(); }
+    SaveCursorLocked();
+
+    const int64 RecordBytes = QuickHttpSpillHeaderBytes + Body.Num();
+    const int64 LiveStart = Head < Records.Num() ? Records[Head].Offset : FileSize;
+    IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+    TUniquePtr<FArchive> Writer;
+    if (FileSize - LiveStart + RecordBytes <= MaxBytes && (FileSize + RecordBytes <= MaxBytes || CompactLocked()))
+    {
+        Writer.Reset(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append | FILEWRITE_Silent));
+    }
+    if (!Writer.IsValid())
+    {
+        DroppedEvents.Add(NumEvents);
+        return false;
+    }
+
+    uint32 Magic = QuickHttpSpillMagic;
+    int32 Size = Body.Num();
+    *Writer << Magic << NumEvents << Size << Format;
+    Writer->Serialize(const_cast<uint8*>(Body.GetData()), Size);
+    if (!Writer->Close())
+    {
+        // Whatever part was written is cut off when the log is scanned again
+        bOpened = false;
+        DroppedEvents.Add(NumEvents);
+        return false;
+    }
+
+    FRecord Record;
+    Record.Offset = FileSize;
+    Record.Size = Size;
+    Record.NumEvents = NumEvents;
+    Record.Format = Format;
+    Records.Add(Record);
+    FileSize += RecordBytes;
+    UpdateCountersLocked();
+    return true;
+}
+
+bool FQuickHttpSpillLog::Peek(TArray<uint8>& OutBody, int32& OutNumEvents, uint8& OutFormat)
+{
+    FScopeLock ScopeLock(&Lock);
+    if (!bOpened) { OpenLocked(); }
+    SaveCursorLocked();
+    if (Head >= Records.Num()) { return false; }
+
+    const FRecord& Record = Records[Head];
+    TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path, FILEREAD_Silent));
+    if (Reader.IsValid())
+    {
+        OutBody.SetNumUninitialized(Record.Size);
+        Reader->Seek(Record.Offset + QuickHttpSpillHeaderBytes);
+        Reader->Serialize(OutBody.GetData(), Record.Size);
+        if (!Reader->IsError())
+        {
+            OutNumEvents = Record.NumEvents;
+            OutFormat = Record.Format;
+            return true;
+        }
+    }
+
+    // An unreadable record would block the log forever; skip it
+    ++Head;
+    bCursorDirty = true;
+    UpdateCountersLocked();
+    return false;
+}
+
+void FQuickHttpSpillLog::Pop()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (Head >= Records.Num()) { return; }
+    ++Head;
+    bCursorDirty = true;
+    UpdateCountersLocked();
+}
+
+void FQuickHttpSpillLog::Close()
+{
+    FScopeLock ScopeLock(&Lock);
+    if (bOpened)
+    {
+        SaveCursorLocked();
+    }
+}
+
+void FQuickHttpSpillLog::SaveCursorLocked()
+{
+    if (!bCursorDirty) { return; }
+    bCursorDirty = false;
+
+    IFileManager& FileManager = IFileManager::Get();
+    if (Head >= Records.Num())
+    {
+        FileManager.Delete(*Path, false, false, true);
+        FileManager.Delete(*CursorPath, false, false, true);
+        Records.Reset();
+        Head = 0;
+        FileSize = 0;
+        return;
+    }
+    FFileHelper::SaveStringToFile(FString::Printf(TEXT("%lld"), Records[Head].Offset), *CursorPath);
+}
+
+bool FQuickHttpSpillLog::CompactLocked()
+{
+    IFileManager& FileManager = IFileManager::Get();
+    const int64 Start = Head < Records.Num() ? Records[Head].Offset : FileSize;
+    const int64 LiveBytes = FileSize - Start;
+    const FString TempPath = Path + TEXT(".tmp");
+
+    bool bCopied = LiveBytes > 0;
+    if (bCopied)
+    {
+        TUniquePtr<FArchive> Reader(FileManager.CreateFileReader(*Path, FILEREAD_Silent));
+        TUniquePtr<FArchive> Writer(FileManager.CreateFileWriter(*TempPath, FILEWRITE_Silent));
+        bCopied = Reader.IsValid() && Writer.IsValid();
+        if (bCopied)
+        {
+            TArray<uint8> Chunk;
+            Chunk.SetNumUninitialized((int32)FMath::Min<int64>(LiveBytes, 256 * 1024));
+            Reader->Seek(Start);
+            for (int64 Remaining = LiveBytes; Remaining > 0 && bCopied;)
+            {
+                const int32 Step = (int32)FMath::Min<int64>(Remaining, Chunk.Num());
+                Reader->Serialize(Chunk.GetData(), Step);
+                Writer->Serialize(Chunk.GetData(), Step);
+                bCopied = !Reader->IsError() && !Writer->IsError();
+                Remaining -= Step;
+            }
+            bCopied = Writer->Close() && bCopied;
+        }
+        bCopied = bCopied && FileManager.Move(*Path, *TempPath, true, true, false, true);
+        if (!bCopied)
+        {
+            FileManager.Delete(*TempPath, false, false, true);
+            return false;
+        }
+    }
+    else
+    {
+        FileManager.Delete(*Path, false, false, true);
+    }
+    FileManager.Delete(*CursorPath, false, false, true);
+
+    Records.RemoveAt(0, Head);
+    for (FRecord& Record : Records)
+    {
+        Record.Offset -= Start;
+    }
+    Head = 0;
+    FileSize = LiveBytes;
+    bCursorDirty = false;
+    return true;
+}
+
+void FQuickHttpSpillLog::UpdateCountersLocked()
+{
+    int32 NumEvents = 0;
+    for (int32 Index = Head; Index < Records.Num(); ++Index)
+    {
+        NumEvents += Records[Index].NumEvents;
+    }
+    const int64 LiveStart = Head < Records.Num() ? Records[Head].Offset : FileSize;
+    Batches.Set(Records.Num() - Head);
+    Events.Set(NumEvents);
+    Bytes.Set(FileSize - LiveStart);
+}
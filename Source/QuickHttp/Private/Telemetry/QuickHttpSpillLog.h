@@ -0,0 +1,78 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+/**
+ * Bounded append-only log of unsent telemetry batches, replayed oldest first.
+ *
+ * Records are appended to one file and never rewritten in place; delivered records are skipped by a
+ * read cursor kept in a small side file, so a crash re-sends at most the batch that was in flight.
+ * The file is compacted when the dead prefix gets in the way of the budget, and removed once drained.
+ * A torn record at the end (crash while appending) is cut off when the log is opened.
+ *
+ * Thread-safe; every call that touches the disk blocks, so call them from a worker. The counters can be
+ * read from any thread without waiting for disk work.
+ */
+class FQuickHttpSpillLog
+{
+public:
+    FQuickHttpSpillLog(const FString& InPath, int64 InMaxBytes);
+
+    /** Scan a log left by an earlier session, if not done yet. */
+    void Open();
+
+    /** Append one batch. False, with nothing written, when it does not fit in the budget. */
+    bool Append(const TArray<uint8>& Body, int32 NumEvents, uint8 Format);
+
+    /** Read the oldest batch without removing it. */
+    bool Peek(TArray<uint8>& OutBody, int32& OutNumEvents, uint8& OutFormat);
+
+    /** Drop the oldest batch after it was delivered. Only touches memory; the cursor is saved by the next disk call or Close. */
+    void Pop();
+
+    /** Save the read cursor (or remove the drained log) so the next session starts where this one stopped. */
+    void Close();
+
+    void SetMaxBytes(int64 InMaxBytes);
+
+    int32 NumBatches() const { return Batches.GetValue(); }
+    int32 NumEvents() const { return Events.GetValue(); }
+    int64 NumBytes() const { return Bytes.GetValue(); }
+
+    /** Events of batches that did not fit in the budget. */
+    int64 NumDroppedEvents() const { return DroppedEvents.GetValue(); }
+
+private:
+    struct FRecord
+    {
+        int64 Offset = 0;
+        int32 Size = 0;
+        int32 NumEvents = 0;
+        uint8 Format = 0;
+    };
+
+    void OpenLocked();
+    void SaveCursorLocked();
+    bool CompactLocked();
+    void UpdateCountersLocked();
+
+    FCriticalSection Lock;
+    FString Path;
+    FString CursorPath;
+    int64 MaxBytes = 0;
+
+    // Records[Head..] are still to be sent; FileSize is where the next record goes
+    TArray<FRecord> Records;
+    int32 Head = 0;
+    int64 FileSize = 0;
+    bool bOpened = false;
+    bool bCursorDirty = false;
+
+    FThreadSafeCounter Batches;
+    FThreadSafeCounter Events;
+    FThreadSafeCounter64 Bytes;
+    FThreadSafeCounter64 DroppedEvents;
+};
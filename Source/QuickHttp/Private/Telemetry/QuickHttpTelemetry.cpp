@@ -0,0 +1,488 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "Telemetry/QuickHttpTelemetry.h"
+#include "Telemetry/QuickHttpSpillLog.h"
+#include "QuickHttpModule.h"
+#include "Async/HttpJsonRequestAsync.h"
+#include "Json/QuickJsonReformatter.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+namespace QuickHttpTelemetry
+{
+    static FString GetSpillPath(FName Channel)
+    {
+        return FPaths::ProjectSavedDir() / TEXT("QuickHttp") / TEXT("Telemetry") / (FPaths::MakeValidFileName(Channel.ToString()) + TEXT(".qtl"));
+    }
+
+    /** The endpoint understood the batch and refused it; sending it again cannot help. */
+    static bool IsRejected(int32 StatusCode)
+    {
+        return StatusCode >= 400 && StatusCode < 500 && StatusCode != 408 && StatusCode != 429;
+    }
+}
+
+bool FQuickHttpTelemetry::Configure(FName Name, const FQuickHttpTelemetryConfig& InConfig)
+{
+    FQuickHttpTelemetryConfig Config = InConfig;
+    Config.MaxBatchEvents = FMath::Max(1, Config.MaxBatchEvents);
+    Config.MaxBatchKB = FMath::Max(1, Config.MaxBatchKB);
+    Config.MaxQueuedKB = FMath::Max(1, Config.MaxQueuedKB);
+    Config.MaxSpillMB = FMath::Max(1, Config.MaxSpillMB);
+    Config.OfflineRetrySeconds = FMath::Max(1.f, Config.OfflineRetrySeconds);
+    if (Config.Url.IsEmpty())
+    {
+        UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp telemetry channel %s has no URL"), *Name.ToString());
+        return false;
+    }
+
+    TUniquePtr<FChannel>* Found = Channels.Find(Name);
+    if (!Found)
+    {
+        TUniquePtr<FChannel>& Created = Channels.Add(Name, MakeUnique<FChannel>());
+        FChannel& Channel = *Created;
+        Channel.Name = Name;
+        Channel.Config = Config;
+        Channel.Stats.Channel = Name;
+        Channel.RateWindowStartSeconds = FPlatformTime::Seconds();
+
+        // Batches spilled by an earlier session are replayed even when this one does not spill
+        Channel.Spill = MakeShared<FQuickHttpSpillLog, ESPMode::ThreadSafe>(QuickHttpTelemetry::GetSpillPath(Name), (int64)Config.MaxSpillMB * 1024 * 1024);
+        FSpillLogPtr Log = Channel.Spill;
+        Channel.DiskTasks.Add(Async(EAsyncExecution::ThreadPool, [Log]() { Log->Open(); }));
+        return true;
+    }
+
+    FChannel& Channel = **Found;
+    if (Channel.Config.Format != Config.Format)
+    {
+        // The open batch is framed for the old format
+        Seal(Channel);
+    }
+    Channel.Config = Config;
+    Channel.Spill->SetMaxBytes((int64)Config.MaxSpillMB * 1024 * 1024);
+    ShedReady(Channel);
+    return true;
+}
+
+bool FQuickHttpTelemetry::Record(FName Name, TArrayView<const uint8> EventJson)
+{
+    TUniquePtr<FChannel>* Found = Channels.Find(Name);
+    if (!Found || EventJson.Num() == 0) { return false; }
+    FChannel& Channel = **Found;
+    const FQuickHttpTelemetryConfig& Config = Channel.Config;
+    const bool bArray = Config.Format == EQuickHttpBatchFormat::JsonArray;
+
+    // Keep batches under the size limit; a single larger event still goes out on its own
+    const int32 MaxBytes = Config.MaxBatchKB * 1024;
+    if (Channel.PendingEvents > 0 && Channel.Pending.Num() + EventJson.Num() + 2 > MaxBytes)
+    {
+        Seal(Channel);
+    }
+
+    if (Channel.PendingEvents == 0)
+    {
+        Channel.Pending.Reset(FMath::Min(MaxBytes, 64 * 1024) + 2);
+        Channel.PendingSinceSeconds = FPlatformTime::Seconds();
+        if (bArray) { Channel.Pending.Add('['); }
+    }
+    else if (bArray)
+    {
+        Channel.Pending.Add(',');
+    }
+    Channel.Pending.Append(EventJson.GetData(), EventJson.Num());
+    if (!bArray) { Channel.Pending.Add('\n'); }
+    ++Channel.PendingEvents;
+
+    if (Channel.PendingEvents >= Config.MaxBatchEvents || Channel.Pending.Num() >= MaxBytes)
+    {
+        Seal(Channel);
+    }
+    return true;
+}
+
+bool FQuickHttpTelemetry::RecordString(FName Name, const FString& EventJson)
+{
+    TUniquePtr<FChannel>* Found = Channels.Find(Name);
+    if (!Found) { return false; }
+
+    // Minified so an event never spans NDJSON lines
+    FTCHARToUTF8 Utf8(*EventJson);
+    TArray<uint8> Minified;
+    if (!FQuickJsonReformatter::ReformatUtf8(TArrayView<const uint8>((const uint8*)Utf8.Get(), Utf8.Length()), EQuickJsonFormat::Minify, Minified))
+    {
+        (*Found)->Stats.EventsDropped++;
+        return false;
+    }
+    return Record(Name, Minified);
+}
+
+void FQuickHttpTelemetry::Flush(FName Name)
+{
+    const double Now = FPlatformTime::Seconds();
+    for (TPair<FName, TUniquePtr<FChannel>>& Pair : Channels)
+    {
+        if (Name != NAME_None && Pair.Key != Name) { continue; }
+        Seal(*Pair.Value);
+        Pump(*Pair.Value, Now);
+    }
+}
+
+void FQuickHttpTelemetry::Seal(FChannel& Channel)
+{
+    if (Channel.PendingEvents == 0) { return; }
+
+    FBatch Batch;
+    Batch.Format = Channel.Config.Format;
+    Batch.NumEvents = Channel.PendingEvents;
+    Batch.Body = MoveTemp(Channel.Pending);
+    if (Batch.Format == EQuickHttpBatchFormat::JsonArray) { Batch.Body.Add(']'); }
+    Channel.Pending.Reset();
+    Channel.PendingEvents = 0;
+    Enqueue(Channel, MoveTemp(Batch));
+}
+
+void FQuickHttpTelemetry::Enqueue(FChannel& Channel, FBatch&& Batch)
+{
+    Channel.ReadyBytes += Batch.Body.Num();
+    Channel.Ready.Add(MoveTemp(Batch));
+
+    // While offline, batches go straight to disk instead of piling up in memory
+    if (Channel.bOffline && Channel.Config.bSpillToDisk)
+    {
+        SpillReady(Channel);
+        return;
+    }
+    ShedReady(Channel);
+}
+
+void FQuickHttpTelemetry::ShedReady(FChannel& Channel)
+{
+    const int64 MaxBytes = (int64)Channel.Config.MaxQueuedKB * 1024;
+    if (Channel.ReadyBytes <= MaxBytes || Channel.Ready.Num() <= 1) { return; }
+    if (Channel.Config.bSpillToDisk)
+    {
+        SpillReady(Channel);
+        return;
+    }
+
+    // Drop the oldest batches, but never the one just sealed
+    while (Channel.ReadyBytes > MaxBytes && Channel.Ready.Num() > 1)
+    {
+        Channel.ReadyBytes -= Channel.Ready[0].Body.Num();
+        Channel.Stats.EventsDropped += Channel.Ready[0].NumEvents;
+        Channel.Ready.RemoveAt(0);
+    }
+}
+
+void FQuickHttpTelemetry::SpillReady(FChannel& Channel)
+{
+    if (Channel.Ready.Num() == 0) { return; }
+
+    // One task per call keeps the batches of a call in order in the log
+    FSpillLogPtr Log = Channel.Spill;
+    Channel.DiskTasks.Add(Async(EAsyncExecution::ThreadPool, [Log, Batches = MoveTemp(Channel.Ready)]()
+    {
+        for (const FBatch& Batch : Batches)
+        {
+            Log->Append(Batch.Body, Batch.NumEvents, (uint8)Batch.Format);
+        }
+    }));
+    Channel.Ready.Reset();
+    Channel.ReadyBytes = 0;
+}
+
+void FQuickHttpTelemetry::Pump(FChannel& Channel, double NowSeconds)
+{
+    if (Channel.Request.IsValid() || Channel.bReadingSpill) { return; }
+    if (Channel.bOffline && NowSeconds < Channel.RetryAtSeconds) { return; }
+
+    // Fresh batches first; the spill log is replayed whenever nothing newer is waiting
+    if (Channel.Ready.Num() > 0)
+    {
+        FBatch Batch = MoveTemp(Channel.Ready[0]);
+        Channel.Ready.RemoveAt(0);
+        Channel.ReadyBytes -= Batch.Body.Num();
+        Send(Channel, MoveTemp(Batch));
+        return;
+    }
+    // Also runs for a delivered last batch alone, so the drained log is removed
+    if (Channel.bSpillPopPending || Channel.Spill->NumBatches() > 0)
+    {
+        ReadSpill(Channel);
+    }
+}
+
+void FQuickHttpTelemetry::Send(FChannel& Channel, FBatch&& Batch)
+{
+    const FQuickHttpTelemetryConfig& Config = Channel.Config;
+
+    TArray<FQuickHttpHeader> Headers = Config.Headers;
+    const bool bHasContentType = Headers.ContainsByPredicate([](const FQuickHttpHeader& Header)
+    {
+        return Header.Name.Equals(TEXT("Content-Type"), ESearchCase::IgnoreCase);
+    });
+    if (!bHasContentType && Batch.Format == EQuickHttpBatchFormat::NDJSON)
+    {
+        FQuickHttpHeader& ContentType = Headers.AddDefaulted_GetRef();
+        ContentType.Name = TEXT("Content-Type");
+        ContentType.Value = TEXT("application/x-ndjson");
+    }
+
+    FQuickHttpRequestOptions Options;
+    Options.Priority = EQuickHttpPriority::Background;
+    Options.bCompressRequestBody = Config.bCompress;
+
+    UHttpJsonRequestAsync* Request = UHttpJsonRequestAsync::HttpJsonRequestWithOptions(nullptr, EQuickHttpMethod::POST, Config.Url,
+        Headers, Config.TimeoutSeconds, Config.MaxRetries, 0.35f, 64, 0, FString(), Options);
+    TArray<uint8> Body = Batch.Body;
+    Request->SetBodyBytes(MoveTemp(Body));
+    Request->OnFinishedNative.AddRaw(this, &FQuickHttpTelemetry::HandleBatchFinished, Channel.Name);
+
+    Channel.Sending = MoveTemp(Batch);
+    Channel.Request.Reset(Request);
+
+    // May finish synchronously (e.g. open circuit breaker); Channel must not be used after this
+    Request->Activate();
+}
+
+void FQuickHttpTelemetry::ReadSpill(FChannel& Channel)
+{
+    Channel.bReadingSpill = true;
+    const bool bPop = Channel.bSpillPopPending;
+    Channel.bSpillPopPending = false;
+
+    const FName Name = Channel.Name;
+    FSpillLogPtr Log = Channel.Spill;
+    Channel.DiskTasks.Add(Async(EAsyncExecution::ThreadPool, [Name, Log, bPop]()
+    {
+        if (bPop) { Log->Pop(); }
+        TArray<uint8> Body;
+        int32 NumEvents = 0;
+        uint8 Format = 0;
+        const bool bRead = Log->Peek(Body, NumEvents, Format);
+
+        AsyncTask(ENamedThreads::GameThread, [Name, Log, bRead, Body = MoveTemp(Body), NumEvents, Format]() mutable
+        {
+            if (!FQuickHttpModule::IsAvailable()) { return; }
+            FQuickHttpModule::Get().GetTelemetry().HandleSpillRead(Name, Log, bRead, MoveTemp(Body), NumEvents, Format);
+        });
+    }));
+}
+
+void FQuickHttpTelemetry::HandleSpillRead(FName Name, const FSpillLogPtr& Log, bool bRead, TArray<uint8>&& Body, int32 NumEvents, uint8 Format)
+{
+    TUniquePtr<FChannel>* Found = Channels.Find(Name);
+    if (!Found || (*Found)->Spill != Log) { return; }
+    FChannel& Channel = **Found;
+    Channel.bReadingSpill = false;
+    if (!bRead) { return; }
+
+    FBatch Batch;
+    Batch.Body = MoveTemp(Body);
+    Batch.NumEvents = NumEvents;
+    Batch.Format = Format == (uint8)EQuickHttpBatchFormat::NDJSON ? EQuickHttpBatchFormat::NDJSON : EQuickHttpBatchFormat::JsonArray;
+    Batch.bFromSpill = true;
+    Send(Channel, MoveTemp(Batch));
+}
+
+void FQuickHttpTelemetry::HandleBatchFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error, FName Name)
+{
+    TUniquePtr<FChannel>* Found = Channels.Find(Name);
+    if (!Found || (*Found)->Request.Get() != Request) { return; }
+    FChannel& Channel = **Found;
+    Request->OnFinishedNative.RemoveAll(this);
+    Channel.Request.Reset();
+    FBatch Batch = MoveTemp(Channel.Sending);
+    const double Now = FPlatformTime::Seconds();
+
+#if QUICKHTTP_WITH_METRICS
+    FQuickHttpModule::Get().GetMetrics().RecordTelemetryBatch(Batch.NumEvents, !Error.bIsError);
+#endif
+
+    if (!Error.bIsError || QuickHttpTelemetry::IsRejected(StatusCode))
+    {
+        if (Error.bIsError)
+        {
+            UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp telemetry channel %s: batch of %d event(s) rejected with %d, dropped"),
+                *Name.ToString(), Batch.NumEvents, StatusCode);
+            Channel.Stats.BatchesFailed++;
+            Channel.Stats.EventsDropped += Batch.NumEvents;
+        }
+        else
+        {
+            Channel.Stats.EventsSent += Batch.NumEvents;
+            Channel.Stats.BatchesSent++;
+            Channel.Stats.BytesSent += Batch.Body.Num();
+            if (Channel.bOffline)
+            {
+                UE_LOG(LogQuickHttp, Log, TEXT("QuickHttp telemetry channel %s is back online"), *Name.ToString());
+            }
+            Channel.bOffline = false;
+        }
+        if (Batch.bFromSpill) { Channel.bSpillPopPending = true; }
+        Pump(Channel, Now);
+        return;
+    }
+
+    Channel.Stats.BatchesFailed++;
+    if (!Channel.bOffline)
+    {
+        UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp telemetry channel %s is offline (%s), retrying in %.0f s"),
+            *Name.ToString(), *Error.Message, Channel.Config.OfflineRetrySeconds);
+    }
+    Channel.bOffline = true;
+    Channel.RetryAtSeconds = Now + Channel.Config.OfflineRetrySeconds;
+
+    // A replayed batch is still in the log; anything else goes back in front of the queue
+    if (!Batch.bFromSpill)
+    {
+        Channel.ReadyBytes += Batch.Body.Num();
+        Channel.Ready.Insert(MoveTemp(Batch), 0);
+    }
+    if (Channel.Config.bSpillToDisk)
+    {
+        SpillReady(Channel);
+    }
+    else
+    {
+        ShedReady(Channel);
+    }
+}
+
+void FQuickHttpTelemetry::Tick(double NowSeconds)
+{
+    for (TPair<FName, TUniquePtr<FChannel>>& Pair : Channels)
+    {
+        FChannel& Channel = *Pair.Value;
+        Channel.DiskTasks.RemoveAll([](const TFuture<void>& Task) { return Task.IsReady(); });
+
+        if (Channel.PendingEvents > 0 && NowSeconds - Channel.PendingSinceSeconds >= Channel.Config.MaxBatchAgeSeconds)
+        {
+            Seal(Channel);
+        }
+        Pump(Channel, NowSeconds);
+
+        // Smoothed over a few seconds so one large batch does not read as a spike
+        const double Window = NowSeconds - Channel.RateWindowStartSeconds;
+        if (Window >= 1.0)
+        {
+            const float Rate = (float)((Channel.Stats.EventsSent - Channel.RateEventsSent) / Window);
+            Channel.Stats.EventsPerSecond = FMath::Lerp(Channel.Stats.EventsPerSecond, Rate, 0.3f);
+            Channel.RateEventsSent = Channel.Stats.EventsSent;
+            Channel.RateWindowStartSeconds = NowSeconds;
+        }
+    }
+}
+
+void FQuickHttpTelemetry::Shutdown()
+{
+    int32 Lost = 0;
+    for (TPair<FName, TUniquePtr<FChannel>>& Pair : Channels)
+    {
+        FChannel& Channel = *Pair.Value;
+        Seal(Channel);
+
+        // The batch on the wire has not been confirmed, so it is kept like the rest
+        if (UHttpJsonRequestAsync* Request = Channel.Request.Get())
+        {
+            Request->OnFinishedNative.RemoveAll(this);
+            Request->Cancel();
+            Channel.Request.Reset();
+            if (!Channel.Sending.bFromSpill)
+            {
+                Channel.ReadyBytes += Channel.Sending.Body.Num();
+                Channel.Ready.Insert(MoveTemp(Channel.Sending), 0);
+            }
+        }
+
+        for (TFuture<void>& Task : Channel.DiskTasks)
+        {
+            Task.Wait();
+        }
+        Channel.DiskTasks.Reset();
+
+        if (Channel.bSpillPopPending) { Channel.Spill->Pop(); }
+        for (const FBatch& Batch : Channel.Ready)
+        {
+            if (!Channel.Config.bSpillToDisk || !Channel.Spill->Append(Batch.Body, Batch.NumEvents, (uint8)Batch.Format))
+            {
+                Lost += Batch.NumEvents;
+            }
+        }
+        Channel.Spill->Close();
+    }
+    Channels.Reset();
+
+    if (Lost > 0)
+    {
+        UE_LOG(LogQuickHttp, Warning, TEXT("QuickHttp telemetry: %d unsent event(s) dropped at shutdown"), Lost);
+    }
+}
+
+bool FQuickHttpTelemetry::GetStats(FName Name, FQuickHttpTelemetryStats& OutStats) const
+{
+    const TUniquePtr<FChannel>* Found = Channels.Find(Name);
+    if (!Found) { return false; }
+    FillStats(**Found, OutStats);
+    return true;
+}
+
+void FQuickHttpTelemetry::GetAllStats(TArray<FQuickHttpTelemetryStats>& OutStats) const
+{
+    OutStats.Reset(Channels.Num());
+    for (const TPair<FName, TUniquePtr<FChannel>>& Pair : Channels)
+    {
+        FillStats(*Pair.Value, OutStats.AddDefaulted_GetRef());
+    }
+}
+
+void FQuickHttpTelemetry::FillStats(const FChannel& Channel, FQuickHttpTelemetryStats& OutStats) const
+{
+    OutStats = Channel.Stats;
+    OutStats.QueuedEvents = Channel.PendingEvents;
+    OutStats.QueuedBytes = Channel.Pending.Num() + Channel.ReadyBytes;
+    for (const FBatch& Batch : Channel.Ready)
+    {
+        OutStats.QueuedEvents += Batch.NumEvents;
+    }
+    if (Channel.Request.IsValid() && !Channel.Sending.bFromSpill)
+    {
+        OutStats.QueuedEvents += Channel.Sending.NumEvents;
+        OutStats.QueuedBytes += Channel.Sending.Body.Num();
+    }
+    OutStats.SpilledEvents = Channel.Spill->NumEvents();
+    OutStats.SpilledBytes = Channel.Spill->NumBytes();
+    OutStats.EventsDropped += Channel.Spill->NumDroppedEvents();
+    OutStats.bOffline = Channel.bOffline;
+}
+
+int32 FQuickHttpTelemetry::NumQueuedEvents() const
+{
+    int32 Total = 0;
+    for (const TPair<FName, TUniquePtr<FChannel>>& Pair : Channels)
+    {
+        const FChannel& Channel = *Pair.Value;
+        Total += Channel.PendingEvents;
+        for (const FBatch& Batch : Channel.Ready)
+        {
+            Total += Batch.NumEvents;
+        }
+        if (Channel.Request.IsValid() && !Channel.Sending.bFromSpill)
+        {
+            Total += Channel.Sending.NumEvents;
+        }
+    }
+    return Total;
+}
+
+int32 FQuickHttpTelemetry::NumSpilledEvents() const
+{
+    int32 Total = 0;
+    for (const TPair<FName, TUniquePtr<FChannel>>& Pair : Channels)
+    {
+        Total += Pair.Value->Spill->NumEvents();
+    }
+    return Total;
+}
@@ -0,0 +1,107 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+#include "Async/Future.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UHttpJsonRequestAsync;
+class FQuickHttpSpillLog;
+
+/**
+ * Batching uploader for small JSON events, by named channel.
+ *
+ * Recorded events are appended to the channel's open batch, already framed as a JSON array or NDJSON,
+ * which is sealed when it reaches the event count, byte size or age limit of the channel's config, on Flush,
+ * and at shutdown. Sealed batches are POSTed one at a time per channel through a regular request node, so they
+ * get its retries, circuit breaker, gzip and metrics. A batch that still fails takes the channel offline:
+ * unsent batches go to the channel's spill log on disk and the endpoint is tried again after a pause, then
+ * the log is replayed. Batches the endpoint rejects with a 4xx are dropped. Game thread only.
+ */
+class FQuickHttpTelemetry
+{
+public:
+    /** Create the channel or change its config. Events already queued are kept. False if the config has no URL. */
+    bool Configure(FName Channel, const FQuickHttpTelemetryConfig& Config);
+
+    bool HasChannel(FName Channel) const { return Channels.Contains(Channel); }
+
+    /** Queue one event: a single compact JSON value in UTF-8 (as written by FQuickJsonWriter), not checked. */
+    bool Record(FName Channel, TArrayView<const uint8> EventJson);
+
+    /** Queue one event given as JSON text; it is validated and minified first. */
+    bool RecordString(FName Channel, const FString& EventJson);
+
+    /** Seal the open batch of Channel (NAME_None for every channel) and send what the channel can send now. */
+    void Flush(FName Channel);
+
+    bool GetStats(FName Channel, FQuickHttpTelemetryStats& OutStats) const;
+    void GetAllStats(TArray<FQuickHttpTelemetryStats>& OutStats) const;
+
+    /** Events waiting in memory and in spill logs, across channels. */
+    int32 NumQueuedEvents() const;
+    int32 NumSpilledEvents() const;
+
+    /** Seal batches that are old enough and start the next sends. */
+    void Tick(double NowSeconds);
+
+    /** Write everything unsent to the spill logs (or drop it without one) and forget every channel. */
+    void Shutdown();
+
+private:
+    typedef TSharedPtr<FQuickHttpSpillLog, ESPMode::ThreadSafe> FSpillLogPtr;
+
+    struct FBatch
+    {
+        TArray<uint8> Body;
+        int32 NumEvents = 0;
+        EQuickHttpBatchFormat Format = EQuickHttpBatchFormat::JsonArray;
+        // Sent from the spill log, where it stays until the endpoint accepted it
+        bool bFromSpill = false;
+    };
+
+    struct FChannel
+    {
+        FName Name;
+        FQuickHttpTelemetryConfig Config;
+
+        // Open batch: framing plus the events recorded so far
+        TArray<uint8> Pending;
+        int32 PendingEvents = 0;
+        double PendingSinceSeconds = 0.0;
+
+        // Sealed batches waiting to be sent, oldest first
+        TArray<FBatch> Ready;
+        int64 ReadyBytes = 0;
+
+        FBatch Sending;
+        TStrongObjectPtr<UHttpJsonRequestAsync> Request;
+
+        FSpillLogPtr Spill;
+        TArray<TFuture<void>> DiskTasks;
+        bool bReadingSpill = false;
+        // The last replayed batch was delivered; removed from the log before the next one is read
+        bool bSpillPopPending = false;
+
+        bool bOffline = false;
+        double RetryAtSeconds = 0.0;
+
+        FQuickHttpTelemetryStats Stats;
+        int64 RateEventsSent = 0;
+        double RateWindowStartSeconds = 0.0;
+    };
+
+    void Seal(FChannel& Channel);
+    void Enqueue(FChannel& Channel, FBatch&& Batch);
+    void ShedReady(FChannel& Channel);
+    void SpillReady(FChannel& Channel);
+    void Pump(FChannel& Channel, double NowSeconds);
+    void Send(FChannel& Channel, FBatch&& Batch);
+    void ReadSpill(FChannel& Channel);
+    void HandleSpillRead(FName Name, const FSpillLogPtr& Log, bool bRead, TArray<uint8>&& Body, int32 NumEvents, uint8 Format);
+    void HandleBatchFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error, FName Name);
+    void FillStats(const FChannel& Channel, FQuickHttpTelemetryStats& OutStats) const;
+
+    TMap<FName, TUniquePtr<FChannel>> Channels;
+};
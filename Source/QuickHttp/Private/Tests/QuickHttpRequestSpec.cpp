@@ -0,0 +1,179 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "QuickHttpModule.h"
+#include "Async/HttpJsonRequestAsync.h"
+#include "Benchmarks/QuickHttpMockServer.h"
+#include "Json/QuickJsonReformatter.h"
+#include "Misc/Guid.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && !UE_BUILD_SHIPPING
+
+typedef TFunction<void(UHttpJsonRequestAsync* /*Request*/, const FString& /*ResponseJson*/, int32 /*StatusCode*/, const FQuickHttpError& /*Error*/)> FQuickHttpSpecDone;
+
+BEGIN_DEFINE_SPEC(FQuickHttpRequestSpec, "QuickHttp.Request",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+    TUniquePtr<FQuickHttpMockServer> Server;
+
+    /** GET Query from the mock server through the request node; the node is kept alive until OnDone has run. */
+    UHttpJsonRequestAsync* Send(const FString& Query, int32 MaxRetries, int32 CancelToken, FQuickHttpSpecDone OnDone,
+        int32 TimeoutSeconds = 10, int32 MaxPayloadKB = 64, const FQuickHttpRequestOptions& Options = FQuickHttpRequestOptions())
+    {
+        UHttpJsonRequestAsync* Request = UHttpJsonRequestAsync::HttpJsonRequestWithOptions(nullptr, EQuickHttpMethod::GET,
+            Server->GetBaseUrl() + TEXT("/spec?") + Query, TArray<FQuickHttpHeader>(), TimeoutSeconds, MaxRetries, 0.01f, MaxPayloadKB,
+            CancelToken, FString(), Options);
+        Request->AddToRoot();
+        Request->OnFinishedNative.AddLambda([OnDone](UHttpJsonRequestAsync* Node, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            Node->RemoveFromRoot();
+            OnDone(Node, ResponseJson, StatusCode, Error);
+        });
+        Request->Activate();
+        return Request;
+    }
+
+END_DEFINE_SPEC(FQuickHttpRequestSpec)
+
+void FQuickHttpRequestSpec::Define()
+{
+    BeforeEach([this]()
+    {
+        Server = MakeUnique<FQuickHttpMockServer>();
+        TestTrue(TEXT("Mock server started"), Server->Start());
+        // Failures from earlier runs against the loopback host must not open its breaker or drain its retry budget
+        FQuickHttpModule::Get().GetCircuitBreaker().Reset();
+    });
+
+    AfterEach([this]()
+    {
+        Server.Reset();
+    });
+
+    LatentIt(TEXT("delivers a 200 response in one attempt"), [this](const FDoneDelegate& Done)
+    {
+        Send(TEXT("bytes=256"), 2, 0, [this, Done](UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            TestFalse(TEXT("Error"), Error.bIsError);
+            TestEqual(TEXT("Status code"), StatusCode, 200);
+            TestTrue(TEXT("Body is valid JSON"), FQuickJsonReformatter::Validate(ResponseJson, nullptr));
+            TestEqual(TEXT("Attempts"), Request->GetRequestStats().Attempts, 1);
+            Done.Execute();
+        });
+    });
+
+    LatentIt(TEXT("retries a 503 MaxRetries times and then fails"), [this](const FDoneDelegate& Done)
+    {
+        Send(TEXT("status=503"), 2, 0, [this, Done](UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            TestTrue(TEXT("Error"), Error.bIsError);
+            TestEqual(TEXT("Status code"), StatusCode, 503);
+            TestEqual(TEXT("Attempts"), Request->GetRequestStats().Attempts, 3);
+            TestEqual(TEXT("Responses served"), Server->GetNumServed(), (int64)3);
+            Done.Execute();
+        });
+    });
+
+    LatentIt(TEXT("cancels an in-flight request by token"), [this](const FDoneDelegate& Done)
+    {
+        const int32 Token = 0x51480015;
+        TSharedRef<bool> bFinished = MakeShared<bool>(false);
+        Send(TEXT("latency_ms=5000"), 0, Token, [this, bFinished](UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            TestFalse(TEXT("Finished only once"), *bFinished);
+            *bFinished = true;
+            TestTrue(TEXT("Error"), Error.bIsError);
+            TestEqual(TEXT("Status code"), StatusCode, 0);
+            TestEqual(TEXT("Reason"), Error.Message, FString(TEXT("Cancelled")));
+        });
+
+        // Cancellation reports synchronously; the server is still sleeping on the request
+        UHttpJsonRequestAsync::CancelByToken(Token);
+        TestTrue(TEXT("Finished on cancel"), *bFinished);
+        TestEqual(TEXT("Responses served"), Server->GetNumServed(), (int64)0);
+        Done.Execute();
+    });
+
+    LatentIt(TEXT("fails a request that outlives its timeout"), [this](const FDoneDelegate& Done)
+    {
+        Send(TEXT("latency_ms=4000"), 0, 0, [this, Done](UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            TestTrue(TEXT("Error"), Error.bIsError);
+            TestEqual(TEXT("Status code"), StatusCode, 0);
+            TestTrue(TEXT("Gave up before the server answered"), Request->GetRequestStats().TotalSeconds < 3.f);
+            TestEqual(TEXT("Responses served"), Server->GetNumServed(), (int64)0);
+            Done.Execute();
+        }, 1);
+    });
+
+    LatentIt(TEXT("rejects a body larger than MaxPayloadKB"), [this](const FDoneDelegate& Done)
+    {
+        Send(TEXT("bytes=16384"), 0, 0, [this, Done](UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+        {
+            TestTrue(TEXT("Error"), Error.bIsError);
+            TestEqual(TEXT("Reason"), Error.Message, FString(TEXT("Payload too large")));
+            TestTrue(TEXT("Body not delivered"), ResponseJson.IsEmpty() && Error.RawBody.IsEmpty());
+            Done.Execute();
+        }, 10, 4);
+    });
+
+    LatentIt(TEXT("revalidates a stale cache entry with If-None-Match and serves it on 304"), [this](const FDoneDelegate& Done)
+    {
+        FQuickHttpRequestOptions Options;
+        Options.bUseCache = true;
+        const FString Query = FString::Printf(TEXT("bytes=512&max_age=0&etag=%s"), *FGuid::NewGuid().ToString());
+        const int64 RevalidationsBefore = FQuickHttpModule::Get().GetResponseCache().GetStats().Revalidations;
+
+        Send(Query, 0, 0, [this, Done, Query, Options, RevalidationsBefore](UHttpJsonRequestAsync* First, const FString& FirstJson, int32 FirstStatus, const FQuickHttpError& FirstError)
+        {
+            TestFalse(TEXT("First request error"), FirstError.bIsError);
+            TestEqual(TEXT("First status"), FirstStatus, 200);
+
+            // max-age=0 makes the stored entry stale at once, so the second request must revalidate it
+            Send(Query, 0, 0, [this, Done, FirstJson, RevalidationsBefore](UHttpJsonRequestAsync* Second, const FString& SecondJson, int32 SecondStatus, const FQuickHttpError& SecondError)
+            {
+                TestFalse(TEXT("Second request error"), SecondError.bIsError);
+                TestEqual(TEXT("Status of the cached entry"), SecondStatus, 200);
+                TestEqual(TEXT("Cached body"), SecondJson, FirstJson);
+                TestEqual(TEXT("304 answers"), Server->GetNumNotModified(), (int64)1);
+                TestEqual(TEXT("Revalidations"), FQuickHttpModule::Get().GetResponseCache().GetStats().Revalidations, RevalidationsBefore + 1);
+                Done.Execute();
+            }, 10, 64, Options);
+        }, 10, 64, Options);
+    });
+
+    LatentIt(TEXT("coalesces identical GETs into one network request"), [this](const FDoneDelegate& Done)
+    {
+        FQuickHttpRequestOptions Options;
+        Options.bCoalesceIdenticalRequests = true;
+        const FString Query = FString::Printf(TEXT("latency_ms=200&bytes=256&id=%s"), *FGuid::NewGuid().ToString());
+
+        struct FFlight
+        {
+            int32 Finished = 0;
+            TArray<FString> Bodies;
+        };
+        TSharedRef<FFlight> Flight = MakeShared<FFlight>();
+        const int32 NumRequests = 3;
+        for (int32 Index = 0; Index < NumRequests; ++Index)
+        {
+            Send(Query, 0, 0, [this, Done, Flight, NumRequests](UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error)
+            {
+                TestFalse(TEXT("Error"), Error.bIsError);
+                TestEqual(TEXT("Status code"), StatusCode, 200);
+                Flight->Bodies.Add(ResponseJson);
+                if (++Flight->Finished < NumRequests) { return; }
+
+                TestEqual(TEXT("Responses served"), Server->GetNumServed(), (int64)1);
+                for (const FString& Body : Flight->Bodies)
+                {
+                    TestEqual(TEXT("Shared body"), Body, Flight->Bodies[0]);
+                }
+                Done.Execute();
+            }, 10, 64, Options);
+        }
+    });
+}
+
+#endif
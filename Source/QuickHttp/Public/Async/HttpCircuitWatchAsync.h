@@ -0,0 +1,55 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "QuickHttpTypes.h"
+#include "HttpCircuitWatchAsync.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FQuickHttpCircuitChanged, const FString&, Host, EQuickHttpCircuitState, OldState, EQuickHttpCircuitState, NewState);
+
+/**
+ * Async Blueprint node that reports every circuit breaker state change until stopped,
+ * e.g. to show an "online services unavailable" banner while a backend's breaker is open.
+ */
+UCLASS(meta=(ExposedAsyncProxy=AsyncTask))
+class QUICKHTTP_API UHttpCircuitWatchAsync : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Fired on the game thread each time a host's breaker changes state. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpCircuitChanged OnStateChanged;
+
+    /**
+     * Listen for circuit breaker state changes (async, fires repeatedly).
+     *
+     * @param WorldContextObject   Used for latent/action lifetime and GameThread dispatch.
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp|Resilience",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    DisplayName="Watch HTTP Circuit Breakers",
+                    Keywords="circuit breaker open closed half-open event listen health",
+                    ToolTip="Fire an event whenever a host's circuit breaker opens, half-opens or closes."))
+    static UHttpCircuitWatchAsync* WatchHttpCircuitBreakers(UObject* WorldContextObject);
+
+    /** Stop listening. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Resilience", meta=(DisplayName="Stop Watching Circuit Breakers"))
+    void Stop();
+
+    // UBlueprintAsyncActionBase
+    virtual void Activate() override;
+
+    // UObject
+    virtual void BeginDestroy() override;
+
+private:
+    void HandleStateChanged(const FString& Host, EQuickHttpCircuitState OldState, EQuickHttpCircuitState NewState);
+    void Unbind();
+
+    TWeakObjectPtr<UObject> WorldContextObject;
+    FDelegateHandle Handle;
+};
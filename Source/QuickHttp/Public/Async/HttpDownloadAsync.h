@@ -0,0 +1,147 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "QuickHttpTypes.h"
+#include "Scheduling/QuickHttpTimerWheel.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HttpDownloadAsync.generated.h"
+
+class FQuickHttpDownloadSink;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpDownloadProgress, int64, BytesReceived, int64, TotalBytes);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpDownloadSuccess, const FString&, FilePath, const FString&, Hash);
+
+/**
+ * Async Blueprint node that downloads a file of any size straight to disk.
+ *
+ * The file is fetched in Range requests of ChunkSizeKB, each written and hashed on a worker thread as
+ * soon as it arrives, so memory stays bounded by about one chunk whatever the file size. Data goes to
+ * "<FilePath>.part" and is renamed into place once complete and verified. A failed chunk is retried with
+ * the usual backoff from where it stopped. With bResume, a .part file left over from an earlier run is
+ * continued as long as the server still has the same version of the file (If-Range).
+ */
+UCLASS(meta=(ExposedAsyncProxy=AsyncTask))
+class QUICKHTTP_API UHttpDownloadAsync : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Fired at most once per ProgressIntervalSeconds while data arrives. TotalBytes is -1 until the server reports the size. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpDownloadProgress OnProgress;
+
+    /** Fired when the file is complete, verified and in place. Hash is the lower-case hex digest (empty for None). */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpDownloadSuccess OnSuccess;
+
+    /** Fired when the download fails (retries exhausted, HTTP error, disk error or hash mismatch). The .part file is kept for a later resume unless the hash did not match. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpFailure OnFailure;
+
+    /** Fired when Cancel Download is called. The .part file is kept. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpFailure OnCancelled;
+
+    /**
+     * Download a URL to a file (async).
+     *
+     * @param WorldContextObject       Used for latent/action lifetime and GameThread dispatch.
+     * @param Url                      Absolute URL to download.
+     * @param Headers                  Optional request headers (e.g. Authorization).
+     * @param FilePath                 Destination file; relative paths are under the project's Saved directory.
+     * @param HashAlgorithm            Digest computed while streaming.
+     * @param ExpectedHash             Hex digest to verify against (case-insensitive); empty skips verification.
+     * @param ChunkSizeKB              Bytes per Range request, and roughly the memory used.
+     * @param TimeoutSeconds           Max seconds for one chunk.
+     * @param MaxRetries               Retries per chunk on network failure / HTTP 5xx. Progress resets the count.
+     * @param BackoffBaseSeconds       Base seconds for retry backoff (see UQuickHttpSettings).
+     * @param ProgressIntervalSeconds  Minimum time between OnProgress events.
+     * @param bResume                  Continue a .part file from an earlier run instead of starting over.
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    AutoCreateRefTerm="Headers",
+                    AdvancedDisplay="Headers,ChunkSizeKB,TimeoutSeconds,MaxRetries,BackoffBaseSeconds,ProgressIntervalSeconds,bResume,Priority",
+                    DisplayName="HTTP Download To File",
+                    Keywords="http download file disk stream large resume range checksum sha1 md5",
+                    ToolTip="Download a file of any size to disk with progress, resume and checksum verification (async)."))
+    static UHttpDownloadAsync* HttpDownloadToFile(
+        UObject* WorldContextObject,
+        const FString& Url,
+        const TArray<FQuickHttpHeader>& Headers,
+        const FString& FilePath,
+        EQuickHttpHashAlgorithm HashAlgorithm,
+        const FString& ExpectedHash,
+        int32 ChunkSizeKB = 4096,
+        int32 TimeoutSeconds = 60,
+        int32 MaxRetries = 5,
+        float BackoffBaseSeconds = 1.f,
+        float ProgressIntervalSeconds = 0.25f,
+        bool bResume = true,
+        EQuickHttpPriority Priority = EQuickHttpPriority::Low
+    );
+
+    /** Stop the download and fire OnCancelled. The partial file is kept so a later download can resume it. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Cancel Download"))
+    void Cancel();
+
+    // UBlueprintAsyncActionBase
+    virtual void Activate() override;
+
+    // UObject
+    virtual void BeginDestroy() override;
+
+private:
+    void Attempt();
+    void StartAttempt();
+    void HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+    void WriteOnWorker(TArray<uint8>&& Chunk, bool bRestart, bool bComplete, const FString& NewValidator);
+    void HandleChunkWritten(int64 ChunkBytes, bool bRestart, bool bComplete, const FString& Error);
+    void RetryOrFail(int32 StatusCode, const FString& Message);
+    void ReportProgress(int64 Received, bool bForce);
+    void FinishOnWorker(int32 StatusCode);
+    void Finish(const FString& Hash, const FString& Error, int32 StatusCode);
+    void AbortRequest();
+    void ReleaseSlot();
+    void CancelTimeout();
+
+    // Parameters
+    TWeakObjectPtr<UObject> WorldContextObject;
+    FString Url;
+    FString Host;
+    TArray<FQuickHttpHeader> Headers;
+    FString FilePath;
+    FString PartPath;
+    EQuickHttpHashAlgorithm HashAlgorithm = EQuickHttpHashAlgorithm::SHA1;
+    FString ExpectedHash;
+    int64 ChunkSize = 4 * 1024 * 1024;
+    int32 TimeoutSeconds = 60;
+    int32 MaxRetries = 5;
+    float BackoffBaseSeconds = 1.f;
+    float ProgressIntervalSeconds = 0.25f;
+    bool bResume = true;
+    EQuickHttpPriority Priority = EQuickHttpPriority::Low;
+
+    // Download state; the sink (file + running hash) is shared with the worker task that writes each chunk
+    TSharedPtr<FQuickHttpDownloadSink, ESPMode::ThreadSafe> Sink;
+    int64 Offset = 0;
+    int64 TotalBytes = -1;
+    FString Validator;
+    int32 AttemptIndex = 0;
+    float LastBackoffSeconds = 0.f;
+    double LastProgressSeconds = 0.0;
+    int64 LastReportedBytes = -1;
+
+    // Request state (UE4.25 uses NotThreadSafe for IHttpRequest)
+    TSharedPtr<class IHttpRequest, ESPMode::NotThreadSafe> ActiveRequest;
+    FQuickHttpTimerHandle TimeoutHandle;
+    uint64 SchedulerTicket = 0;
+    bool bHoldsSlot = false;
+    FThreadSafeBool bCancelled = false;
+    bool bFinished = false;
+};
@@ -0,0 +1,93 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "QuickHttpTypes.h"
+#include "Scheduling/QuickHttpTimerWheel.h"
+#include "HttpJsonBatchRequestAsync.generated.h"
+
+class UHttpJsonRequestAsync;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpBatchCompleted, const TArray<FQuickHttpBatchResult>&, Results, int32, NumSucceeded);
+
+/**
+ * Async Blueprint node that runs many HTTP JSON requests as one unit.
+ * Items share a concurrency cap and an overall deadline, reuse the retry/timeout behaviour of
+ * HTTP JSON Request, and report back with a single completion.
+ */
+UCLASS()
+class QUICKHTTP_API UHttpJsonBatchRequestAsync : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Fired once when every item finished, the deadline passed, or CompleteAfterN items succeeded. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpBatchCompleted OnCompleted;
+
+    /**
+     * Run a batch of HTTP requests (async).
+     *
+     * @param WorldContextObject   Used for latent/action lifetime and GameThread dispatch.
+     * @param Items                Requests to run. Results come back at the same indices.
+     * @param MaxConcurrency       Max items of this batch on the network at once.
+     * @param DeadlineSeconds      Overall deadline for the batch; unfinished items are cancelled. 0 disables.
+     * @param CompleteAfterN       Complete as soon as this many items succeeded and cancel the rest. 0 waits for all.
+     * @param TimeoutSeconds       Per-attempt timeout of each item.
+     * @param MaxRetries           Retry attempts per item on network failure / HTTP 5xx.
+     * @param BackoffBaseSeconds   Base seconds for exponential backoff.
+     * @param MaxPayloadKB         Safety limit for each response (in kilobytes).
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    DisplayName="HTTP JSON Batch Request",
+                    Keywords="http rest request json batch fan-out parallel",
+                    ToolTip="Run many HTTP requests under one concurrency cap and deadline, with a single completion."))
+    static UHttpJsonBatchRequestAsync* HttpJsonBatchRequest(
+        UObject* WorldContextObject,
+        const TArray<FQuickHttpBatchItem>& Items,
+        int32 MaxConcurrency,
+        float DeadlineSeconds,
+        int32 CompleteAfterN,
+        int32 TimeoutSeconds,
+        int32 MaxRetries,
+        float BackoffBaseSeconds,
+        int32 MaxPayloadKB
+    );
+
+    // UBlueprintAsyncActionBase
+    virtual void Activate() override;
+
+private:
+    void LaunchPending();
+    void HandleItemFinished(UHttpJsonRequestAsync* Request, const FString& ResponseJson, int32 StatusCode, const FQuickHttpError& Error);
+    void Complete(const FString& UnfinishedReason);
+
+    // Parameters
+    TWeakObjectPtr<UObject> WorldContextObject;
+    TArray<FQuickHttpBatchItem> Items;
+    int32 MaxConcurrency = 8;
+    float DeadlineSeconds = 0.f;
+    int32 CompleteAfterN = 0;
+    int32 TimeoutSeconds = 30;
+    int32 MaxRetries = 2;
+    float BackoffBaseSeconds = 0.35f;
+    int32 MaxPayloadKB = 1024;
+
+    // Batch state
+    UPROPERTY()
+    TArray<UHttpJsonRequestAsync*> Running;
+
+    TMap<UHttpJsonRequestAsync*, int32> RunningIndex;
+    TArray<FQuickHttpBatchResult> Results;
+    TBitArray<> Finished;
+    int32 NextIndex = 0;
+    int32 NumFinished = 0;
+    int32 NumSucceeded = 0;
+    bool bLaunching = false;
+    bool bDone = false;
+    FQuickHttpTimerHandle DeadlineHandle;
+};
@@ -4,29 +4,67 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
 #include "QuickHttpTypes.h"
+#include "Scheduling/QuickHttpTimerWheel.h"
+#include "Cache/QuickHttpResponseCache.h"
+#include "Json/QuickJsonDocument.h"
+#include "Json/QuickJsonStructValue.h"
+#include "Interfaces/IHttpRequest.h"
 #include "HttpJsonRequestAsync.generated.h"
 
+class UQuickHttpProfile;
+class UQuickJsonStreamWriter;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpSuccess, const FString&, ResponseJson, int32, StatusCode);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpSuccessBytes, const TArray<uint8>&, ResponseBytes, int32, StatusCode);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpSuccessDocument, UQuickJsonDocument*, Document, int32, StatusCode);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpSuccessStruct, UQuickJsonStructValue*, Value, int32, StatusCode);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FQuickHttpFailure, const FQuickHttpError&, Error);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FQuickHttpSuccessView, TArrayView<const uint8>, int32);
+DECLARE_MULTICAST_DELEGATE_FourParams(FQuickHttpFinishedNative, class UHttpJsonRequestAsync* /*Request*/, const FString& /*ResponseJson*/, int32 /*StatusCode*/, const FQuickHttpError& /*Error*/);
 
 /**
  * Async Blueprint node for HTTP JSON requests.
  * Exposes GET/POST/PUT/PATCH/DELETE, retries with backoff, a timeout watchdog, and cancel-by-token.
+ * Requests are admitted through a per-host / global concurrency limiter in priority order.
+ * Retries share a per-host budget and circuit breaker, and wait at least as long as a 429/503 Retry-After asks.
+ * Idempotent requests can be hedged (Options.bHedge) so one stalled connection does not set the latency.
  */
-UCLASS()
+UCLASS(meta=(ExposedAsyncProxy=AsyncTask))
 class QUICKHTTP_API UHttpJsonRequestAsync : public UBlueprintAsyncActionBase
 {
     GENERATED_BODY()
 
 public:
-    /** Fired when the request succeeds (2xx). ResponseJson is the response body, StatusCode is the HTTP code. */
+    /** Fired when the request succeeds (2xx). ResponseJson is the response body (MessagePack/CBOR bodies converted to JSON), StatusCode is the HTTP code. */
     UPROPERTY(BlueprintAssignable, Category="QuickHttp")
     FQuickHttpSuccess OnSuccess;
 
-    /** Fired when the request fails (timeout, network error, non-2xx with no retries left). */
+    /** Fired instead of OnSuccess when Options.bDeliverRawBytes is set. ResponseBytes is the body as sent by the server (UTF-8 JSON, MessagePack or CBOR). */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpSuccessBytes OnSuccessBytes;
+
+    /** C++ only: fired alongside OnSuccessBytes with a view of the response buffer (no copy). */
+    FQuickHttpSuccessView OnSuccessBytesView;
+
+    /** Fired instead of OnSuccess when Options.bParseOnWorker is set. The body (JSON, MessagePack or CBOR) was parsed on a worker thread. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpSuccessDocument OnSuccessDocument;
+
+    /** Fired instead of OnSuccess when a response struct type is set (HTTP Struct Request, Options.ResponseStruct). Copy the value out with Get Struct. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpSuccessStruct OnSuccessStruct;
+
+    /** Fired when the request fails (timeout, network error, non-2xx with no retries left, open circuit breaker). */
     UPROPERTY(BlueprintAssignable, Category="QuickHttp")
     FQuickHttpFailure OnFailure;
 
+    /** Fired when the request is cancelled by token, token group or Cancel All Requests. Error.Message holds the reason. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpFailure OnCancelled;
+
+    /** C++ only: fired once with the final outcome, before OnSuccess/OnFailure/OnCancelled. Error.bIsError is false on success. */
+    FQuickHttpFinishedNative OnFinishedNative;
+
     /**
      * Perform an HTTP request and return the JSON response (async).
      *
@@ -34,10 +72,10 @@ public:
      * @param Method               HTTP verb to use.
      * @param Url                  Absolute URL to call.
      * @param Headers              Optional request headers (e.g., Authorization, Content-Type).
-     * @param TimeoutSeconds       Max seconds before request is cancelled (watchdog thread).
-     * @param MaxRetries           Number of retry attempts on network failure / HTTP 5xx.
-     * @param BackoffBaseSeconds   Base seconds for exponential backoff (with small random jitter).
-     * @param MaxPayloadKB         Safety limit for response size (in kilobytes).
+     * @param TimeoutSeconds       Max seconds before request is cancelled (shared timeout scheduler).
+     * @param MaxRetries           Number of retry attempts on network failure / HTTP 5xx / 429, within the host's retry budget.
+     * @param BackoffBaseSeconds   Base seconds for exponential backoff (with small random jitter, or decorrelated jitter per UQuickHttpSettings).
+     * @param MaxPayloadKB         Safety limit for response size (in kilobytes), enforced while the body streams in.
      * @param CancelToken          Any non-zero int groups requests for mass cancellation via CancelByToken.
      * @param BodyJsonOptional     Optional JSON body for non-GET verbs.
      */
@@ -62,38 +100,249 @@ public:
     );
 
     /**
-     * Cancel all in-flight QuickHttp requests that share the given CancelToken.
-     * Use the same non-zero CancelToken when creating requests, then call this to abort them.
+     * Same as HttpJsonRequest, with additional per-request options.
+     * @param Options              Extra behaviour such as raw byte delivery. See FQuickHttpRequestOptions.
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    AutoCreateRefTerm="Headers,Options",
+                    AdvancedDisplay="Options",
+                    DisplayName="HTTP JSON Request (Advanced)",
+                    Keywords="http rest request json api web bytes options",
+                    ToolTip="Perform an HTTP request with additional options (async)."))
+    static UHttpJsonRequestAsync* HttpJsonRequestWithOptions(
+        UObject* WorldContextObject,
+        EQuickHttpMethod Method,
+        const FString& Url,
+        const TArray<FQuickHttpHeader>& Headers,
+        int32 TimeoutSeconds,
+        int32 MaxRetries,
+        float BackoffBaseSeconds,
+        int32 MaxPayloadKB,
+        int32 CancelToken,
+        const FString& BodyJsonOptional,
+        const FQuickHttpRequestOptions& Options
+    );
+
+    /**
+     * Perform a request with the base URL, headers, policy and auth token of a request profile.
+     * @param Profile              Created with Make HTTP Profile. Its auth token is read when each attempt starts.
+     * @param Path                 Appended to the profile's base URL; absolute URLs are used as is.
+     * @param Headers              Extra headers for this call; they replace profile headers of the same name.
+     * @param TimeoutSeconds       0 uses the profile's timeout.
+     * @param MaxRetries           -1 uses the profile's retry count.
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp|Profile",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    AutoCreateRefTerm="Headers,Options",
+                    AdvancedDisplay="Headers,CancelToken,Options,TimeoutSeconds,MaxRetries",
+                    DisplayName="HTTP Profile Request",
+                    Keywords="http rest request json api web profile base url auth",
+                    ToolTip="Perform an HTTP request using a request profile's base URL, headers and auth token (async)."))
+    static UHttpJsonRequestAsync* HttpProfileRequest(
+        UObject* WorldContextObject,
+        UQuickHttpProfile* Profile,
+        EQuickHttpMethod Method,
+        const FString& Path,
+        const TArray<FQuickHttpHeader>& Headers,
+        const FString& BodyJsonOptional,
+        int32 CancelToken,
+        const FQuickHttpRequestOptions& Options,
+        int32 TimeoutSeconds = 0,
+        int32 MaxRetries = -1
+    );
+
+    /**
+     * Send a typed body and decode the response into a struct type on a worker thread (async).
+     * Nothing goes through a JSON object tree: the body is the writer's UTF-8 bytes, and the response bytes are read
+     * straight into ResponseType, delivered through OnSuccessStruct.
+     *
+     * @param ResponseType         Struct type of the response body. Field names match those of the engine's JSON converter.
+     * @param Body                 Optional body, e.g. New JSON Stream Writer -> Write Struct. Copied when the node is created.
+     * @param TimeoutSeconds       Max seconds before request is cancelled.
+     * @param MaxRetries           Number of retry attempts on network failure / HTTP 5xx / 429.
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    AutoCreateRefTerm="Headers,Options",
+                    AdvancedDisplay="Headers,CancelToken,Options,TimeoutSeconds,MaxRetries",
+                    DisplayName="HTTP Struct Request",
+                    Keywords="http rest request json api web struct typed",
+                    ToolTip="Send a struct body and decode the JSON response into a struct on a worker thread (async)."))
+    static UHttpJsonRequestAsync* HttpStructRequest(
+        UObject* WorldContextObject,
+        EQuickHttpMethod Method,
+        const FString& Url,
+        UScriptStruct* ResponseType,
+        UQuickJsonStreamWriter* Body,
+        const TArray<FQuickHttpHeader>& Headers,
+        int32 CancelToken,
+        const FQuickHttpRequestOptions& Options,
+        int32 TimeoutSeconds = 30,
+        int32 MaxRetries = 2
+    );
+
+    /**
+     * Cancel all in-flight QuickHttp requests that share the given CancelToken, and those of every
+     * token group linked below it. Cancelled requests fire OnCancelled.
+     * A coalesced GET keeps its shared network request alive while other nodes still wait on it.
+     * Safe to call from any thread; the cancellation itself runs on the game thread.
      */
-    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Cancel Requests By Token", Keywords="cancel abort stop http request", ToolTip="Cancel all HTTP requests created with the same CancelToken."))
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Cancel Requests By Token", Keywords="cancel abort stop http request", ToolTip="Cancel all HTTP requests created with the same CancelToken, including linked child token groups."))
     static void CancelByToken(int32 InCancelToken);
 
+    /** Cancel every pending QuickHttp request, grouped or not (e.g. before a level transition). */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Cancel All Requests", Keywords="cancel abort stop all http request", ToolTip="Cancel every pending QuickHttp request."))
+    static void CancelAllRequests();
+
+    /**
+     * Make ChildToken a sub-group of ParentToken: cancelling the parent, or its deadline passing,
+     * also cancels the child's requests. Returns false for token 0 or if the link would form a cycle.
+     */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Link Cancel Token Group", Keywords="cancel token group parent child hierarchy", ToolTip="Cancel ChildToken's requests whenever ParentToken is cancelled."))
+    static bool LinkCancelTokenGroup(int32 ChildToken, int32 ParentToken);
+
+    /** Detach ChildToken from its parent group. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Unlink Cancel Token Group", Keywords="cancel token group parent child hierarchy"))
+    static void UnlinkCancelTokenGroup(int32 ChildToken);
+
+    /**
+     * Fail every request of CancelToken's group (and its child groups) that is still pending
+     * DeadlineSeconds from now, through OnFailure with "Deadline exceeded". Zero or less clears the deadline.
+     */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Set Cancel Token Deadline", Keywords="cancel token group deadline timeout budget", ToolTip="Fail the token group's pending requests once this many seconds have passed."))
+    static void SetCancelTokenDeadline(int32 CancelToken, float DeadlineSeconds);
+
+    /** C++: cancel every pending request with the given reason (game thread or not). */
+    static void CancelAllWithReason(const FString& Reason);
+
+    /** Number of retries currently waiting in the shared retry queue. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp", meta=(DisplayName="Get Queued Retry Count", Keywords="retry backoff queue pending", ToolTip="Number of QuickHttp retries currently waiting for their backoff to elapse."))
+    static int32 GetQueuedRetryCount();
+
+    /** Number of requests waiting for a concurrency slot. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp", meta=(DisplayName="Get Queued Request Count", Keywords="queue pending concurrency priority", ToolTip="Number of QuickHttp requests waiting for a per-host or global concurrency slot."))
+    static int32 GetQueuedRequestCount();
+
+    /** Queue-wait and network time of this request so far. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp", meta=(DisplayName="Get Request Stats"))
+    FQuickHttpRequestStats GetRequestStats() const { return Stats; }
+
+    /** Values found for one of Options.ExtractPaths (same selector text). Filled before OnSuccess fires. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp", meta=(DisplayName="Get Extracted Values"))
+    TArray<FQuickJsonPathMatch> GetExtractedValues(const FString& Path) const;
+
+    /** C++ only: abort this request without firing OnSuccess/OnFailure. */
+    void Cancel();
+
+    /** C++ only: send these UTF-8 JSON bytes as the body (e.g. from FQuickJsonWriter::MoveBytes), converted to Options.BodyFormat. Call before Activate. */
+    void SetBodyBytes(TArray<uint8>&& Bytes) { BodyBytes = MoveTemp(Bytes); }
+
     // UBlueprintAsyncActionBase
     virtual void Activate() override;
 
+    // UObject
+    virtual void BeginDestroy() override;
+
 private:
     void Attempt();
-    void ScheduleRetry(float DelaySeconds);
+    void StartAttempt();
+    TSharedRef<IHttpRequest, ESPMode::NotThreadSafe> CreateAttemptRequest();
+    void ReleaseSlot();
+    void RetryOrFail(int32 StatusCode, const FString& Message, const FString& RawBody, float RetryAfterSeconds);
+    bool ScheduleRetry(float DelaySeconds);
     float ComputeBackoffSeconds(int32 Index) const;
+    void CancelTimeout();
+    void HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+    void AbortIfPayloadTooLarge(FHttpRequestPtr Request, int64 NumBytes);
+    bool UsesHedging() const;
+    void ScheduleHedge();
+    void SendHedge();
+    bool SettleHedgeRace(FHttpRequestPtr Request, bool bUsable);
+    void DropHedge();
+    void PrepareBody();
+    void DecodeOnWorker(FHttpResponsePtr Response, const FString& Encoding, float RetryAfterSeconds);
+    void HandleResponseBody(FHttpResponsePtr Response, const TArray<uint8>& Content, float RetryAfterSeconds);
+    void UnregisterToken();
+    void CancelWithReason(const FString& Reason, bool bAsFailure);
+    static void CancelNodes(const TArray<TWeakObjectPtr<UHttpJsonRequestAsync>>& Nodes, const FString& Reason, bool bAsFailure);
+    bool UsesCache() const;
+    void StoreInCache(FHttpResponsePtr Response, const TArray<uint8>& Body);
+    bool UsesSingleFlight() const;
+    bool LeaveFlight();
+    TArray<UHttpJsonRequestAsync*> TakeFlightFollowers();
+    void AbortLocally();
+    void FinishSuccessBody(const TArray<uint8>& Body, int32 StatusCode, EQuickHttpBodyFormat Format);
     void FinishSuccess(const FString& Response, int32 StatusCode);
+    void FinishSuccessBytes(const TArray<uint8>& Response, int32 StatusCode);
+    void FinishOnWorker(const TArray<uint8>& Body, int32 StatusCode, EQuickHttpBodyFormat Format);
+    void FinishSuccessDocument(UQuickJsonDocument* Document, int32 StatusCode);
+    void FinishSuccessStruct(UQuickJsonStructValue* Value, int32 StatusCode);
     void FinishFailure(int32 StatusCode, const FString& Message, const FString& RawBody);
+    void RecordCompletion(bool bSucceeded);
 
     // Parameters
     TWeakObjectPtr<UObject> WorldContextObject;
     EQuickHttpMethod Method;
     FString Url;
+    FString Host;
     TArray<FQuickHttpHeader> Headers;
+    UPROPERTY()
+    UQuickHttpProfile* Profile = nullptr;
     int32 TimeoutSeconds = 30;
     int32 MaxRetries = 2;
     float BackoffBaseSeconds = 0.35f;
     int32 MaxPayloadKB = 1024;
     int32 CancelToken = 0;
+    bool bRegistered = false;
     FString BodyJsonOptional;
+    TArray<uint8> BodyBytes;
+    FString BodyError;
+    bool bBodyGzipped = false;
+    bool bBodyEncoded = false;
+    FQuickHttpRequestOptions Options;
+    UPROPERTY()
+    UScriptStruct* ResponseStruct = nullptr;
     int32 AttemptIndex = 0;
+    float LastBackoffSeconds = 0.f;
 
     // Request state (UE4.25 uses NotThreadSafe for IHttpRequest)
     TSharedPtr<class IHttpRequest, ESPMode::NotThreadSafe> ActiveRequest;
     FThreadSafeBool bCompleted = false;
+    FThreadSafeBool bCancelled = false;
+    bool bPayloadTooLarge = false;
+
+    // Concurrency slot and timing
+    uint64 SchedulerTicket = 0;
+    bool bHoldsSlot = false;
+    double QueuedAtSeconds = 0.0;
+    double AttemptStartSeconds = 0.0;
+    double FirstByteAtSeconds = 0.0;
+    double ActivatedAtSeconds = 0.0;
+    FQuickHttpRequestStats Stats;
+    TMap<FString, TArray<FQuickJsonPathMatch>> ExtractedValues;
+
+    // Identity (verb, URL, normalized headers) used by request coalescing, and the same without credentials for the cache
+    FString RequestKey;
+    FString CacheKey;
+    bool bHasCredentials = false;
+    FQuickHttpCacheEntryPtr CachedEntry;
+
+    // Single-flight state for GET requests with Options.bCoalesceIdenticalRequests
+    bool bInFlight = false;
+    bool bFlightLeader = false;
+    bool bFlightMuted = false;
+    FQuickHttpTimerHandle TimeoutHandle;
 
-    static TMap<int32, TSet<TWeakObjectPtr<UHttpJsonRequestAsync>>> TokenMap;
+    // Hedged attempt (Options.bHedge): a second copy of the current attempt racing the first
+    TSharedPtr<class IHttpRequest, ESPMode::NotThreadSafe> HedgeRequest;
+    FQuickHttpTimerHandle HedgeTimerHandle;
+    bool bHoldsHedgeSlot = false;
+    bool bActiveIsHedge = false;
 };
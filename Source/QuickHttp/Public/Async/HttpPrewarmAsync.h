@@ -0,0 +1,49 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "QuickHttpTypes.h"
+#include "HttpPrewarmAsync.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FQuickHttpPrewarmCompleted, const TArray<FQuickHttpPrewarmResult>&, Results, int32, NumSucceeded);
+
+/**
+ * Async Blueprint node that resolves and opens keep-alive connections to a set of origins, so the
+ * first real request to each one skips DNS, TCP and TLS setup (e.g. during a splash screen before login).
+ */
+UCLASS()
+class QUICKHTTP_API UHttpPrewarmAsync : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Fired once every origin was warmed or failed. Results are in the order of Urls. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpPrewarmCompleted OnCompleted;
+
+    /**
+     * Warm connections to the origins of Urls (async).
+     *
+     * @param WorldContextObject   Used for latent/action lifetime and GameThread dispatch.
+     * @param Urls                 URLs or bare host names (taken as https). Only scheme, host and port matter.
+     * @param bForce               Warm again even if an origin was warmed less than the DNS TTL ago.
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    AdvancedDisplay="bForce",
+                    DisplayName="Prewarm HTTP Connections",
+                    Keywords="http prewarm warm dns connection tls handshake keep-alive latency",
+                    ToolTip="Resolve host names and open keep-alive connections ahead of the first request."))
+    static UHttpPrewarmAsync* PrewarmHttpConnections(UObject* WorldContextObject, const TArray<FString>& Urls, bool bForce = false);
+
+    // UBlueprintAsyncActionBase
+    virtual void Activate() override;
+
+private:
+    TWeakObjectPtr<UObject> WorldContextObject;
+    TArray<FString> Urls;
+    bool bForce = false;
+};
@@ -0,0 +1,122 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "QuickHttpTypes.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HttpStreamRequestAsync.generated.h"
+
+class FQuickHttpStreamState;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FQuickHttpStreamRecords, const TArray<FQuickHttpStreamRecord>&, Records);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FQuickHttpStreamClosed, int32, StatusCode);
+
+/**
+ * Async Blueprint node for streamed responses: NDJSON (one JSON value per line) or Server-Sent Events.
+ *
+ * Records are parsed off the game thread as the body arrives and handed to OnRecords in batches, at
+ * most once per frame. Partial input is held in a buffer of MaxBufferKB; a record larger than that,
+ * or records piling up faster than the game thread takes them, fails the stream. SSE streams reconnect
+ * after the server's retry delay (with backoff) and send Last-Event-ID so no events are missed.
+ * Streams do not take a concurrency slot or a timeout, as they are meant to stay open.
+ * Engines before UE 5.3 only hand over the body once a response is complete, so records then arrive
+ * per response rather than as they are sent.
+ */
+UCLASS(meta=(ExposedAsyncProxy=AsyncTask))
+class QUICKHTTP_API UHttpStreamRequestAsync : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+    friend class FQuickHttpStreamState;
+
+public:
+    /** Fired with every record completed since the last batch, in order. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpStreamRecords OnRecords;
+
+    /** Fired once when the stream ended for good: the server finished an NDJSON response, or answered an SSE reconnect with 204. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpStreamClosed OnClosed;
+
+    /** Fired when the stream fails (HTTP error, buffer overflow, or reconnects exhausted). */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpFailure OnFailure;
+
+    /** Fired when Cancel Stream is called. */
+    UPROPERTY(BlueprintAssignable, Category="QuickHttp")
+    FQuickHttpFailure OnCancelled;
+
+    /**
+     * Open a streamed HTTP response (async).
+     *
+     * @param WorldContextObject     Used for latent/action lifetime and GameThread dispatch.
+     * @param Method                 HTTP verb to use.
+     * @param Url                    Absolute URL to call.
+     * @param Headers                Optional request headers.
+     * @param BodyJsonOptional       Optional JSON body for non-GET verbs.
+     * @param Format                 How records are framed.
+     * @param MaxBufferKB            Upper bound for an unfinished record and for records waiting for the game thread.
+     * @param MaxReconnects          SSE: reconnect attempts in a row without receiving a record before giving up. 0 never reconnects.
+     * @param ReconnectDelaySeconds  SSE: delay before reconnecting until the server sends its own "retry:".
+     */
+    UFUNCTION(BlueprintCallable,
+              Category="QuickHttp",
+              meta=(BlueprintInternalUseOnly="true",
+                    WorldContext="WorldContextObject",
+                    AutoCreateRefTerm="Headers",
+                    AdvancedDisplay="Headers,BodyJsonOptional,MaxBufferKB,MaxReconnects,ReconnectDelaySeconds",
+                    DisplayName="HTTP Stream Request",
+                    Keywords="http stream ndjson jsonl sse server sent events event-stream live",
+                    ToolTip="Receive an NDJSON or Server-Sent Events response record by record as it arrives (async)."))
+    static UHttpStreamRequestAsync* HttpStreamRequest(
+        UObject* WorldContextObject,
+        EQuickHttpMethod Method,
+        const FString& Url,
+        const TArray<FQuickHttpHeader>& Headers,
+        const FString& BodyJsonOptional,
+        EQuickHttpStreamFormat Format = EQuickHttpStreamFormat::NDJSON,
+        int32 MaxBufferKB = 1024,
+        int32 MaxReconnects = 10,
+        float ReconnectDelaySeconds = 3.f
+    );
+
+    /** Close the stream and fire OnCancelled. Records still waiting for the game thread are dropped. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp", meta=(DisplayName="Cancel Stream"))
+    void Cancel();
+
+    // UBlueprintAsyncActionBase
+    virtual void Activate() override;
+
+    // UObject
+    virtual void BeginDestroy() override;
+
+private:
+    void Connect();
+    void HandleResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+    void DrainRecords();
+    void ReconnectOrFail(int32 StatusCode, const FString& Message);
+    void Close(int32 StatusCode);
+    void Fail(int32 StatusCode, const FString& Message);
+    void AbortRequest();
+
+    // Parameters
+    TWeakObjectPtr<UObject> WorldContextObject;
+    EQuickHttpMethod Method;
+    FString Url;
+    TArray<FQuickHttpHeader> Headers;
+    FString BodyJsonOptional;
+    EQuickHttpStreamFormat Format = EQuickHttpStreamFormat::NDJSON;
+    int32 MaxBufferBytes = 1024 * 1024;
+    int32 MaxReconnects = 10;
+    float ReconnectDelaySeconds = 3.f;
+
+    // Stream state
+    TSharedPtr<FQuickHttpStreamState, ESPMode::ThreadSafe> State;
+    TSharedPtr<class IHttpRequest, ESPMode::NotThreadSafe> ActiveRequest;
+    uint32 ConnectionId = 0;
+    int32 ReconnectCount = 0;
+    float LastBackoffSeconds = 0.f;
+    bool bCancelled = false;
+    bool bFinished = false;
+};
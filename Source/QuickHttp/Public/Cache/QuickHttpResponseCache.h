@@ -0,0 +1,103 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Containers/List.h"
+#include "QuickHttpTypes.h"
+
+/** A cached response body with the validators needed to revalidate it. */
+struct QUICKHTTP_API FQuickHttpCacheEntry
+{
+    TArray<uint8> Body;
+    FString ETag;
+    FString LastModified;
+    FString ContentType;
+    int32 StatusCode = 200;
+    int64 StoredAtUnix = 0;
+    int32 MaxAgeSeconds = 0;
+
+    bool IsFresh(int64 NowUnix) const { return NowUnix - StoredAtUnix < MaxAgeSeconds; }
+    bool HasValidator() const { return !ETag.IsEmpty() || !LastModified.IsEmpty(); }
+    int64 GetSizeBytes() const;
+};
+
+typedef TSharedPtr<const FQuickHttpCacheEntry, ESPMode::ThreadSafe> FQuickHttpCacheEntryPtr;
+
+enum class EQuickHttpCacheLookup : uint8
+{
+    Miss,
+    Fresh,
+    Stale
+};
+
+/**
+ * Size-bounded LRU of GET responses with an optional on-disk spill store.
+ *
+ * Entries evicted from memory (and everything left at shutdown) are written to one file per key,
+ * read back through a memory-mapped view so a new process starts warm. An in-memory index of those
+ * files keeps misses off the disk. Thread-safe.
+ */
+class QUICKHTTP_API FQuickHttpResponseCache
+{
+public:
+    /** Set the memory budget and spill directory. An empty directory disables the disk store. */
+    void Configure(int64 InMaxMemoryBytes, const FString& InDiskDirectory, int64 InMaxDiskBytes);
+
+    /** Find an entry in memory, then on disk. Counts hits and misses. */
+    EQuickHttpCacheLookup Lookup(const FString& Key, FQuickHttpCacheEntryPtr& OutEntry);
+
+    /** Insert or replace an entry, evicting least-recently-used entries over budget. */
+    void Store(const FString& Key, FQuickHttpCacheEntry&& Entry);
+
+    /** A 304 confirmed the Stale entry for Key: restart its freshness window and return the entry to serve. */
+    FQuickHttpCacheEntryPtr Revalidate(const FString& Key, const FQuickHttpCacheEntryPtr& Stale, int32 MaxAgeSeconds, const FString& NewETag);
+
+    /** Count a stale lookup that turned into a full download. */
+    void NoteMiss();
+
+    /** Write every in-memory entry to the disk store. */
+    void Flush();
+
+    /** Drop all entries in memory and on disk. */
+    void Clear();
+
+    FQuickHttpCacheStats GetStats() const;
+
+    /**
+     * Parse a Cache-Control header.
+     * @param bOutPublic  Set when the header has "public" (the response may be shared even if the request had credentials).
+     * @return false when the response must not be stored (no-store / private).
+     */
+    static bool ParseCacheControl(const FString& Header, int32& OutMaxAgeSeconds, bool* bOutPublic = nullptr);
+
+private:
+    struct FSlot
+    {
+        FQuickHttpCacheEntryPtr Entry;
+        TDoubleLinkedList<FString>::TDoubleLinkedListNode* LruNode = nullptr;
+    };
+
+    void Touch(FSlot& Slot);
+    void InsertLocked(const FString& Key, const FQuickHttpCacheEntryPtr& Entry);
+    void RemoveLocked(const FString& Key);
+    void EvictLocked();
+    void SpillLocked(const FString& Key, const FQuickHttpCacheEntryPtr& Entry);
+    FQuickHttpCacheEntryPtr ReadFromDisk(const FString& Key);
+    void TrimDiskStore();
+
+    static uint64 GetDiskHash(const FString& Key);
+    static FString GetDiskPath(const FString& Directory, const FString& Key);
+    static bool WriteToDisk(const FString& Directory, const FString& Key, const FQuickHttpCacheEntry& Entry);
+
+    mutable FCriticalSection Lock;
+    TMap<FString, FSlot> Slots;
+    TDoubleLinkedList<FString> Lru;
+    int64 MemoryBytes = 0;
+    int64 MaxMemoryBytes = 16 * 1024 * 1024;
+    FString DiskDirectory;
+    int64 MaxDiskBytes = 64 * 1024 * 1024;
+    int64 DiskBytes = 0;
+    /** Name hashes of the files in the disk store. May list a file that was trimmed since, never miss one that exists. */
+    TSet<uint64> DiskIndex;
+    FQuickHttpCacheStats Stats;
+};
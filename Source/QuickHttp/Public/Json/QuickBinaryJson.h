@@ -0,0 +1,38 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+class FJsonValue;
+
+/**
+ * MessagePack and CBOR (RFC 8949) encoding of JSON values, straight to and from byte buffers.
+ *
+ * Numbers are written as the smallest integer that holds them exactly, otherwise as float32 when
+ * that loses nothing, otherwise as float64. Decoding accepts everything JSON can represent plus the
+ * usual extras: integer map keys become strings, byte strings become Base64 strings, CBOR tags are
+ * skipped, indefinite-length CBOR items are joined, and NaN/Infinity become null.
+ * No length in the input is trusted beyond the bytes actually present. Thread-safe.
+ */
+class QUICKHTTP_API FQuickBinaryJson
+{
+public:
+    /** Deepest array/object nesting Decode accepts. */
+    static constexpr int32 MaxDepth = 256;
+
+    /** MIME type of Format: application/json, application/msgpack or application/cbor. */
+    static const TCHAR* GetContentType(EQuickHttpBodyFormat Format);
+
+    /** Format named by a Content-Type header value (parameters ignored). Json for anything else. */
+    static EQuickHttpBodyFormat FormatFromContentType(const FString& ContentType);
+
+    /** "JSON", "MessagePack" or "CBOR", for error messages. */
+    static const TCHAR* GetFormatName(EQuickHttpBodyFormat Format);
+
+    /** Append Value encoded in Format to Out. Json writes compact UTF-8 text. */
+    static void Encode(const TSharedPtr<FJsonValue>& Value, EQuickHttpBodyFormat Format, TArray<uint8>& Out);
+
+    /** Decode exactly one value from Bytes. false with OutError if Bytes are malformed, truncated or followed by extra data. */
+    static bool Decode(TArrayView<const uint8> Bytes, EQuickHttpBodyFormat Format, TSharedPtr<FJsonValue>& OutValue, FString& OutError);
+};
@@ -3,6 +3,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "QuickHttpTypes.h"
 #include "QuickJsonBuilder.generated.h"
 
 /**
@@ -86,6 +87,17 @@ public:
               meta=(DisplayName="To JSON String", CompactNodeTitle="To JSON"))
     FString ToString(bool bPretty);
 
+    /**
+     * Encode this JSON object as bytes without going through a string: UTF-8 JSON, MessagePack or CBOR.
+     * Binary formats are smaller on the wire and cheaper to decode for frequent state updates.
+     */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON",
+              meta=(DisplayName="To Bytes", Keywords="msgpack messagepack cbor binary encode"))
+    TArray<uint8> ToBytes(EQuickHttpBodyFormat Format);
+
+    /** C++: append the encoded bytes to Out, reusing its capacity. */
+    void WriteBytes(EQuickHttpBodyFormat Format, TArray<uint8>& Out);
+
 public:
     /** Returns an internal shared pointer to the built object (for advanced C++ callers). */
     TSharedPtr<class FJsonObject> GetObject() const { return Root; }
@@ -0,0 +1,98 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "QuickHttpTypes.h"
+#include "QuickJsonDocument.generated.h"
+
+class FJsonValue;
+
+/**
+ * Read-only handle to a parsed JSON value, with typed getters for Blueprints.
+ *
+ * Paths use dots for fields and brackets for array elements, e.g. "items[2].name".
+ * An empty path refers to this value itself. Sub-documents share the parsed tree; nothing is copied.
+ */
+UCLASS(BlueprintType)
+class QUICKHTTP_API UQuickJsonDocument : public UObject
+{
+    GENERATED_BODY()
+public:
+    /** Parse a JSON string (object, array or scalar root). Returns null if the string is not valid JSON. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON",
+              meta=(DisplayName="Parse JSON Document",
+                    Keywords="json parse document read",
+                    ToolTip="Parse a JSON string into a document with typed getters."))
+    static UQuickJsonDocument* ParseJsonDocument(const FString& Json, FString& OutError);
+
+    /** Decode a JSON (UTF-8), MessagePack or CBOR buffer. Returns null if Bytes are not valid in that format. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON",
+              meta=(DisplayName="Parse Document From Bytes",
+                    Keywords="json msgpack messagepack cbor binary parse decode document",
+                    ToolTip="Decode JSON, MessagePack or CBOR bytes into a document with typed getters."))
+    static UQuickJsonDocument* ParseDocumentBytes(const TArray<uint8>& Bytes, EQuickHttpBodyFormat Format, FString& OutError);
+
+    /** Wrap an already-parsed value. Must be called on the game thread. */
+    static UQuickJsonDocument* Wrap(const TSharedPtr<FJsonValue>& Value);
+
+    /** Type of the value at Path, or None if Path does not resolve. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Type"))
+    EQuickJsonType GetType(const FString& Path) const;
+
+    /** True if Path resolves to a value (including null). */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Has Field"))
+    bool HasField(const FString& Path) const;
+
+    /** String at Path. Numbers and booleans are converted; anything else yields Default. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get String"))
+    FString GetString(const FString& Path, const FString& Default) const;
+
+    /** Number at Path, or Default. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Number"))
+    float GetNumber(const FString& Path, float Default) const;
+
+    /** Integer at Path (truncated), or Default. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Int"))
+    int32 GetInt(const FString& Path, int32 Default) const;
+
+    /** Boolean at Path, or Default. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Bool"))
+    bool GetBool(const FString& Path, bool bDefault) const;
+
+    /** Sub-document at Path, or null if Path does not resolve. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Document"))
+    UQuickJsonDocument* GetDocument(const FString& Path) const;
+
+    /** Elements of the array at Path as sub-documents. Empty if Path is not an array. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Array"))
+    TArray<UQuickJsonDocument*> GetArray(const FString& Path) const;
+
+    /** Number of elements of the array (or fields of the object) at Path. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Length"))
+    int32 GetLength(const FString& Path) const;
+
+    /** Field names of the object at Path. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Keys"))
+    TArray<FString> GetKeys(const FString& Path) const;
+
+    /** Serialize the value at Path back to JSON. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="To JSON String", CompactNodeTitle="To JSON"))
+    FString ToJsonString(const FString& Path, bool bPretty) const;
+
+public:
+    /** Resolve Path against this document (for advanced C++ callers). */
+    TSharedPtr<FJsonValue> Find(const FString& Path) const;
+
+    /** The wrapped value (for advanced C++ callers). */
+    TSharedPtr<FJsonValue> GetValue() const { return Root; }
+
+    /**
+     * Decode UTF-8 and parse it. Thread-safe; used by requests to parse off the game thread.
+     * @return false with OutError set if Bytes are not valid JSON.
+     */
+    static bool ParseUtf8(const TArray<uint8>& Bytes, TSharedPtr<FJsonValue>& OutValue, FString& OutError);
+
+private:
+    TSharedPtr<FJsonValue> Root;
+};
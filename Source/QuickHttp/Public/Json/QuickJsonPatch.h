@@ -0,0 +1,46 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+class FJsonValue;
+
+/**
+ * Diff and patch of JSON values as JSON Merge Patch (RFC 7386) or JSON Patch (RFC 6902).
+ *
+ * Diff is a single structural walk: every container is hashed once, bottom-up, and a subtree whose
+ * hash matches on both sides is confirmed equal and skipped without descending into it, so the cost
+ * stays linear in the size of both documents. Arrays are matched by trimming their common prefix and
+ * suffix; the remaining elements are diffed by position, which finds single inserts, removals and edits
+ * but not a minimal edit script for reordered arrays.
+ *
+ * Inputs are never modified. Patches and results share unchanged subtrees with their inputs, so treat
+ * them as read-only. Thread-safe.
+ */
+class QUICKHTTP_API FQuickJsonPatch
+{
+public:
+    /** MIME type of Format: application/merge-patch+json or application/json-patch+json. */
+    static const TCHAR* GetContentType(EQuickJsonPatchFormat Format);
+
+    /**
+     * Patch that turns Source into Target.
+     * A merge patch cannot express a null field value in Target; such fields are removed by the patch instead.
+     * @return  [] when nothing changed; {} for a merge patch between equal objects (see IsEmpty).
+     */
+    static TSharedPtr<FJsonValue> Diff(const TSharedPtr<FJsonValue>& Source, const TSharedPtr<FJsonValue>& Target, EQuickJsonPatchFormat Format);
+
+    /** True if Patch changes nothing, so the request can be skipped. */
+    static bool IsEmpty(const TSharedPtr<FJsonValue>& Patch, EQuickJsonPatchFormat Format);
+
+    /**
+     * Apply Patch to Target. A JSON Patch is applied as a whole: if any operation fails (including a
+     * failed "test"), OutError names it and nothing is returned. Merge patches cannot fail.
+     */
+    static bool Apply(const TSharedPtr<FJsonValue>& Target, const TSharedPtr<FJsonValue>& Patch, EQuickJsonPatchFormat Format,
+        TSharedPtr<FJsonValue>& OutResult, FString& OutError);
+
+    /** Deep equality; numbers compare by value and object fields in any order. */
+    static bool Equals(const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B);
+};
@@ -0,0 +1,56 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "QuickHttpTypes.h"
+
+class FQuickJsonPath;
+typedef TSharedPtr<const FQuickJsonPath, ESPMode::ThreadSafe> FQuickJsonPathPtr;
+
+/**
+ * Compiled JSON path selector that pulls values straight out of JSON text without building a DOM.
+ *
+ * Syntax: an optional leading "$", dotted field names, [N] array indices, [*] or .* wildcards and
+ * ['quoted.keys'], e.g. "data.session.token", "items[*].id", "$['a.b'][0]".
+ * Only branches on the path are walked; everything else is skipped with a bracket/string scan, and
+ * a selector without wildcards stops at its first match. Skipped values are not validated.
+ * Thread-safe: compiled selectors are immutable and shared through a global cache.
+ */
+class QUICKHTTP_API FQuickJsonPath
+{
+public:
+    enum class ESegment : uint8
+    {
+        Field,
+        Index,
+        Wildcard
+    };
+
+    struct FSegment
+    {
+        ESegment Kind = ESegment::Field;
+        FString Name;
+        TArray<uint8> NameUtf8;
+        int32 Index = 0;
+    };
+
+    /** Compile Selector, or return the cached compilation. Null (with OutError) if the selector is malformed. */
+    static FQuickJsonPathPtr Compile(const FString& Selector, FString* OutError = nullptr);
+
+    /** Append every value matching this path to OutMatches. false if the JSON is malformed along the path. */
+    bool Extract(const FString& Json, TArray<FQuickJsonPathMatch>& OutMatches, FString* OutError = nullptr) const;
+
+    /** Same as Extract, on UTF-8 bytes (e.g. a response body) without widening the whole document. */
+    bool ExtractUtf8(TArrayView<const uint8> Json, TArray<FQuickJsonPathMatch>& OutMatches, FString* OutError = nullptr) const;
+
+    const FString& GetSelector() const { return Selector; }
+    const TArray<FSegment>& GetSegments() const { return Segments; }
+    bool HasWildcard() const { return bHasWildcard; }
+
+private:
+    static bool Parse(const FString& Selector, TArray<FSegment>& OutSegments, FString& OutError);
+
+    FString Selector;
+    TArray<FSegment> Segments;
+    bool bHasWildcard = false;
+};
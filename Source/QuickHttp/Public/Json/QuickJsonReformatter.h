@@ -0,0 +1,44 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+enum class EQuickJsonFormat : uint8
+{
+    /** Strip all insignificant whitespace. */
+    Minify,
+    /** One value per line, tab indentation, "key": value. */
+    Pretty,
+    /** Check the document without producing output. */
+    Validate
+};
+
+/**
+ * Single-pass JSON reformatter built on a validating tokenizer.
+ *
+ * Works directly on the text without building a DOM: string contents are copied verbatim (their
+ * escapes are validated, not re-encoded) and only whitespace between tokens changes. String bodies
+ * are scanned with SSE2/AVX2 on x86 and NEON on ARM64, with a scalar fallback elsewhere.
+ * Accepts any root value (object, array or scalar). Thread-safe.
+ */
+struct QUICKHTTP_API FQuickJsonReformatter
+{
+    /**
+     * Reformat Json in one pass.
+     * @param OutError  Set to the first syntax error and its character offset when this returns false.
+     * @return          false if Json is not valid; Out is then unspecified.
+     */
+    static bool Reformat(const FString& Json, EQuickJsonFormat Format, FString& Out, FString* OutError = nullptr);
+
+    /** Same as Reformat, on UTF-8 bytes (e.g. a response body) without widening to TCHAR. */
+    static bool ReformatUtf8(TArrayView<const uint8> Json, EQuickJsonFormat Format, TArray<uint8>& Out, FString* OutError = nullptr);
+
+    /** Validate-only shorthand for Reformat. */
+    static bool Validate(const FString& Json, FString* OutError = nullptr);
+
+    /** Validate-only shorthand for ReformatUtf8. */
+    static bool ValidateUtf8(TArrayView<const uint8> Json, FString* OutError = nullptr);
+
+    /** Name of the vector path compiled in: "AVX2", "SSE2", "NEON" or "Scalar". */
+    static const TCHAR* GetSimdPathName();
+};
@@ -0,0 +1,101 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Json/QuickJsonWriter.h"
+#include "QuickJsonStreamWriter.generated.h"
+
+/**
+ * Blueprint wrapper around FQuickJsonWriter.
+ *
+ * Writes straight into one reusable UTF-8 buffer instead of building a JSON tree. Inside an object
+ * every call needs a Name; inside an array or at the root leave Name empty.
+ *
+ * Usage:
+ *   W = NewJsonStreamWriter()->BeginObject("")->WriteString("event","hit")->BeginArray("samples")->WriteNumber("",1.5)->EndArray()->EndObject();
+ *   Pass W as Options.BodyWriter, or call Reset() and write the next payload into the same buffer.
+ */
+UCLASS(BlueprintType)
+class QUICKHTTP_API UQuickJsonStreamWriter : public UObject
+{
+    GENERATED_BODY()
+public:
+    /** Create a streaming JSON writer. InitialCapacityBytes pre-sizes the buffer. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON",
+              meta=(DisplayName="New JSON Stream Writer",
+                    Keywords="json writer stream telemetry",
+                    ToolTip="Create a streaming JSON writer that appends into one reusable UTF-8 buffer."))
+    static UQuickJsonStreamWriter* NewJsonStreamWriter(int32 InitialCapacityBytes = 4096);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Begin Object", AdvancedDisplay="Name"))
+    UQuickJsonStreamWriter* BeginObject(const FString& Name);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="End Object"))
+    UQuickJsonStreamWriter* EndObject();
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Begin Array", AdvancedDisplay="Name"))
+    UQuickJsonStreamWriter* BeginArray(const FString& Name);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="End Array"))
+    UQuickJsonStreamWriter* EndArray();
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Write String"))
+    UQuickJsonStreamWriter* WriteString(const FString& Name, const FString& Value);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Write Int"))
+    UQuickJsonStreamWriter* WriteInt(const FString& Name, int32 Value);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Write Number"))
+    UQuickJsonStreamWriter* WriteNumber(const FString& Name, float Value);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Write Bool"))
+    UQuickJsonStreamWriter* WriteBool(const FString& Name, bool bValue);
+
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Write Null"))
+    UQuickJsonStreamWriter* WriteNull(const FString& Name);
+
+    /**
+     * Write any struct as a JSON object, field by field, with no JSON object tree in between.
+     * Field names match those of the engine's JSON converter (e.g. "PlayerName" is written as "playerName").
+     */
+    UFUNCTION(BlueprintCallable, CustomThunk, Category="QuickHttp|JSON",
+              meta=(DisplayName="Write Struct",
+                    CustomStructureParam="Value",
+                    AdvancedDisplay="Name",
+                    Keywords="json struct typed serialize body"))
+    UQuickJsonStreamWriter* WriteStruct(const FString& Name, const int32& Value);
+    DECLARE_FUNCTION(execWriteStruct);
+
+    /** Clear the contents for the next payload, keeping the allocated buffer. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|JSON", meta=(DisplayName="Reset"))
+    UQuickJsonStreamWriter* Reset();
+
+    /**
+     * True when one complete JSON value was written.
+     * @param OutError  The first nesting/ordering mistake, if any.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Is Complete"))
+    bool IsComplete(FString& OutError) const;
+
+    /** Size of the encoded payload in bytes. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Size Bytes"))
+    int32 GetSizeBytes() const { return Writer.GetBytes().Num(); }
+
+    /** Decode the payload to a string. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="To JSON String", CompactNodeTitle="To JSON"))
+    FString ToString() const { return Writer.ToString(); }
+
+public:
+    /** The underlying writer (for advanced C++ callers). */
+    FQuickJsonWriter& GetWriter() { return Writer; }
+    const FQuickJsonWriter& GetWriter() const { return Writer; }
+
+    /** Write Struct with an explicit type (for C++ callers). */
+    UQuickJsonStreamWriter* WriteStructValue(const FString& Name, const UStruct* Type, const void* Value);
+
+private:
+    void NameIfAny(const FString& Name);
+
+    FQuickJsonWriter Writer;
+};
@@ -0,0 +1,52 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Json/QuickJsonWriter.h"
+
+/**
+ * USTRUCT <-> UTF-8 JSON through reflection, with no FString or FJsonObject in between.
+ *
+ * Field names and value shapes follow FJsonObjectConverter (authored name with a lower-case first letter,
+ * enums by name, maps as objects), and keys are matched case-insensitively when reading, so payloads are
+ * interchangeable with the engine converter. Unknown keys are skipped; missing keys and nulls keep the
+ * current value. Each struct's field list, with its keys pre-encoded, is built on first use and cached.
+ *
+ * Supported: bool, integers, floats, enums, FString/FName/FText, nested structs (as text for structs with
+ * ExportTextItem such as FGuid), static arrays, TArray/TSet/TMap, soft object/class paths. Object references
+ * are written as paths and left untouched when reading. Thread-safe.
+ *
+ *   TArray<uint8> Body; FString Error;
+ *   FQuickJsonStruct::ToBytes(Request, Body, Error);
+ *   FQuickJsonStruct::FromBytes(Response->GetContent(), Reply, Error);
+ */
+class QUICKHTTP_API FQuickJsonStruct
+{
+public:
+    /** Append Data (an instance of Type) as one JSON object. Errors are recorded on the writer. */
+    static void Write(const UStruct* Type, const void* Data, FQuickJsonWriter& Writer);
+
+    /** Encode Data (an instance of Type) into OutBytes, replacing their contents. */
+    static bool ToBytes(const UStruct* Type, const void* Data, TArray<uint8>& OutBytes, FString& OutError);
+
+    /**
+     * Decode a UTF-8 JSON object into Data, an initialized instance of Type.
+     * On failure OutError names the problem and its byte offset; Data may be partly filled.
+     */
+    static bool FromBytes(TArrayView<const uint8> Json, const UStruct* Type, void* Data, FString& OutError);
+
+    template <typename StructType>
+    static bool ToBytes(const StructType& Value, TArray<uint8>& OutBytes, FString& OutError)
+    {
+        return ToBytes(StructType::StaticStruct(), &Value, OutBytes, OutError);
+    }
+
+    template <typename StructType>
+    static bool FromBytes(TArrayView<const uint8> Json, StructType& OutValue, FString& OutError)
+    {
+        return FromBytes(Json, StructType::StaticStruct(), &OutValue, OutError);
+    }
+
+    /** Forget every cached field list; they are rebuilt on next use. */
+    static void ClearCache();
+};
@@ -0,0 +1,53 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "UObject/StructOnScope.h"
+#include "QuickJsonStructValue.generated.h"
+
+/**
+ * A struct decoded from a response body on a worker thread.
+ * Blueprints copy it into a variable of the same type with Get Struct; C++ reads it in place with Get<T>().
+ */
+UCLASS(BlueprintType)
+class QUICKHTTP_API UQuickJsonStructValue : public UObject
+{
+    GENERATED_BODY()
+public:
+    /** Wrap a decoded instance of Type. Must be called on the game thread. */
+    static UQuickJsonStructValue* Wrap(UScriptStruct* Type, const TSharedPtr<FStructOnScope, ESPMode::ThreadSafe>& Value);
+
+    /**
+     * Copy the decoded value into OutStruct.
+     * @return false, leaving OutStruct untouched, if OutStruct is not of the decoded type (or one of its parents).
+     */
+    UFUNCTION(BlueprintCallable, CustomThunk, Category="QuickHttp|JSON",
+              meta=(DisplayName="Get Struct",
+                    CustomStructureParam="OutStruct",
+                    Keywords="json struct typed response decode",
+                    ToolTip="Copy the decoded response into a struct variable of the response type."))
+    bool GetStruct(int32& OutStruct);
+    DECLARE_FUNCTION(execGetStruct);
+
+    /** The struct type the response was decoded into. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON", meta=(DisplayName="Get Struct Type"))
+    UScriptStruct* GetStructType() const { return Type; }
+
+public:
+    /** Copy into Dest, an initialized instance of DestType. Same rules as Get Struct. */
+    bool CopyTo(const UScriptStruct* DestType, void* Dest) const;
+
+    /** The decoded value in place, or null if it is not a StructType. */
+    template <typename StructType>
+    const StructType* Get() const
+    {
+        return Value.IsValid() && Type && Type->IsChildOf(StructType::StaticStruct()) ? reinterpret_cast<const StructType*>(Value->GetStructMemory()) : nullptr;
+    }
+
+private:
+    UPROPERTY()
+    UScriptStruct* Type = nullptr;
+
+    TSharedPtr<FStructOnScope, ESPMode::ThreadSafe> Value;
+};
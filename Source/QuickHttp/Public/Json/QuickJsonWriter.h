@@ -0,0 +1,79 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Append-only JSON writer that encodes straight into a UTF-8 byte buffer.
+ *
+ * No DOM is built: each call appends its bytes, so large arrays cost one growing buffer instead of
+ * a shared pointer per element. Nesting and key/value order are validated; the first misuse is
+ * recorded and every later call is ignored. Reset() keeps the buffer's capacity for reuse.
+ *
+ *   FQuickJsonWriter W;
+ *   W.BeginObject(); W.Key(TEXT("id")); W.Int(7); W.Key(TEXT("tags")); W.BeginArray(); W.String(TEXT("a")); W.EndArray(); W.EndObject();
+ */
+class QUICKHTTP_API FQuickJsonWriter
+{
+public:
+    explicit FQuickJsonWriter(int32 InitialCapacityBytes = 0);
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    /** Name of the next value. Only valid directly inside an object. */
+    void Key(const FString& Name);
+
+    /** Same as Key, with a name encoded once by EncodeKey (skips escaping for names written over and over). */
+    void EncodedKey(const TArray<uint8>& EncodedName);
+
+    /** Quoted, escaped UTF-8 form of Name for EncodedKey. */
+    static TArray<uint8> EncodeKey(const FString& Name);
+
+    void String(const FString& Value);
+    void Int(int64 Value);
+    void Number(double Value);
+
+    /** Single-precision value, written with the fewest digits that read back as the same float (0.1f stays 0.1). */
+    void Float(float Value);
+    void Bool(bool bValue);
+    void Null();
+
+    /** Clear the contents and error state; the buffer keeps its capacity. */
+    void Reset();
+
+    /** True when exactly one complete root value was written without errors. */
+    bool IsComplete() const { return Error.IsEmpty() && bHasRoot && Scopes.Num() == 0; }
+    bool HasError() const { return !Error.IsEmpty(); }
+    const FString& GetError() const { return Error; }
+
+    /** The encoded UTF-8 bytes written so far. */
+    const TArray<uint8>& GetBytes() const { return Buffer; }
+
+    /** Move the bytes out, leaving the writer empty. */
+    TArray<uint8> MoveBytes();
+
+    /** Decode the buffer to a string (debugging, Blueprint display). */
+    FString ToString() const;
+
+private:
+    enum class EScope : uint8
+    {
+        Object,
+        Array
+    };
+
+    bool BeginValue();
+    void Fail(const TCHAR* Message);
+    void AppendAscii(const ANSICHAR* Text, int32 Len);
+    void AppendEscaped(const FString& Value);
+
+    TArray<uint8> Buffer;
+    TArray<EScope> Scopes;
+    FString Error;
+    bool bNeedComma = false;
+    bool bHasKey = false;
+    bool bHasRoot = false;
+};
@@ -3,6 +3,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "QuickHttpTypes.h"
 #include "QuickHttpBPLibrary.generated.h"
 
 /**
@@ -16,7 +17,7 @@ public:
     /**
      * Pretty-print a JSON string for readability.
      *
-     * Parses the input JSON and re-serializes it with indentation.
+     * Re-indents the input in a single pass without building a JSON tree. Any root value is accepted.
      * @param InJson        Raw/minified JSON.
      * @param OutPrettyJson Pretty-printed JSON (if parse succeeded; otherwise returns input).
      * @return              true if parsing succeeded.
@@ -27,4 +28,181 @@ public:
                     Keywords="json pretty format indent stringify",
                     ToolTip="Format a JSON string with indentation for readability."))
     static bool PrettyPrintJson(const FString& InJson, FString& OutPrettyJson);
+
+    /**
+     * Strip all insignificant whitespace from a JSON string.
+     * @param InJson        JSON to minify.
+     * @param OutMinifiedJson Minified JSON (if valid; otherwise returns input).
+     * @return              true if the input is valid JSON.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Minify JSON",
+                    Keywords="json minify compact whitespace",
+                    ToolTip="Remove all insignificant whitespace from a JSON string."))
+    static bool MinifyJson(const FString& InJson, FString& OutMinifiedJson);
+
+    /**
+     * Check that a string is valid JSON without building a JSON tree.
+     * @param OutError      The first syntax error and its character offset.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Validate JSON",
+                    Keywords="json validate check syntax",
+                    ToolTip="Check that a string is valid JSON."))
+    static bool ValidateJson(const FString& InJson, FString& OutError);
+
+    /**
+     * Pull every value matching a JSON path out of a JSON string without parsing the whole document.
+     * Compiled selectors are cached, so repeating the same Path is cheap.
+     * @param Path          Selector such as "data.session.token", "items[*].id" or "$['a.b'][0]".
+     * @param OutMatches    Matching values in document order.
+     * @return              false if Path is malformed or the JSON is malformed along the path.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Extract JSON Values",
+                    Keywords="json path query select extract field",
+                    ToolTip="Pull every value matching a JSON path out of a JSON string."))
+    static bool ExtractJsonValues(const FString& InJson, const FString& Path, TArray<FQuickJsonPathMatch>& OutMatches);
+
+    /** First string (or scalar as text) at Path. Returns false if nothing matched. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Extract JSON String", Keywords="json path query string"))
+    static bool ExtractJsonString(const FString& InJson, const FString& Path, FString& OutValue);
+
+    /** First number at Path. Returns false if nothing matched or the value is not a number. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Extract JSON Number", Keywords="json path query number float"))
+    static bool ExtractJsonNumber(const FString& InJson, const FString& Path, float& OutValue);
+
+    /** First number at Path, truncated to an integer. Returns false if nothing matched, the value is not a number or it does not fit in an int32. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Extract JSON Int", Keywords="json path query int integer"))
+    static bool ExtractJsonInt(const FString& InJson, const FString& Path, int32& OutValue);
+
+    /** First boolean at Path. Returns false if nothing matched or the value is not a boolean. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Extract JSON Bool", Keywords="json path query bool boolean"))
+    static bool ExtractJsonBool(const FString& InJson, const FString& Path, bool& bOutValue);
+
+    /**
+     * Compute the patch that turns SourceJson into TargetJson, to send with PATCH instead of the whole object.
+     * Unchanged subtrees are skipped by hash, so the cost is linear in the size of both documents.
+     * @param Format          JSON Merge Patch (changed fields only) or JSON Patch (list of operations).
+     * @param OutPatch        Compact patch JSON, ready to be the request body.
+     * @param OutContentType  Content-Type header the patch must be sent with; add it to the request's Headers.
+     * @param bOutChanged     false when the documents are equal and there is nothing to send.
+     * @return                false if either input is not valid JSON.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Diff JSON",
+                    Keywords="json diff patch merge rfc 7386 6902 delta changes",
+                    ToolTip="Compute a JSON Merge Patch or JSON Patch that turns one JSON document into another."))
+    static bool DiffJson(const FString& SourceJson, const FString& TargetJson, EQuickJsonPatchFormat Format,
+                         FString& OutPatch, FQuickHttpHeader& OutContentType, bool& bOutChanged);
+
+    /** Same as Diff JSON, between two JSON Builders (e.g. the state last sent and the current one). A null Source diffs against {}. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Diff JSON Builders",
+                    Keywords="json diff patch merge builder delta changes",
+                    ToolTip="Compute a JSON Merge Patch or JSON Patch between two JSON Builders."))
+    static bool DiffJsonBuilders(UQuickJsonBuilder* Source, UQuickJsonBuilder* Target, EQuickJsonPatchFormat Format,
+                                 FString& OutPatch, FQuickHttpHeader& OutContentType, bool& bOutChanged);
+
+    /**
+     * Apply a JSON Merge Patch or JSON Patch to a JSON document.
+     * A JSON Patch is all or nothing: if an operation fails (including a "test"), OutError names it and OutJson is empty.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|JSON",
+              meta=(DisplayName="Apply JSON Patch",
+                    Keywords="json patch merge apply rfc 7386 6902"))
+    static bool ApplyJsonPatch(const FString& InJson, const FString& Patch, EQuickJsonPatchFormat Format, FString& OutJson, FString& OutError);
+
+    /** Hit/miss/eviction counters for the shared response cache used by requests with bUseCache. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Cache",
+              meta=(DisplayName="Get HTTP Cache Stats",
+                    Keywords="cache etag stats hits misses",
+                    ToolTip="Counters for the QuickHttp response cache."))
+    static FQuickHttpCacheStats GetHttpCacheStats();
+
+    /** Drop every cached response, in memory and on disk. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Cache",
+              meta=(DisplayName="Clear HTTP Cache",
+                    Keywords="cache clear purge",
+                    ToolTip="Remove all QuickHttp cached responses."))
+    static void ClearHttpCache();
+
+    /**
+     * Latency percentiles and counters of finished requests, per host and in total.
+     * Empty when the plugin is built with QUICKHTTP_WITH_METRICS=0.
+     */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Metrics",
+              meta=(DisplayName="Get HTTP Metrics",
+                    Keywords="metrics stats latency percentile histogram",
+                    ToolTip="Aggregated QuickHttp latency and traffic metrics. Returns the totals; PerHost has one entry per host."))
+    static FQuickHttpHostMetrics GetHttpMetrics(TArray<FQuickHttpHostMetrics>& PerHost);
+
+    /** Start aggregating metrics from scratch. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Metrics",
+              meta=(DisplayName="Reset HTTP Metrics",
+                    Keywords="metrics stats reset clear"))
+    static void ResetHttpMetrics();
+
+    /** Circuit breaker state, failure rate and retry budget of every host that has been called. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Resilience",
+              meta=(DisplayName="Get HTTP Circuit Status",
+                    Keywords="circuit breaker retry budget health host open",
+                    ToolTip="Per-host circuit breaker and retry budget state."))
+    static TArray<FQuickHttpCircuitStatus> GetHttpCircuitStatus();
+
+    /** Circuit breaker state of one host. Accepts a URL or a "host[:port]". */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Resilience",
+              meta=(DisplayName="Get HTTP Circuit State",
+                    Keywords="circuit breaker open closed half-open host"))
+    static EQuickHttpCircuitState GetHttpCircuitState(const FString& HostOrUrl);
+
+    /** Close every circuit breaker and refill every retry budget (e.g. after the player changed networks). */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Resilience",
+              meta=(DisplayName="Reset HTTP Circuit Breakers",
+                    Keywords="circuit breaker reset close retry budget"))
+    static void ResetHttpCircuitBreakers();
+
+    /**
+     * Create a telemetry channel, or change its config. Events recorded on a channel are batched into one POST
+     * (JSON array or NDJSON) by count, size and age, and kept on disk while the endpoint is unreachable.
+     * Channels can also be set up in TelemetryChannels under [/Script/QuickHttp.QuickHttpSettings] in DefaultEngine.ini.
+     */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Telemetry",
+              meta=(DisplayName="Configure HTTP Telemetry Channel",
+                    Keywords="telemetry analytics events batch channel"))
+    static bool ConfigureHttpTelemetryChannel(FName Channel, const FQuickHttpTelemetryConfig& Config);
+
+    /** Queue one JSON event on a channel. False if the channel does not exist or the text is not valid JSON. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Telemetry",
+              meta=(DisplayName="Record Telemetry Event",
+                    Keywords="telemetry analytics event json batch"))
+    static bool RecordTelemetryEvent(FName Channel, const FString& EventJson);
+
+    /** Queue the object written by a JSON Stream Writer as one event, without converting it to a string. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Telemetry",
+              meta=(DisplayName="Record Telemetry Event (Writer)",
+                    Keywords="telemetry analytics event stream writer batch"))
+    static bool RecordTelemetryEventFromWriter(FName Channel, UQuickJsonStreamWriter* Event);
+
+    /** Queue the object of a JSON Builder as one event. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Telemetry",
+              meta=(DisplayName="Record Telemetry Event (Builder)",
+                    Keywords="telemetry analytics event builder batch"))
+    static bool RecordTelemetryEventFromBuilder(FName Channel, UQuickJsonBuilder* Event);
+
+    /** Send the queued events of a channel now instead of waiting for the batch limits. None flushes every channel. */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Telemetry",
+              meta=(DisplayName="Flush HTTP Telemetry",
+                    Keywords="telemetry analytics flush send batch"))
+    static void FlushHttpTelemetry(FName Channel);
+
+    /** Queue depth, spill log size and upload counters of every telemetry channel. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Telemetry",
+              meta=(DisplayName="Get HTTP Telemetry Stats",
+                    Keywords="telemetry analytics stats queue throughput"))
+    static TArray<FQuickHttpTelemetryStats> GetHttpTelemetryStats();
 };
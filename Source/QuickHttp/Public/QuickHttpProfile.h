@@ -0,0 +1,88 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "QuickHttpTypes.h"
+#include "QuickHttpProfile.generated.h"
+
+/**
+ * Shared defaults for many requests to one API: base URL, headers, timeout/retry/payload policy
+ * and an auth token.
+ *
+ * Build a profile once (e.g. at startup) and pass it to HTTP Profile Request. Requests keep a
+ * reference instead of copying headers, and read the auth token when each attempt starts, so a
+ * refreshed token reaches every pending request and retry with a single Set Auth Token.
+ * Everything except the token is fixed at creation; make a new profile to change it.
+ */
+UCLASS(BlueprintType)
+class QUICKHTTP_API UQuickHttpProfile : public UObject
+{
+    GENERATED_BODY()
+public:
+    /**
+     * Create a request profile.
+     * @param BaseUrl             Prefix for relative request paths, e.g. "https://api.example.com/v1".
+     * @param Headers             Headers sent with every request; a request's own headers override them by name.
+     * @param AuthHeaderName      Header that carries the auth token.
+     * @param AuthScheme          Prefix of the token value (e.g. "Bearer"); empty sends the token as is.
+     */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Profile",
+              meta=(DisplayName="Make HTTP Profile",
+                    AutoCreateRefTerm="Headers",
+                    AdvancedDisplay="AuthHeaderName,AuthScheme",
+                    Keywords="http profile base url headers auth token defaults"))
+    static UQuickHttpProfile* MakeHttpProfile(
+        const FString& BaseUrl,
+        const TArray<FQuickHttpHeader>& Headers,
+        int32 TimeoutSeconds = 30,
+        int32 MaxRetries = 2,
+        float BackoffBaseSeconds = 0.35f,
+        int32 MaxPayloadKB = 1024,
+        const FString& AuthHeaderName = TEXT("Authorization"),
+        const FString& AuthScheme = TEXT("Bearer"));
+
+    /**
+     * Replace the auth token used by every request made with this profile, including ones already
+     * pending or waiting to retry. Empty clears it. Safe to call from any thread.
+     */
+    UFUNCTION(BlueprintCallable, Category="QuickHttp|Profile", meta=(DisplayName="Set Auth Token", Keywords="auth token bearer refresh login"))
+    void SetAuthToken(const FString& Token);
+
+    /** C++: ask Provider for the token whenever an attempt starts instead of using Set Auth Token. Game thread. Unbind with an empty function. */
+    void SetAuthTokenProvider(TFunction<FString()> Provider) { TokenProvider = MoveTemp(Provider); }
+
+    /** Absolute URL for Path: absolute URLs are kept, anything else is appended to the base URL. */
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Profile", meta=(DisplayName="Resolve URL"))
+    FString ResolveUrl(const FString& Path) const;
+
+    UFUNCTION(BlueprintPure, Category="QuickHttp|Profile", meta=(DisplayName="Get Base URL"))
+    FString GetBaseUrl() const { return BaseUrl; }
+
+    const TArray<FQuickHttpHeader>& GetHeaders() const { return Headers; }
+    int32 GetTimeoutSeconds() const { return TimeoutSeconds; }
+    int32 GetMaxRetries() const { return MaxRetries; }
+    float GetBackoffBaseSeconds() const { return BackoffBaseSeconds; }
+    int32 GetMaxPayloadKB() const { return MaxPayloadKB; }
+    const FString& GetAuthHeaderName() const { return AuthHeaderName; }
+
+    /** Current "<scheme> <token>" value, or empty without a token. Game thread. */
+    FString GetAuthHeaderValue() const;
+
+    /** Profile headers, then the auth header, then Overrides, with later names replacing earlier ones. */
+    TArray<FQuickHttpHeader> MergeHeaders(const TArray<FQuickHttpHeader>& Overrides) const;
+
+private:
+    FString BaseUrl;
+    TArray<FQuickHttpHeader> Headers;
+    int32 TimeoutSeconds = 30;
+    int32 MaxRetries = 2;
+    float BackoffBaseSeconds = 0.35f;
+    int32 MaxPayloadKB = 1024;
+    FString AuthHeaderName;
+    FString AuthScheme;
+
+    // Swapped as a whole on the game thread; requests read it when an attempt starts
+    FString AuthToken;
+    TFunction<FString()> TokenProvider;
+};
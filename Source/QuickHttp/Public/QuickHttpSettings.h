@@ -0,0 +1,134 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "QuickHttpTypes.h"
+#include "QuickHttpSettings.generated.h"
+
+/**
+ * Module-wide QuickHttp settings.
+ * Configure under [/Script/QuickHttp.QuickHttpSettings] in DefaultEngine.ini.
+ */
+UCLASS(config=Engine, defaultconfig)
+class QUICKHTTP_API UQuickHttpSettings : public UObject
+{
+    GENERATED_BODY()
+public:
+    /** Upper bound on retries waiting in the shared retry queue. Retries beyond this fail immediately. */
+    UPROPERTY(config, EditAnywhere, Category="Retry", meta=(ClampMin="1"))
+    int32 MaxPendingRetries = 1024;
+
+    /** Use decorrelated jitter (random between base and 3x the previous delay) instead of exponential backoff. */
+    UPROPERTY(config, EditAnywhere, Category="Retry")
+    bool bUseDecorrelatedJitter = false;
+
+    /** Cap for a single decorrelated-jitter backoff delay, in seconds. */
+    UPROPERTY(config, EditAnywhere, Category="Retry", meta=(ClampMin="0.01"))
+    float MaxBackoffSeconds = 30.f;
+
+    /**
+     * Limit retries per host to a share of its successful traffic: each success earns RetryBudgetPercent of a retry
+     * token and each retry spends one, so during an outage retries stop adding load once the saved-up tokens are gone.
+     */
+    UPROPERTY(config, EditAnywhere, Category="Retry")
+    bool bUseRetryBudget = true;
+
+    /** Retry tokens earned per successful request, in percent of a token. */
+    UPROPERTY(config, EditAnywhere, Category="Retry", meta=(ClampMin="0", ClampMax="100"))
+    float RetryBudgetPercent = 20.f;
+
+    /** Retry tokens a host starts with and can save up; allows short bursts of retries. */
+    UPROPERTY(config, EditAnywhere, Category="Retry", meta=(ClampMin="1"))
+    float RetryBudgetMaxTokens = 10.f;
+
+    /** Longest Retry-After (429/503) a request waits for before retrying; a longer one fails the request instead. */
+    UPROPERTY(config, EditAnywhere, Category="Retry", meta=(ClampMin="0"))
+    float MaxRetryAfterSeconds = 60.f;
+
+    /** Fail requests to a host locally while most of its recent requests failed (5xx, 429, network errors). */
+    UPROPERTY(config, EditAnywhere, Category="Circuit Breaker")
+    bool bUseCircuitBreaker = true;
+
+    /** Recent outcomes per host the failure rate is measured over. The breaker cannot open before it has seen this many. */
+    UPROPERTY(config, EditAnywhere, Category="Circuit Breaker", meta=(ClampMin="1", ClampMax="1000"))
+    int32 CircuitWindowSize = 20;
+
+    /** Failure rate over the window that opens the breaker, in percent. */
+    UPROPERTY(config, EditAnywhere, Category="Circuit Breaker", meta=(ClampMin="1", ClampMax="100"))
+    float CircuitFailureRatePercent = 50.f;
+
+    /** Seconds an open breaker fails requests before letting a probe through. A longer Retry-After on a 503 extends it. */
+    UPROPERTY(config, EditAnywhere, Category="Circuit Breaker", meta=(ClampMin="0.1"))
+    float CircuitOpenSeconds = 10.f;
+
+    /** Max requests on the network at once for a single host. Further requests wait in priority order. */
+    UPROPERTY(config, EditAnywhere, Category="Concurrency", meta=(ClampMin="1"))
+    int32 MaxConcurrentRequestsPerHost = 6;
+
+    /** Max requests on the network at once across all hosts. */
+    UPROPERTY(config, EditAnywhere, Category="Concurrency", meta=(ClampMin="1"))
+    int32 MaxConcurrentRequests = 32;
+
+    /** Share of a host's hedgeable attempts that may be hedged, in percent. Keeps the extra load bounded when a host is slow across the board. */
+    UPROPERTY(config, EditAnywhere, Category="Hedging", meta=(ClampMin="0", ClampMax="100"))
+    float HedgeBudgetPercent = 10.f;
+
+    /** Latency percentile of the host's recent hedged requests used as the hedge delay when a request does not set one. */
+    UPROPERTY(config, EditAnywhere, Category="Hedging", meta=(ClampMin="50", ClampMax="99.9"))
+    float HedgePercentile = 95.f;
+
+    /** Hedge delay for a host without enough latency samples yet, in seconds. */
+    UPROPERTY(config, EditAnywhere, Category="Hedging", meta=(ClampMin="0.01"))
+    float HedgeDefaultDelaySeconds = 1.f;
+
+    /** Lower bound for the adaptive hedge delay, in seconds, so a very fast host is not hedged on noise. */
+    UPROPERTY(config, EditAnywhere, Category="Hedging", meta=(ClampMin="0"))
+    float HedgeMinDelaySeconds = 0.02f;
+
+    /** Memory budget for the response cache used by requests with bUseCache, in kilobytes. */
+    UPROPERTY(config, EditAnywhere, Category="Cache", meta=(ClampMin="0"))
+    int32 CacheMaxMemoryKB = 16 * 1024;
+
+    /** Spill evicted cache entries to Saved/QuickHttp/Cache and flush the cache there at shutdown. */
+    UPROPERTY(config, EditAnywhere, Category="Cache")
+    bool bCachePersistToDisk = true;
+
+    /** Disk budget for the persisted response cache, in megabytes. Oldest files are removed first. */
+    UPROPERTY(config, EditAnywhere, Category="Cache", meta=(ClampMin="0"))
+    int32 CacheMaxDiskMB = 64;
+
+    /** Send Accept-Encoding: gzip, deflate on every request that does not set it. Compressed responses are always decoded. */
+    UPROPERTY(config, EditAnywhere, Category="Compression")
+    bool bAcceptCompressedResponses = true;
+
+    /**
+     * Origins to warm up shortly after the module loads (e.g. "https://api.example.com"): resolve the
+     * name and open a keep-alive connection so the first real request skips DNS and the handshakes.
+     */
+    UPROPERTY(config, EditAnywhere, Category="Prewarm")
+    TArray<FString> PrewarmUrls;
+
+    /** Warm PrewarmUrls automatically at startup. When off, use Prewarm HTTP Connections or QuickHttp.Prewarm. */
+    UPROPERTY(config, EditAnywhere, Category="Prewarm")
+    bool bPrewarmOnStartup = true;
+
+    /** How long resolved addresses are cached, and how long a warmed origin is not warmed again. */
+    UPROPERTY(config, EditAnywhere, Category="Prewarm", meta=(ClampMin="1"))
+    float PrewarmDnsTtlSeconds = 300.f;
+
+    /** Give up on warming an origin after this many seconds. */
+    UPROPERTY(config, EditAnywhere, Category="Prewarm", meta=(ClampMin="1"))
+    int32 PrewarmTimeoutSeconds = 10;
+
+    /**
+     * Telemetry channels available from startup, by name. Events recorded on a channel are batched into one
+     * POST body; channels can also be added or changed at runtime with Configure HTTP Telemetry Channel.
+     */
+    UPROPERTY(config, EditAnywhere, Category="Telemetry")
+    TMap<FName, FQuickHttpTelemetryConfig> TelemetryChannels;
+
+    /** Cancel every pending request (firing On Cancelled) before a new map loads. */
+    UPROPERTY(config, EditAnywhere, Category="Cancellation")
+    bool bCancelRequestsOnMapChange = false;
+};
@@ -5,6 +5,9 @@
 #include "CoreMinimal.h"
 #include "QuickHttpTypes.generated.h"
 
+class UQuickJsonStreamWriter;
+class UQuickJsonBuilder;
+
 USTRUCT(BlueprintType)
 struct FQuickHttpHeader
 {
@@ -27,6 +30,89 @@ enum class EQuickHttpMethod : uint8
     DELETE_ UMETA(DisplayName="DELETE")
 };
 
+UENUM(BlueprintType)
+enum class EQuickHttpPriority : uint8
+{
+    Critical    UMETA(DisplayName="Critical"),
+    High        UMETA(DisplayName="High"),
+    Normal      UMETA(DisplayName="Normal"),
+    Low         UMETA(DisplayName="Low"),
+    Background  UMETA(DisplayName="Background")
+};
+
+/** JSON value type, as reported by UQuickJsonDocument and JSON path extraction. */
+UENUM(BlueprintType)
+enum class EQuickJsonType : uint8
+{
+    None    UMETA(DisplayName="None"),
+    Null    UMETA(DisplayName="Null"),
+    String  UMETA(DisplayName="String"),
+    Number  UMETA(DisplayName="Number"),
+    Boolean UMETA(DisplayName="Boolean"),
+    Array   UMETA(DisplayName="Array"),
+    Object  UMETA(DisplayName="Object")
+};
+
+/** Wire format of a request or response body. */
+UENUM(BlueprintType)
+enum class EQuickHttpBodyFormat : uint8
+{
+    Json        UMETA(DisplayName="JSON"),
+    MessagePack UMETA(DisplayName="MessagePack"),
+    Cbor        UMETA(DisplayName="CBOR")
+};
+
+/** Kind of patch produced by the JSON diff functions. */
+UENUM(BlueprintType)
+enum class EQuickJsonPatchFormat : uint8
+{
+    /** RFC 7386: an object holding only the changed fields, null for removed ones (application/merge-patch+json). */
+    MergePatch  UMETA(DisplayName="JSON Merge Patch"),
+    /** RFC 6902: an array of add/remove/replace operations on JSON pointers (application/json-patch+json). */
+    JsonPatch   UMETA(DisplayName="JSON Patch")
+};
+
+/** Record framing of a streamed response. */
+UENUM(BlueprintType)
+enum class EQuickHttpStreamFormat : uint8
+{
+    /** One JSON value per line (application/x-ndjson, JSON Lines). */
+    NDJSON              UMETA(DisplayName="NDJSON"),
+    /** text/event-stream; reconnects with Last-Event-ID when the stream drops. */
+    ServerSentEvents    UMETA(DisplayName="Server-Sent Events")
+};
+
+/** State of a host's circuit breaker. */
+UENUM(BlueprintType)
+enum class EQuickHttpCircuitState : uint8
+{
+    /** Requests flow normally while failures are counted. */
+    Closed      UMETA(DisplayName="Closed"),
+    /** Too many recent failures: requests to the host fail at once without touching the network. */
+    Open        UMETA(DisplayName="Open"),
+    /** The open period is over: a single probe request decides whether to close or open again. */
+    HalfOpen    UMETA(DisplayName="Half-Open")
+};
+
+/** Checksum computed over a download while it streams to disk. */
+UENUM(BlueprintType)
+enum class EQuickHttpHashAlgorithm : uint8
+{
+    None    UMETA(DisplayName="None"),
+    SHA1    UMETA(DisplayName="SHA-1"),
+    MD5     UMETA(DisplayName="MD5")
+};
+
+/** Body framing of a telemetry batch. */
+UENUM(BlueprintType)
+enum class EQuickHttpBatchFormat : uint8
+{
+    /** [event,event,...] sent as application/json. */
+    JsonArray   UMETA(DisplayName="JSON Array"),
+    /** One event per line, sent as application/x-ndjson. */
+    NDJSON      UMETA(DisplayName="NDJSON")
+};
+
 USTRUCT(BlueprintType)
 struct FQuickHttpError
 {
@@ -43,4 +129,522 @@ struct FQuickHttpError
 
     UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
     FString RawBody;
-};
\ No newline at end of file
+};
+
+/** One value pulled out of a JSON document by a path selector. */
+USTRUCT(BlueprintType)
+struct FQuickJsonPathMatch
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    EQuickJsonType Type = EQuickJsonType::None;
+
+    /** Unescaped text for strings; the literal text for numbers, booleans and null; the raw JSON for objects and arrays. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString StringValue;
+
+    /** Set when Type is Number. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float NumberValue = 0.f;
+
+    /** Set when Type is Boolean. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    bool BoolValue = false;
+};
+
+/** Optional per-request behaviour for HTTP JSON Request (Advanced). */
+USTRUCT(BlueprintType)
+struct FQuickHttpRequestOptions
+{
+    GENERATED_BODY()
+
+    /** Deliver the raw response bytes through OnSuccessBytes and skip the FString conversion. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bDeliverRawBytes = false;
+
+    /**
+     * GET only: serve fresh responses from the shared cache and revalidate stale ones with ETag/Last-Modified.
+     * Responses marked no-store or private are never stored; with an Authorization (or other credential) header, only public ones are.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bUseCache = false;
+
+    /** GET only: share one network request between identical in-flight requests (same URL and headers). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bCoalesceIdenticalRequests = false;
+
+    /** Scheduling class when the per-host or global concurrency limit is reached. FIFO within a class. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    EQuickHttpPriority Priority = EQuickHttpPriority::Normal;
+
+    /** Parse the response on a worker thread and deliver it through OnSuccessDocument. Invalid JSON fails the request. Ignored with bDeliverRawBytes. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bParseOnWorker = false;
+
+    /**
+     * Decode the response (JSON, MessagePack or CBOR) straight into this struct type on a worker thread and deliver it
+     * through OnSuccessStruct, with no JSON object tree in between. A body that does not fit the type fails the request.
+     * Takes precedence over bParseOnWorker; ignored with bDeliverRawBytes.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    UScriptStruct* ResponseStruct = nullptr;
+
+    /** Send this writer's UTF-8 bytes as the body instead of BodyJsonOptional. Copied when the node is created, so the writer can be reset and reused right away. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    UQuickJsonStreamWriter* BodyWriter = nullptr;
+
+    /** JSON path selectors (e.g. "data.session.token", "items[*].id") evaluated on a worker thread. Read the results with Get Extracted Values. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    TArray<FString> ExtractPaths;
+
+    /** gzip the request body and send Content-Encoding: gzip when it is at least CompressBodyThresholdBytes. The server must accept gzip bodies. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bCompressRequestBody = false;
+
+    /** Smallest body worth compressing with bCompressRequestBody, in bytes. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="0"))
+    int32 CompressBodyThresholdBytes = 1024;
+
+    /** Encode this builder's object as the body instead of BodyWriter or BodyJsonOptional. Encoded in BodyFormat when the node is created. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    UQuickJsonBuilder* BodyBuilder = nullptr;
+
+    /** Wire format of the request body, sent as its Content-Type. JSON text bodies are converted once before the first attempt. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    EQuickHttpBodyFormat BodyFormat = EQuickHttpBodyFormat::Json;
+
+    /** Format to ask for in the Accept header. Responses are decoded by their Content-Type, so a server that still answers with JSON works too. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    EQuickHttpBodyFormat ResponseFormat = EQuickHttpBodyFormat::Json;
+
+    /**
+     * GET/PUT/DELETE only: if an attempt has no response after the hedge delay, send the same request again
+     * and take whichever answers first; the other is cancelled. Limited per host by the hedge budget (see UQuickHttpSettings).
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bHedge = false;
+
+    /** Seconds to wait before hedging. 0 uses the host's recent latency percentile (adaptive). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="0"))
+    float HedgeDelaySeconds = 0.f;
+};
+
+/** One request of an HTTP JSON Batch. */
+USTRUCT(BlueprintType)
+struct FQuickHttpBatchItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    EQuickHttpMethod Method = EQuickHttpMethod::GET;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    FString Url;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    TArray<FQuickHttpHeader> Headers;
+
+    /** Optional JSON body for non-GET verbs. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    FString BodyJson;
+};
+
+/** Outcome of one HTTP JSON Batch item, at the same index as its FQuickHttpBatchItem. */
+USTRUCT(BlueprintType)
+struct FQuickHttpBatchResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    bool bSucceeded = false;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 StatusCode = 0;
+
+    /** Response body when bSucceeded. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString ResponseJson;
+
+    /** Failure details when not bSucceeded (including items skipped by the deadline or early-out). */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FQuickHttpError Error;
+};
+
+/** Where a request spent its time. */
+USTRUCT(BlueprintType)
+struct FQuickHttpRequestStats
+{
+    GENERATED_BODY()
+
+    /** Seconds spent waiting for a concurrency slot, summed over all attempts. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float QueueWaitSeconds = 0.f;
+
+    /** Seconds spent on the network, summed over all attempts. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float NetworkSeconds = 0.f;
+
+    /** Network attempts made, including retries. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 Attempts = 0;
+
+    /** Seconds spent converting the body to text, parsing and extracting paths (on a worker thread when the options ask for it). */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float ParseSeconds = 0.f;
+
+    /** Seconds from sending the last attempt to its first response header or byte. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float TimeToFirstByteSeconds = 0.f;
+
+    /** Seconds from the first byte of the last attempt to its completion. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float DownloadSeconds = 0.f;
+
+    /** Seconds between a worker thread finishing with the response and the game thread picking up the result. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float DispatchSeconds = 0.f;
+
+    /** Seconds from activation to the final callback, including retries and backoff. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float TotalSeconds = 0.f;
+
+    /** Request body size before compression. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 RequestBytes = 0;
+
+    /** Request body size as sent (smaller than RequestBytes when it was gzipped). */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 RequestBytesSent = 0;
+
+    /** Response body size as received from the HTTP layer, before QuickHttp decoded it. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 ResponseBytesReceived = 0;
+
+    /** Response body size after gzip/deflate decoding. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 ResponseBytesDecoded = 0;
+
+    /** Seconds spent compressing the request body and decoding the response. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float CodecSeconds = 0.f;
+
+    /** Hedge requests sent (Options.bHedge), over all attempts. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 Hedges = 0;
+
+    /** The response delivered came from a hedge rather than the original request. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    bool bHedgeWon = false;
+};
+
+/** Aggregated metrics of finished requests, for one host or across all of them. */
+USTRUCT(BlueprintType)
+struct FQuickHttpHostMetrics
+{
+    GENERATED_BODY()
+
+    /** "host[:port]", "*" for hosts beyond the tracking limit, or empty for the all-hosts totals. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Host;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Requests = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Failures = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Retries = 0;
+
+    /** Response bytes as received, before decompression. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 BytesReceived = 0;
+
+    /** Request body bytes as sent, after compression. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 BytesSent = 0;
+
+    /** Total request latency percentiles, including retries, in milliseconds (accurate to about 12%). */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float LatencyP50Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float LatencyP90Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float LatencyP99Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float LatencyMaxMs = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float FirstByteP50Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float FirstByteP99Ms = 0.f;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float QueueWaitP99Ms = 0.f;
+
+    /** Hedge requests sent; divide by Requests for the hedge rate. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Hedges = 0;
+
+    /** Requests answered by their hedge; divide by Hedges for how often hedging paid off. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 HedgeWins = 0;
+};
+
+/** One record of a streamed response: an NDJSON line or a Server-Sent Event. */
+USTRUCT(BlueprintType)
+struct FQuickHttpStreamRecord
+{
+    GENERATED_BODY()
+
+    /** The JSON line, or the event's data lines joined with newlines. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Data;
+
+    /** SSE event type ("message" when the server did not name one). Empty for NDJSON. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Event;
+
+    /** SSE last event ID in effect for this event. Empty for NDJSON. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Id;
+};
+
+/** Outcome of pre-warming the connection to one origin. */
+USTRUCT(BlueprintType)
+struct FQuickHttpPrewarmResult
+{
+    GENERATED_BODY()
+
+    /** "scheme://host[:port]" that was warmed. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Origin;
+
+    /** The name resolved and the server answered (any status code counts). */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    bool bSucceeded = false;
+
+    /** Nothing was sent because the origin was warmed less than the DNS TTL ago. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    bool bAlreadyWarm = false;
+
+    /** Status code of the warming HEAD request, 0 if it never got an answer. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 StatusCode = 0;
+
+    /** Addresses the host name resolved to. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    TArray<FString> Addresses;
+
+    /** Name resolution time, 0 when the DNS cache answered. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float DnsMs = 0.f;
+
+    /** First request on a new connection: TCP (and TLS) handshake plus one round trip. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float ColdMs = 0.f;
+
+    /** Same request again on the warmed keep-alive connection. ColdMs - WarmMs is what warming saves. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float WarmMs = 0.f;
+
+    /** Why warming failed, when not bSucceeded. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Error;
+};
+
+/** Circuit breaker and retry budget of one host. */
+USTRUCT(BlueprintType)
+struct FQuickHttpCircuitStatus
+{
+    GENERATED_BODY()
+
+    /** "host[:port]", or "*" for hosts beyond the tracking limit. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FString Host;
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    EQuickHttpCircuitState State = EQuickHttpCircuitState::Closed;
+
+    /** Failed share of the recent outcomes the breaker looks at, in percent. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float FailureRatePercent = 0.f;
+
+    /** Seconds until an open breaker lets a probe through; 0 when not open. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float SecondsUntilProbe = 0.f;
+
+    /** Retries the host's retry budget can still pay for. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float RetryTokens = 0.f;
+
+    /** Times the breaker opened. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Opens = 0;
+
+    /** Requests failed locally because the breaker was open. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Rejected = 0;
+
+    /** Retries skipped because the retry budget was used up. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 RetriesDenied = 0;
+};
+
+/** Counters for the QuickHttp response cache. */
+USTRUCT(BlueprintType)
+struct FQuickHttpCacheStats
+{
+    GENERATED_BODY()
+
+    /** Requests served from a fresh entry without touching the network. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Hits = 0;
+
+    /** Stale entries confirmed by a 304 Not Modified and served from the cache. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Revalidations = 0;
+
+    /** Cacheable requests that had no usable entry. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Misses = 0;
+
+    /** Entries pushed out of memory by the size budget. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 Evictions = 0;
+
+    /** Lookups answered by the on-disk store. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 DiskHits = 0;
+
+    /** Response bytes served from the cache instead of being downloaded. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 BytesSaved = 0;
+
+    /** Entries currently held in memory. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 Entries = 0;
+
+    /** Bytes currently held in memory. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 MemoryBytes = 0;
+};
+
+/** Where and how a telemetry channel uploads its events. */
+USTRUCT(BlueprintType)
+struct FQuickHttpTelemetryConfig
+{
+    GENERATED_BODY()
+
+    /** Endpoint every batch is POSTed to. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    FString Url;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    EQuickHttpBatchFormat Format = EQuickHttpBatchFormat::JsonArray;
+
+    /** Sent with every batch (e.g. an API key). A Content-Type here replaces the one implied by Format. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    TArray<FQuickHttpHeader> Headers;
+
+    /** Send the batch once it holds this many events. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="1"))
+    int32 MaxBatchEvents = 200;
+
+    /** Send the batch once its body reaches this size, in kilobytes before compression. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="1"))
+    int32 MaxBatchKB = 64;
+
+    /** Send the batch once its oldest event waited this long, in seconds. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="0.1"))
+    float MaxBatchAgeSeconds = 10.f;
+
+    /** gzip batch bodies (Content-Encoding: gzip). The endpoint must accept gzip bodies. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bCompress = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="1"))
+    int32 TimeoutSeconds = 30;
+
+    /** Retries of one batch before the endpoint is treated as unreachable. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="0"))
+    int32 MaxRetries = 2;
+
+    /** After a failed batch, wait this long before trying the endpoint again, in seconds. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="1"))
+    float OfflineRetrySeconds = 30.f;
+
+    /**
+     * While the endpoint is unreachable, and at shutdown, append unsent batches to Saved/QuickHttp/Telemetry/<Channel>.qtl;
+     * they are sent from there once the endpoint answers again, also in later sessions.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp")
+    bool bSpillToDisk = true;
+
+    /** Disk budget of the spill log, in megabytes. Batches that do not fit are dropped. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="1"))
+    int32 MaxSpillMB = 16;
+
+    /** Unsent batches kept in memory, in kilobytes. Beyond it the oldest go to the spill log, or are dropped without one. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="QuickHttp", meta=(ClampMin="1"))
+    int32 MaxQueuedKB = 1024;
+};
+
+/** Counters of one telemetry channel. */
+USTRUCT(BlueprintType)
+struct FQuickHttpTelemetryStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    FName Channel;
+
+    /** Events waiting in memory, including the batch being sent. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 QueuedEvents = 0;
+
+    /** Bytes waiting in memory, including the batch being sent. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 QueuedBytes = 0;
+
+    /** Events waiting in the spill log on disk. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int32 SpilledEvents = 0;
+
+    /** Size of the spill log still to be sent. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 SpilledBytes = 0;
+
+    /** Events the endpoint accepted. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 EventsSent = 0;
+
+    /** Batches the endpoint accepted; EventsSent / BatchesSent is the average batch size. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 BatchesSent = 0;
+
+    /** Batch body bytes accepted, before compression. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 BytesSent = 0;
+
+    /** Batches that failed after their retries. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 BatchesFailed = 0;
+
+    /** Events lost: rejected by the endpoint (4xx), invalid, or over the memory and disk budgets. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    int64 EventsDropped = 0;
+
+    /** Recent upload rate, in events per second. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    float EventsPerSecond = 0.f;
+
+    /** The last batch failed and the channel is waiting OfflineRetrySeconds before trying again. */
+    UPROPERTY(BlueprintReadOnly, Category="QuickHttp")
+    bool bOffline = false;
+};
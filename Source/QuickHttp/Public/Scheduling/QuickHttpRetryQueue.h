@@ -0,0 +1,63 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/**
+ * Deadline-ordered queue of pending retries.
+ *
+ * Retries wait in a binary heap and are fired from the module tick, so no thread sleeps
+ * through a backoff. Ties fire in FIFO order. Not thread-safe: used on the game thread only.
+ */
+class QUICKHTTP_API FQuickHttpRetryQueue
+{
+public:
+    explicit FQuickHttpRetryQueue(int32 InMaxPending = 1024);
+
+    /**
+     * Queue Callback to run once DelaySeconds have passed.
+     * @return false (and drops Callback) when MaxPending retries are already queued.
+     */
+    bool Enqueue(double DelaySeconds, TFunction<void()> Callback);
+
+    /** Fire every retry whose deadline is at or before NowSeconds (FPlatformTime::Seconds clock). */
+    void Tick(double NowSeconds);
+
+    /** Drop all queued retries without firing them. */
+    void Reset();
+
+    void SetMaxPending(int32 InMaxPending) { MaxPending = FMath::Max(1, InMaxPending); }
+    int32 GetMaxPending() const { return MaxPending; }
+
+    /** Number of retries currently waiting. */
+    int32 Num() const { return Heap.Num(); }
+
+    /** Decorrelated jitter: min(Cap, random(Base, Previous * 3)). Previous <= 0 starts from Base. */
+    static float DecorrelatedJitter(float BaseSeconds, float PreviousSeconds, float CapSeconds);
+
+    /**
+     * Delay before retry Index (0-based) as configured in UQuickHttpSettings: exponential backoff from
+     * BaseSeconds with a little jitter, or decorrelated jitter from PreviousSeconds.
+     */
+    static float ComputeBackoffSeconds(float BaseSeconds, int32 Index, float PreviousSeconds);
+
+private:
+    struct FEntry
+    {
+        double DueSeconds = 0.0;
+        uint64 Sequence = 0;
+        TFunction<void()> Callback;
+    };
+
+    struct FEntryPredicate
+    {
+        bool operator()(const FEntry& A, const FEntry& B) const
+        {
+            return A.DueSeconds < B.DueSeconds || (A.DueSeconds == B.DueSeconds && A.Sequence < B.Sequence);
+        }
+    };
+
+    TArray<FEntry> Heap;
+    uint64 NextSequence = 0;
+    int32 MaxPending = 1024;
+};
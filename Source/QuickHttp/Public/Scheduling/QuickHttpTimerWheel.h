@@ -0,0 +1,76 @@
+// Copyright 2025 NextLevelPlugins LLC. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+/** Opaque handle to a timer scheduled on a FQuickHttpTimerWheel. */
+struct QUICKHTTP_API FQuickHttpTimerHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+    void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/**
+ * Hierarchical timer wheel used for request deadlines.
+ *
+ * Scheduling and cancelling are O(1); each expiry costs O(1) plus an amortized
+ * cascade when a higher level wraps. Not thread-safe: owned and advanced on the game thread.
+ */
+class QUICKHTTP_API FQuickHttpTimerWheel
+{
+public:
+    explicit FQuickHttpTimerWheel(double InTickSeconds = 0.01);
+
+    /** Schedule Callback to run once after DelaySeconds (rounded up to the next tick). */
+    FQuickHttpTimerHandle Schedule(double DelaySeconds, TFunction<void()> Callback);
+
+    /** Cancel a pending timer. Returns false if it already fired or was cancelled. Invalidates the handle. */
+    bool Cancel(FQuickHttpTimerHandle& Handle);
+
+    /** Advance the wheel by wall-clock time, firing every timer that expired. */
+    void Advance(double DeltaSeconds);
+
+    /** Cancel every pending timer without firing it. */
+    void Reset();
+
+    /** Number of pending timers. */
+    int32 Num() const { return NumActive; }
+
+private:
+    static constexpr int32 RootBits = 8;
+    static constexpr int32 LevelBits = 6;
+    static constexpr int32 NumUpperLevels = 3;
+    static constexpr int32 RootSize = 1 << RootBits;
+    static constexpr int32 LevelSize = 1 << LevelBits;
+    static constexpr int32 NumBuckets = RootSize + NumUpperLevels * LevelSize;
+    static constexpr uint64 MaxDelayTicks = (uint64(1) << (RootBits + NumUpperLevels * LevelBits)) - 1;
+
+    struct FEntry
+    {
+        TFunction<void()> Callback;
+        uint64 ExpiryTick = 0;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+        int32 Bucket = INDEX_NONE;
+        uint32 Serial = 0;
+    };
+
+    int32 BucketFor(uint64 ExpiryTick) const;
+    void Link(int32 Index);
+    void Unlink(int32 Index);
+    int32 AllocEntry();
+    void FreeEntry(int32 Index);
+    void Cascade(int32 Level);
+    void ProcessTick();
+
+    TArray<FEntry> Entries;
+    TArray<int32> FreeList;
+    int32 Buckets[NumBuckets];
+    int32 NumActive = 0;
+    uint64 CurrentTick = 0;
+    double TickSeconds = 0.01;
+    double Accumulator = 0.0;
+};
@@ -7,5 +7,7 @@ public class QuickHttp : ModuleRules
     {
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
         PublicDependencyModuleNames.AddRange(new string[] { "Core","CoreUObject","Engine","HTTP","Json","JsonUtilities","Projects" });
+        PrivateDependencyModuleNames.AddRange(new string[] { "Sockets" });
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
     }
 }